@@ -20,6 +20,7 @@ limitations under the License.
 
 #include <exception>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <string>
@@ -93,6 +94,12 @@ void usage(std::ostream &o)
     o << "  -t / --max-trace <n>    Max length of stack trace before cropping\n";
     o << "  --gc-min-objects <n>    Do not run garbage collector until this many\n";
     o << "  --gc-growth-trigger <n> Run garbage collector after this amount of object growth\n";
+    o << "  --ast-cache <dir>       Cache parsed files in the directory, for later runs\n";
+    o << "  --profile <file>        Write a table of where evaluation spent its time to the file\n";
+    o << "  --profile-folded <file> As --profile but in the folded format used by flame graphs\n";
+    o << "  --stats                 Print heap and garbage collector statistics to stderr\n";
+    o << "  --trace <file>          Write when each phase of evaluation ran to the file, as a\n";
+    o << "                          Chrome trace (see chrome://tracing)\n";
     o << "  --version               Print version\n";
     o << "\n";
     o << "Available fmt options:\n";
@@ -140,6 +147,21 @@ enum Command {
     FMT,
 };
 
+/** A phase beginning or ending, as reported to trace_callback. */
+struct TraceEvent {
+    JsonnetTracePhase phase;
+    bool begin;
+    std::string detail;
+    double timestamp;
+};
+
+static void trace_callback(void *ctx, JsonnetTracePhase phase, int begin, const char *detail,
+                           double timestamp)
+{
+    auto *events = static_cast<std::vector<TraceEvent>*>(ctx);
+    events->push_back(TraceEvent{phase, begin != 0, detail, timestamp});
+}
+
 /** Class for representing configuration read from command line flags.  */
 struct JsonnetConfig {
     Command cmd;
@@ -151,6 +173,11 @@ struct JsonnetConfig {
     bool evalMulti;
     bool evalStream;
     std::string evalMultiOutputDir;
+    std::string evalProfileFile;
+    std::string evalProfileFoldedFile;
+    bool evalStats;
+    std::string evalTraceFile;
+    std::vector<TraceEvent> evalTraceEvents;
 
     // FMT flags
     bool fmtInPlace;
@@ -160,6 +187,7 @@ struct JsonnetConfig {
       : cmd(EVAL), filenameIsCode(false),
         evalMulti(false),
         evalStream(false),
+        evalStats(false),
         fmtInPlace(false),
         fmtTest(false)
     { }
@@ -226,6 +254,36 @@ static bool process_args(int argc,
                     dir += '/';
                 }
                 jsonnet_jpath_add(vm, dir.c_str());
+            } else if (arg == "--ast-cache") {
+                std::string dir = next_arg(i, args);
+                if (dir.length() == 0) {
+                    std::cerr << "ERROR: --ast-cache argument was empty string" << std::endl;
+                    return false;
+                }
+                jsonnet_ast_cache_dir(vm, dir.c_str());
+            } else if (arg == "--profile" || arg == "--profile-folded") {
+                std::string file = next_arg(i, args);
+                if (file.length() == 0) {
+                    std::cerr << "ERROR: " << arg << " argument was empty string" << std::endl;
+                    return false;
+                }
+                if (arg == "--profile") {
+                    config->evalProfileFile = file;
+                } else {
+                    config->evalProfileFoldedFile = file;
+                }
+                jsonnet_profile(vm, 1);
+            } else if (arg == "--stats") {
+                config->evalStats = true;
+                jsonnet_collect_stats(vm, 1);
+            } else if (arg == "--trace") {
+                std::string file = next_arg(i, args);
+                if (file.length() == 0) {
+                    std::cerr << "ERROR: --trace argument was empty string" << std::endl;
+                    return false;
+                }
+                config->evalTraceFile = file;
+                jsonnet_trace_callback(vm, trace_callback, &config->evalTraceEvents);
             } else if (arg == "-E" || arg == "--env") {
                 const std::string var = next_arg(i, args);
                 const char *val = ::getenv(var.c_str());
@@ -543,6 +601,72 @@ static bool write_output_stream(JsonnetVm* vm, char* output)
     return true;
 }
 
+/** Writes the profile requested by --profile and --profile-folded, if any. */
+static bool write_profiles(JsonnetVm* vm, const JsonnetConfig &config)
+{
+    for (int folded = 0 ; folded <= 1 ; ++folded) {
+        const std::string &filename =
+            folded ? config.evalProfileFoldedFile : config.evalProfileFile;
+        if (filename.empty()) continue;
+        char *report = jsonnet_profile_report(vm, folded);
+        std::ofstream f;
+        f.open(filename.c_str());
+        f << report;
+        f.close();
+        jsonnet_realloc(vm, report, 0);
+        if (!f.good()) {
+            std::string msg = "Writing to profile file: " + filename;
+            perror(msg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Writes the events recorded for --trace, if requested, in the Chrome trace event format. */
+static bool write_trace(const JsonnetConfig &config)
+{
+    static const char *const PHASE_NAMES[] = {
+        "lex", "parse", "desugar", "analysis", "import", "evaluate", "gc", "manifest"
+    };
+    if (config.evalTraceFile.empty()) return true;
+    std::ofstream f;
+    f.open(config.evalTraceFile.c_str());
+    f << std::fixed << std::setprecision(3) << "{\"traceEvents\": [";
+    const char *prefix = "\n";
+    for (const auto &event : config.evalTraceEvents) {
+        // Timestamps are in microseconds since the first event.
+        double ts = (event.timestamp - config.evalTraceEvents[0].timestamp) * 1e6;
+        f << prefix << "  {\"name\": \"" << PHASE_NAMES[event.phase] << "\", "
+          << "\"cat\": \"jsonnet\", \"ph\": \"" << (event.begin ? "B" : "E") << "\", "
+          << "\"ts\": " << ts << ", \"pid\": 1, \"tid\": 1";
+        if (event.begin && !event.detail.empty()) {
+            f << ", \"args\": {\"file\": \"";
+            for (unsigned char c : event.detail) {
+                if (c == '"' || c == '\\') {
+                    f << '\\' << c;
+                } else if (c < 0x20) {
+                    static const char *const HEX = "0123456789abcdef";
+                    f << "\\u00" << HEX[c >> 4] << HEX[c & 0xf];
+                } else {
+                    f << c;
+                }
+            }
+            f << "\"}";
+        }
+        f << "}";
+        prefix = ",\n";
+    }
+    f << "\n]}\n";
+    f.close();
+    if (!f.good()) {
+        std::string msg = "Writing to trace file: " + config.evalTraceFile;
+        perror(msg.c_str());
+        return false;
+    }
+    return true;
+}
+
 /** Writes the output JSON to the specified output file for single-file
  * output
  */
@@ -579,9 +703,11 @@ int main(int argc, const char **argv)
             return EXIT_FAILURE;
         }
 
-        // Read input files.
+        // Read input files.  A named file is evaluated with jsonnet_evaluate_file*, which loads
+        // it faster than reading it here.
+        bool eval_file = config.cmd == EVAL && !config.filenameIsCode && config.inputFile != "-";
         std::string input;
-        if (!read_input(&config, &input)) {
+        if (!eval_file && !read_input(&config, &input)) {
             return EXIT_FAILURE;
         }
 
@@ -590,7 +716,13 @@ int main(int argc, const char **argv)
         char *output;
         switch (config.cmd) {
             case EVAL: {
-                if (config.evalMulti) {
+                if (eval_file && config.evalMulti) {
+                    output = jsonnet_evaluate_file_multi(vm, config.inputFile.c_str(), &error);
+                } else if (eval_file && config.evalStream) {
+                    output = jsonnet_evaluate_file_stream(vm, config.inputFile.c_str(), &error);
+                } else if (eval_file) {
+                    output = jsonnet_evaluate_file(vm, config.inputFile.c_str(), &error);
+                } else if (config.evalMulti) {
                     output = jsonnet_evaluate_snippet_multi(
                         vm, config.inputFile.c_str(), input.c_str(), &error);
                 } else if (config.evalStream) {
@@ -601,6 +733,18 @@ int main(int argc, const char **argv)
                         vm, config.inputFile.c_str(), input.c_str(), &error);
                 }
 
+                // The profile, statistics and trace are also of interest when evaluation failed.
+                if (config.evalStats) {
+                    char *stats = jsonnet_stats(vm);
+                    std::cerr << stats;
+                    jsonnet_realloc(vm, stats, 0);
+                }
+                if (!write_profiles(vm, config) || !write_trace(config)) {
+                    jsonnet_realloc(vm, output, 0);
+                    jsonnet_destroy(vm);
+                    return EXIT_FAILURE;
+                }
+
                 if (error) {
                     std::cerr << output;
                     std::cerr.flush();
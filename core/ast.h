@@ -20,9 +20,13 @@ limitations under the License.
 #include <cstdlib>
 #include <cassert>
 
+#include <cstdint>
+
 #include <iostream>
-#include <string>
 #include <map>
+#include <new>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "lexer.h"
@@ -88,6 +92,9 @@ typedef std::vector<const Identifier *> Identifiers;
 
 
 /** All AST nodes are subtypes of this class.
+ *
+ * Fodder is kept inline in the nodes, where the formatter edits it.  ASTs that are only evaluated
+ * are parsed without fodder (see jsonnet_lex), so theirs is empty and allocates nothing.
  */
 struct AST {
     LocationRange location;
@@ -729,14 +736,67 @@ struct Var : public AST {
 
 
 /** Allocates ASTs on demand, frees them in its destructor.
+ *
+ * ASTs and identifiers are carved out of large blocks of memory, which are all freed at once by
+ * the destructor.  Only the destructors of the objects are run one by one, for the memory held
+ * by their members.
+ *
+ * An Allocator can be given a parent, which must outlive it.  Identifiers that the parent has
+ * interned are then shared with the child, so ASTs kept in a long-lived allocator can be mixed
+ * with ASTs from short-lived ones.  The child's own identifiers take precedence, so identifiers
+ * interned by the parent later on do not change the ones the child has already handed out.
  */
 class Allocator {
-    std::map<String, const Identifier*> internedIdentifiers;
+    /** Size of the blocks that memory is allocated from.  Bigger objects get a block each. */
+    static const size_t BLOCK_SIZE = 64 * 1024;
+
+    const Allocator *parent;
+    std::unordered_map<String, const Identifier*> internedIdentifiers;
     ASTs allocated;
+    std::vector<char*> blocks;
+
+    /** The unused part of the last block. */
+    char *unused;
+    size_t unusedSize;
+
+    const Identifier *findIdentifier(const String &name) const
+    {
+        auto it = internedIdentifiers.find(name);
+        if (it != internedIdentifiers.end()) {
+            return it->second;
+        }
+        if (parent != nullptr) {
+            return parent->findIdentifier(name);
+        }
+        return nullptr;
+    }
+
+    void *allocate(size_t size, size_t align)
+    {
+        size_t pad = (align - reinterpret_cast<uintptr_t>(unused) % align) % align;
+        if (unused == nullptr || pad + size > unusedSize) {
+            size_t block_size = size + align > BLOCK_SIZE ? size + align : BLOCK_SIZE;
+            unused = new char[block_size];
+            unusedSize = block_size;
+            blocks.push_back(unused);
+            pad = (align - reinterpret_cast<uintptr_t>(unused) % align) % align;
+        }
+        void *r = unused + pad;
+        unused += pad + size;
+        unusedSize -= pad + size;
+        return r;
+    }
+
     public:
+    Allocator(const Allocator *parent = nullptr)
+      : parent(parent), unused(nullptr), unusedSize(0)
+    { }
+    Allocator(const Allocator &) = delete;
+    Allocator &operator=(const Allocator &) = delete;
+
     template <class T, class... Args> T* make(Args&&... args)
     {
-        auto r = new T(std::forward<Args>(args)...);
+        auto r = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
         allocated.push_back(r);
         return r;
     }
@@ -746,24 +806,28 @@ class Allocator {
      */
     const Identifier *makeIdentifier(const String &name)
     {
-        auto it = internedIdentifiers.find(name);
-        if (it != internedIdentifiers.end()) {
-            return it->second;
+        auto *found = findIdentifier(name);
+        if (found != nullptr) {
+            return found;
         }
-        auto r = new Identifier(name);
+        auto r = new (allocate(sizeof(Identifier), alignof(Identifier))) Identifier(name);
         internedIdentifiers[name] = r;
         return r;
     }
     ~Allocator()
     {
         for (auto x : allocated) {
-            delete x;
+            x->~AST();
         }
         allocated.clear();
         for (auto x : internedIdentifiers) {
-            delete x.second;
+            x.second->~Identifier();
         }
         internedIdentifiers.clear();
+        for (auto x : blocks) {
+            delete[] x;
+        }
+        blocks.clear();
     }
 };
 
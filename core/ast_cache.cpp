@@ -0,0 +1,686 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <cstdint>
+#include <cstdio>
+
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include "ast_cache.h"
+#include "digest.h"
+#include "libjsonnet.h"
+#include "string_utils.h"
+
+namespace {
+
+/** Identifies the file format.  Change FORMAT whenever the encoding changes. */
+const std::string MAGIC = "JSONNET-AST";
+const unsigned long FORMAT = 1;
+
+/** Used in place of an AST type for null pointers. */
+const unsigned long TAG_NULL = 0xfe;
+
+/** Used in place of an AST type to refer to an AST that was already written. */
+const unsigned long TAG_REF = 0xff;
+
+/** 64 bit FNV-1a, continuing from h to hash data that follows what gave h. */
+uint64_t hash(const char *s, size_t length, uint64_t h = 14695981039346656037ULL)
+{
+    for (size_t i = 0 ; i < length ; ++i) {
+        h ^= static_cast<unsigned char>(s[i]);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+uint64_t hash(const std::string &s, uint64_t h = 14695981039346656037ULL)
+{
+    return hash(s.data(), s.length(), h);
+}
+
+/** A hash as 16 hex digits. */
+std::string hex(uint64_t h)
+{
+    char buf[17];
+    std::snprintf(buf, sizeof buf, "%016llx", (unsigned long long)h);
+    return buf;
+}
+
+/** Writes an AST in a pre-order traversal, sharing nodes that are reachable more than once.
+ *
+ * Numbers are written as LEB128.  File names and identifiers go into tables that precede the
+ * AST, so that each is only written once.
+ */
+class Serializer {
+    std::string body;
+    std::map<std::string, unsigned long> files;
+    std::vector<const std::string *> fileTable;
+    std::map<const Identifier *, unsigned long> ids;
+    std::vector<const Identifier *> idTable;
+    std::map<const AST *, unsigned long> nodes;
+
+    static void uint(std::string &out, unsigned long v)
+    {
+        while (v >= 0x80) {
+            out += char((v & 0x7f) | 0x80);
+            v >>= 7;
+        }
+        out += char(v);
+    }
+
+    static void bytes(std::string &out, const std::string &s)
+    {
+        uint(out, s.length());
+        out += s;
+    }
+
+    static void string32(std::string &out, const String &s)
+    {
+        uint(out, s.length());
+        for (char32_t c : s)
+            uint(out, c);
+    }
+
+    void uint(unsigned long v)
+    {
+        uint(body, v);
+    }
+
+    void identifier(const Identifier *id)
+    {
+        auto it = ids.find(id);
+        if (it == ids.end()) {
+            it = ids.insert(std::make_pair(id, idTable.size())).first;
+            idTable.push_back(id);
+        }
+        uint(it->second);
+    }
+
+    /** An identifier that may be nullptr. */
+    void maybeIdentifier(const Identifier *id)
+    {
+        if (id == nullptr) {
+            uint(0);
+        } else {
+            uint(1);
+            identifier(id);
+        }
+    }
+
+    void identifiers(const Identifiers &ids)
+    {
+        uint(ids.size());
+        for (const auto *id : ids)
+            identifier(id);
+    }
+
+    void location(const LocationRange &loc)
+    {
+        auto it = files.find(loc.file);
+        if (it == files.end()) {
+            it = files.insert(std::make_pair(loc.file, fileTable.size())).first;
+            fileTable.push_back(&it->first);
+        }
+        uint(it->second);
+        uint(loc.begin.line);
+        uint(loc.begin.column);
+        uint(loc.end.line);
+        uint(loc.end.column);
+    }
+
+    public:
+
+    void ast(const AST *ast_)
+    {
+        if (ast_ == nullptr) {
+            uint(TAG_NULL);
+            return;
+        }
+        auto it = nodes.find(ast_);
+        if (it != nodes.end()) {
+            uint(TAG_REF);
+            uint(it->second);
+            return;
+        }
+
+        uint(ast_->type);
+        location(ast_->location);
+        identifiers(ast_->freeVariables);
+
+        if (auto *ast = dynamic_cast<const Apply*>(ast_)) {
+            this->ast(ast->target);
+            uint(ast->args.size());
+            for (const auto &arg : ast->args)
+                this->ast(arg.expr);
+            uint(ast->tailstrict);
+
+        } else if (auto *ast = dynamic_cast<const Array*>(ast_)) {
+            uint(ast->elements.size());
+            for (const auto &el : ast->elements)
+                this->ast(el.expr);
+
+        } else if (auto *ast = dynamic_cast<const Binary*>(ast_)) {
+            uint(ast->op);
+            this->ast(ast->left);
+            this->ast(ast->right);
+
+        } else if (auto *ast = dynamic_cast<const BuiltinFunction*>(ast_)) {
+            uint(ast->id);
+            identifiers(ast->params);
+
+        } else if (auto *ast = dynamic_cast<const Conditional*>(ast_)) {
+            this->ast(ast->cond);
+            this->ast(ast->branchTrue);
+            this->ast(ast->branchFalse);
+
+        } else if (auto *ast = dynamic_cast<const DesugaredObject*>(ast_)) {
+            uint(ast->asserts.size());
+            for (const AST *assert : ast->asserts)
+                this->ast(assert);
+            uint(ast->fields.size());
+            for (const auto &field : ast->fields) {
+                uint(field.hide);
+                this->ast(field.name);
+                this->ast(field.body);
+            }
+
+        } else if (auto *ast = dynamic_cast<const Error*>(ast_)) {
+            this->ast(ast->expr);
+
+        } else if (auto *ast = dynamic_cast<const Function*>(ast_)) {
+            uint(ast->params.size());
+            for (const auto &param : ast->params)
+                identifier(param.id);
+            this->ast(ast->body);
+
+        } else if (auto *ast = dynamic_cast<const Import*>(ast_)) {
+            this->ast(ast->file);
+
+        } else if (auto *ast = dynamic_cast<const Importstr*>(ast_)) {
+            this->ast(ast->file);
+
+        } else if (auto *ast = dynamic_cast<const Index*>(ast_)) {
+            this->ast(ast->target);
+            uint(ast->isSlice);
+            this->ast(ast->index);
+            this->ast(ast->end);
+            this->ast(ast->step);
+            maybeIdentifier(ast->id);
+
+        } else if (auto *ast = dynamic_cast<const Local*>(ast_)) {
+            uint(ast->binds.size());
+            for (const auto &bind : ast->binds) {
+                identifier(bind.var);
+                this->ast(bind.body);
+            }
+            this->ast(ast->body);
+
+        } else if (auto *ast = dynamic_cast<const LiteralBoolean*>(ast_)) {
+            uint(ast->value);
+
+        } else if (auto *ast = dynamic_cast<const LiteralNumber*>(ast_)) {
+            bytes(body, ast->originalString);
+
+        } else if (auto *ast = dynamic_cast<const LiteralString*>(ast_)) {
+            string32(body, ast->value);
+            uint(ast->tokenKind);
+            bytes(body, ast->blockIndent);
+            bytes(body, ast->blockTermIndent);
+
+        } else if (dynamic_cast<const LiteralNull*>(ast_)) {
+            // Nothing to do.
+
+        } else if (auto *ast = dynamic_cast<const ObjectComprehensionSimple*>(ast_)) {
+            this->ast(ast->field);
+            this->ast(ast->value);
+            identifier(ast->id);
+            this->ast(ast->array);
+
+        } else if (dynamic_cast<const Self*>(ast_)) {
+            // Nothing to do.
+
+        } else if (auto *ast = dynamic_cast<const SuperIndex*>(ast_)) {
+            this->ast(ast->index);
+            maybeIdentifier(ast->id);
+
+        } else if (auto *ast = dynamic_cast<const Unary*>(ast_)) {
+            uint(ast->op);
+            this->ast(ast->expr);
+
+        } else if (auto *ast = dynamic_cast<const Var*>(ast_)) {
+            identifier(ast->id);
+            identifier(ast->original);
+
+        } else {
+            std::cerr << "INTERNAL ERROR: Cannot serialize AST: " << ast_->type << std::endl;
+            std::abort();
+        }
+
+        unsigned long index = nodes.size();
+        nodes[ast_] = index;
+    }
+
+    /** The tables followed by the ASTs written so far. */
+    std::string result(void)
+    {
+        std::string r;
+        uint(r, fileTable.size());
+        for (const auto *file : fileTable)
+            bytes(r, *file);
+        uint(r, idTable.size());
+        for (const auto *id : idTable)
+            string32(r, id->name);
+        return r + body;
+    }
+};
+
+/** Thrown by the Deserializer when the data does not make sense. */
+struct InvalidData { };
+
+/** The inverse of Serializer.
+ *
+ * The data comes from a file, so it is checked as it is read.  All ASTs created are owned by
+ * the allocator, even if the data turns out to be invalid part of the way through.
+ */
+class Deserializer {
+    Allocator *alloc;
+    const char *data;
+    size_t length;
+    size_t pos;
+    std::vector<std::string> fileTable;
+    std::vector<const Identifier *> idTable;
+    std::vector<AST *> nodes;
+
+    unsigned long uint(void)
+    {
+        unsigned long r = 0;
+        for (unsigned shift = 0 ; ; shift += 7) {
+            if (pos >= length || shift >= 64) throw InvalidData();
+            unsigned char c = data[pos++];
+            r |= (unsigned long)(c & 0x7f) << shift;
+            if (!(c & 0x80)) return r;
+        }
+    }
+
+    /** An integer that must be at most max. */
+    unsigned long uint(unsigned long max)
+    {
+        unsigned long r = uint();
+        if (r > max) throw InvalidData();
+        return r;
+    }
+
+    std::string bytes(void)
+    {
+        unsigned long len = uint();
+        if (len > length - pos) throw InvalidData();
+        std::string r(data + pos, len);
+        pos += len;
+        return r;
+    }
+
+    String string32(void)
+    {
+        unsigned long len = uint();
+        if (len > length - pos) throw InvalidData();
+        String r;
+        r.reserve(len);
+        for (unsigned long i = 0 ; i < len ; ++i)
+            r += char32_t(uint(0x10ffff));
+        return r;
+    }
+
+    /** An index into a table of the given size. */
+    unsigned long index(size_t size)
+    {
+        unsigned long r = uint();
+        if (r >= size) throw InvalidData();
+        return r;
+    }
+
+    const Identifier *identifier(void)
+    {
+        return idTable[index(idTable.size())];
+    }
+
+    const Identifier *maybeIdentifier(void)
+    {
+        if (uint(1) == 0) return nullptr;
+        return identifier();
+    }
+
+    Identifiers identifiers(void)
+    {
+        Identifiers r;
+        unsigned long n = count();
+        for (unsigned long i = 0 ; i < n ; ++i)
+            r.push_back(identifier());
+        return r;
+    }
+
+    LocationRange location(void)
+    {
+        const std::string &file = fileTable[index(fileTable.size())];
+        unsigned long begin_line = uint();
+        unsigned long begin_column = uint();
+        unsigned long end_line = uint();
+        unsigned long end_column = uint();
+        return LocationRange(file, Location(begin_line, begin_column),
+                             Location(end_line, end_column));
+    }
+
+    /** The number of items in a list, each of which takes at least one byte. */
+    unsigned long count(void)
+    {
+        return uint(length - pos);
+    }
+
+    AST *notNull(AST *ast)
+    {
+        if (ast == nullptr) throw InvalidData();
+        return ast;
+    }
+
+    AST *child(void)
+    {
+        return notNull(ast());
+    }
+
+    public:
+
+    Deserializer(Allocator *alloc, const char *data, size_t length)
+      : alloc(alloc), data(data), length(length), pos(0)
+    {
+        unsigned long num_files = count();
+        for (unsigned long i = 0 ; i < num_files ; ++i)
+            fileTable.push_back(bytes());
+        unsigned long num_ids = count();
+        for (unsigned long i = 0 ; i < num_ids ; ++i)
+            idTable.push_back(alloc->makeIdentifier(string32()));
+    }
+
+    bool atEnd(void)
+    {
+        return pos == length;
+    }
+
+    AST *ast(void)
+    {
+        unsigned long tag = uint();
+        if (tag == TAG_NULL) return nullptr;
+        if (tag == TAG_REF) return nodes[index(nodes.size())];
+
+        LocationRange loc = location();
+        Identifiers free_variables = identifiers();
+        AST *r;
+        switch (tag) {
+            case AST_APPLY: {
+                AST *target = child();
+                Apply::Args args;
+                unsigned long n = count();
+                for (unsigned long i = 0 ; i < n ; ++i)
+                    args.emplace_back(child(), Fodder{});
+                bool tailstrict = uint(1);
+                r = alloc->make<Apply>(loc, Fodder{}, target, Fodder{}, args, false, Fodder{},
+                                       Fodder{}, tailstrict);
+            } break;
+
+            case AST_ARRAY: {
+                Array::Elements elements;
+                unsigned long n = count();
+                for (unsigned long i = 0 ; i < n ; ++i)
+                    elements.emplace_back(child(), Fodder{});
+                r = alloc->make<Array>(loc, Fodder{}, elements, false, Fodder{});
+            } break;
+
+            case AST_BINARY: {
+                BinaryOp op = BinaryOp(uint(BOP_OR));
+                AST *left = child();
+                AST *right = child();
+                r = alloc->make<Binary>(loc, Fodder{}, left, Fodder{}, op, right);
+            } break;
+
+            case AST_BUILTIN_FUNCTION: {
+                unsigned long id = uint();
+                Identifiers params = identifiers();
+                r = alloc->make<BuiltinFunction>(loc, id, params);
+            } break;
+
+            case AST_CONDITIONAL: {
+                AST *cond = child();
+                AST *branch_true = child();
+                AST *branch_false = child();
+                r = alloc->make<Conditional>(loc, Fodder{}, cond, Fodder{}, branch_true,
+                                             Fodder{}, branch_false);
+            } break;
+
+            case AST_DESUGARED_OBJECT: {
+                ASTs asserts;
+                unsigned long num_asserts = count();
+                for (unsigned long i = 0 ; i < num_asserts ; ++i)
+                    asserts.push_back(child());
+                DesugaredObject::Fields fields;
+                unsigned long num_fields = count();
+                for (unsigned long i = 0 ; i < num_fields ; ++i) {
+                    auto hide = ObjectField::Hide(uint(ObjectField::VISIBLE));
+                    AST *name = child();
+                    AST *body = child();
+                    fields.emplace_back(hide, name, body);
+                }
+                r = alloc->make<DesugaredObject>(loc, asserts, fields);
+            } break;
+
+            case AST_ERROR: {
+                r = alloc->make<Error>(loc, Fodder{}, child());
+            } break;
+
+            case AST_FUNCTION: {
+                Params params;
+                unsigned long n = count();
+                for (unsigned long i = 0 ; i < n ; ++i)
+                    params.emplace_back(Fodder{}, identifier(), Fodder{});
+                AST *body = child();
+                r = alloc->make<Function>(loc, Fodder{}, Fodder{}, params, false, Fodder{}, body);
+            } break;
+
+            case AST_IMPORT: {
+                auto *file = dynamic_cast<LiteralString*>(child());
+                if (file == nullptr) throw InvalidData();
+                r = alloc->make<Import>(loc, Fodder{}, file);
+            } break;
+
+            case AST_IMPORTSTR: {
+                auto *file = dynamic_cast<LiteralString*>(child());
+                if (file == nullptr) throw InvalidData();
+                r = alloc->make<Importstr>(loc, Fodder{}, file);
+            } break;
+
+            case AST_INDEX: {
+                AST *target = child();
+                bool is_slice = uint(1);
+                AST *index = ast();
+                AST *end = ast();
+                AST *step = ast();
+                const Identifier *id = maybeIdentifier();
+                auto *index_ast = alloc->make<Index>(loc, Fodder{}, target, Fodder{}, is_slice,
+                                                     index, Fodder{}, end, Fodder{}, step,
+                                                     Fodder{});
+                index_ast->id = id;
+                r = index_ast;
+            } break;
+
+            case AST_LOCAL: {
+                Local::Binds binds;
+                unsigned long n = count();
+                for (unsigned long i = 0 ; i < n ; ++i) {
+                    const Identifier *var = identifier();
+                    AST *body = child();
+                    binds.emplace_back(Fodder{}, var, Fodder{}, body, false, Fodder{}, Params{},
+                                       false, Fodder{}, Fodder{});
+                }
+                AST *body = child();
+                r = alloc->make<Local>(loc, Fodder{}, binds, body);
+            } break;
+
+            case AST_LITERAL_BOOLEAN: {
+                r = alloc->make<LiteralBoolean>(loc, Fodder{}, uint(1));
+            } break;
+
+            case AST_LITERAL_NUMBER: {
+                r = alloc->make<LiteralNumber>(loc, Fodder{}, bytes());
+            } break;
+
+            case AST_LITERAL_STRING: {
+                String value = string32();
+                auto token_kind = LiteralString::TokenKind(uint(LiteralString::BLOCK));
+                std::string block_indent = bytes();
+                std::string block_term_indent = bytes();
+                r = alloc->make<LiteralString>(loc, Fodder{}, value, token_kind, block_indent,
+                                               block_term_indent);
+            } break;
+
+            case AST_LITERAL_NULL: {
+                r = alloc->make<LiteralNull>(loc, Fodder{});
+            } break;
+
+            case AST_OBJECT_COMPREHENSION_SIMPLE: {
+                AST *field = child();
+                AST *value = child();
+                const Identifier *id = identifier();
+                AST *array = child();
+                r = alloc->make<ObjectComprehensionSimple>(loc, field, value, id, array);
+            } break;
+
+            case AST_SELF: {
+                r = alloc->make<Self>(loc, Fodder{});
+            } break;
+
+            case AST_SUPER_INDEX: {
+                AST *index = ast();
+                const Identifier *id = maybeIdentifier();
+                r = alloc->make<SuperIndex>(loc, Fodder{}, Fodder{}, index, Fodder{}, id);
+            } break;
+
+            case AST_UNARY: {
+                UnaryOp op = UnaryOp(uint(UOP_MINUS));
+                r = alloc->make<Unary>(loc, Fodder{}, op, child());
+            } break;
+
+            case AST_VAR: {
+                const Identifier *id = identifier();
+                const Identifier *original = identifier();
+                r = alloc->make<Var>(loc, Fodder{}, id, original);
+            } break;
+
+            default:
+            throw InvalidData();
+        }
+        r->freeVariables = free_variables;
+        nodes.push_back(r);
+        return r;
+    }
+};
+
+/** The name of the cache entry, and the header that goes at the start of it.
+ *
+ * Both use the SHA-256 of the content, so a different file cannot be made to load the entry.
+ */
+void cache_key(const std::string &cache_dir, const std::string &filename,
+               const char *content, size_t length, std::string &path, std::string &header)
+{
+    std::string digest = jsonnet_sha256(content, length);
+    std::string key = std::string(LIB_JSONNET_VERSION) + '\0' + filename + '\0' + digest;
+    path = cache_dir + jsonnet_sha256(key) + ".ast";
+
+    std::stringstream ss;
+    ss << MAGIC << ' ' << FORMAT << ' ' << LIB_JSONNET_VERSION << ' '
+       << length << ' ' << digest << '\n' << filename << '\0';
+    header = ss.str();
+}
+
+}  // namespace
+
+std::string jsonnet_ast_serialize(const AST *ast)
+{
+    Serializer serializer;
+    serializer.ast(ast);
+    return serializer.result();
+}
+
+AST *jsonnet_ast_deserialize(Allocator *alloc, const char *data, size_t length)
+{
+    try {
+        Deserializer deserializer(alloc, data, length);
+        AST *r = deserializer.ast();
+        if (!deserializer.atEnd()) return nullptr;
+        return r;
+    } catch (const InvalidData &) {
+        return nullptr;
+    }
+}
+
+AST *jsonnet_ast_deserialize(Allocator *alloc, const std::string &data)
+{
+    return jsonnet_ast_deserialize(alloc, data.data(), data.length());
+}
+
+AST *jsonnet_ast_cache_load(Allocator *alloc, const std::string &cache_dir,
+                            const std::string &filename, const char *content, size_t length)
+{
+    std::string path, header;
+    cache_key(cache_dir, filename, content, length, path, header);
+    std::string data;
+    bool opened;
+    if (!jsonnet_read_file(path, data, opened)) return nullptr;
+    if (data.compare(0, header.length(), header) != 0) return nullptr;
+    // The header is followed by a checksum of the AST, as 16 hex digits.
+    if (data.length() < header.length() + 16) return nullptr;
+    const char *body = data.data() + header.length() + 16;
+    size_t body_length = data.length() - header.length() - 16;
+    if (data.compare(header.length(), 16, hex(hash(body, body_length))) != 0) return nullptr;
+    return jsonnet_ast_deserialize(alloc, body, body_length);
+}
+
+void jsonnet_ast_cache_save(const std::string &cache_dir, const std::string &filename,
+                            const char *content, size_t length, const AST *ast)
+{
+    std::string path, header;
+    cache_key(cache_dir, filename, content, length, path, header);
+    // Other processes, and other threads of this one, can be saving the same file.
+    static std::atomic<unsigned long> counter(0);
+    std::stringstream tmp_path;
+    tmp_path << path << ".tmp." << getpid() << "." << std::this_thread::get_id() << "."
+             << counter++;
+    {
+        std::ofstream f(tmp_path.str().c_str(), std::ios::binary);
+        if (!f.good()) return;
+        std::string body = jsonnet_ast_serialize(ast);
+        f << header << hex(hash(body)) << body;
+        if (!f.good()) {
+            f.close();
+            std::remove(tmp_path.str().c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_path.str().c_str(), path.c_str()) != 0)
+        std::remove(tmp_path.str().c_str());
+}
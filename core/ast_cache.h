@@ -0,0 +1,60 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef JSONNET_AST_CACHE_H
+#define JSONNET_AST_CACHE_H
+
+#include <string>
+
+#include "ast.h"
+
+/** Serialize an AST that has been through jsonnet_desugar and jsonnet_static_analysis.
+ *
+ * Fodder is not kept, so the result is only good for execution, not for reformatting.
+ */
+std::string jsonnet_ast_serialize(const AST *ast);
+
+/** Rebuild an AST serialized by jsonnet_ast_serialize.
+ *
+ * \returns The AST, or nullptr if the data is truncated or otherwise invalid.
+ */
+AST *jsonnet_ast_deserialize(Allocator *alloc, const char *data, size_t length);
+AST *jsonnet_ast_deserialize(Allocator *alloc, const std::string &data);
+
+/** Look up the AST of a file in a cache directory.
+ *
+ * Entries are keyed by the interpreter version, the filename (which appears in the AST's
+ * locations) and the SHA-256 of the content.
+ *
+ * \param alloc Used to create the AST.
+ * \param cache_dir The directory, ending in a '/'.
+ * \param filename The name of the file, as used in error messages.
+ * \param content The Jsonnet code in the file.
+ * \param length The number of bytes at content.
+ * \returns The AST if it was cached, otherwise nullptr.
+ */
+AST *jsonnet_ast_cache_load(Allocator *alloc, const std::string &cache_dir,
+                            const std::string &filename, const char *content, size_t length);
+
+/** Store the AST of a file in a cache directory, for jsonnet_ast_cache_load.
+ *
+ * Failing to write the cache entry is not an error.  Entries are written atomically, so many
+ * processes can share the directory.
+ */
+void jsonnet_ast_cache_save(const std::string &cache_dir, const std::string &filename,
+                            const char *content, size_t length, const AST *ast);
+
+#endif
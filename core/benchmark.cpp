@@ -0,0 +1,305 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/** Times each phase of the interpreter separately over the given files and some synthetic
+ * programs, e.g. over the benchmarks and test_suite directories with "make bench":
+ *
+ *   ./benchmark [--runs <n>] [--json <file>] <filename>...
+ *
+ * The phases are lex, parse, desugar, static analysis, evaluation, manifestation and
+ * reformatting.  The gc column is not a phase: it is the garbage collection time spent within
+ * both evaluation and manifestation (which evaluates the fields that were not yet evaluated), so
+ * it can exceed the evaluation time.  Each program is run several times and the median and
+ * variance of each phase are reported.  Files that fail in any phase (some tests are meant to
+ * fail) are left out.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "libjsonnet.h"
+}
+
+#include "desugarer.h"
+#include "formatter.h"
+#include "lexer.h"
+#include "parser.h"
+#include "static_analysis.h"
+#include "string_utils.h"
+#include "vm.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const char *const PHASES[] = {
+    "lex", "parse", "desugar", "analysis", "evaluate", "gc", "manifest", "fmt"
+};
+const unsigned NUM_PHASES = sizeof PHASES / sizeof *PHASES;
+
+struct Program {
+    std::string name;
+    std::string code;
+};
+
+/** The seconds spent in each phase by the runs of a program. */
+struct Measurements {
+    std::vector<double> runs[NUM_PHASES];
+};
+
+double median(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    size_t n = v.size();
+    return n % 2 == 1 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+double variance(const std::vector<double> &v)
+{
+    double mean = 0;
+    for (double x : v) mean += x;
+    mean /= v.size();
+    double r = 0;
+    for (double x : v) r += (x - mean) * (x - mean);
+    return r / v.size();
+}
+
+double seconds_since(Clock::time_point &start)
+{
+    Clock::time_point now = Clock::now();
+    double r = std::chrono::duration<double>(now - start).count();
+    start = now;
+    return r;
+}
+
+/** Read a whole file, returning false if it could not be read, e.g. because it is a directory. */
+bool read_file(const std::string &path, std::string &content)
+{
+    std::ifstream f(path.c_str());
+    if (!f.good())
+        return false;
+    try {
+        content.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    } catch (const std::ios_base::failure &) {
+        return false;
+    }
+    return true;
+}
+
+char *import_callback(void *ctx, const char *base, const char *rel, char **found_here,
+                      JsonnetImportBuffer *content)
+{
+    auto &files = *static_cast<std::list<std::string>*>(ctx);
+    std::string path = rel[0] == '/' ? rel : std::string(base) + rel;
+    std::string code;
+    if (!read_file(path, code)) {
+        char *r = static_cast<char*>(std::malloc(std::strlen("Not found") + 1));
+        std::strcpy(r, "Not found");
+        return r;
+    }
+    files.push_back(code);
+    *found_here = static_cast<char*>(std::malloc(path.length() + 1));
+    std::strcpy(*found_here, path.c_str());
+    content->data = files.back().data();
+    content->length = files.back().length();
+    content->release = nullptr;
+    return nullptr;
+}
+
+/** Run every phase once, adding the times to m.
+ *
+ * \throws StaticError or RuntimeError if the program fails.
+ */
+void run(const Program &p, Measurements &m)
+{
+    // Imported files are kept until the interpreter is done with them.
+    std::list<std::string> imported;
+    VmSession session;
+    Allocator alloc(&session.alloc);
+    VmStats stats;
+
+    Clock::time_point t = Clock::now();
+    Tokens tokens = jsonnet_lex(p.name, p.code.c_str(), false);
+    m.runs[0].push_back(seconds_since(t));
+    AST *expr = jsonnet_parse(&alloc, tokens);
+    m.runs[1].push_back(seconds_since(t));
+    jsonnet_desugar(&alloc, expr);
+    m.runs[2].push_back(seconds_since(t));
+    jsonnet_static_analysis(expr);
+    m.runs[3].push_back(seconds_since(t));
+    jsonnet_vm_execute(&session, &alloc, expr, std::map<std::string, VmExt>(),
+                       VmNativeCallbackMap(), 500, 1000, 2.0, import_callback, &imported, false,
+                       nullptr, &stats, nullptr);
+    m.runs[4].push_back(stats.evaluateSeconds);
+    m.runs[5].push_back(stats.gcMarkSeconds + stats.gcSweepSeconds);
+    m.runs[6].push_back(stats.manifestSeconds);
+
+    // The formatter needs the comments and whitespace, and changes the AST.
+    Allocator fmt_alloc;
+    Tokens fmt_tokens = jsonnet_lex(p.name, p.code.c_str());
+    AST *fmt_expr = jsonnet_parse(&fmt_alloc, fmt_tokens);
+    t = Clock::now();
+    jsonnet_fmt(fmt_expr, fmt_tokens.back().fodder, FmtOpts());
+    m.runs[7].push_back(seconds_since(t));
+}
+
+/** Programs that stress one part of the interpreter each. */
+std::vector<Program> synthetic_programs(void)
+{
+    std::vector<Program> r;
+    std::stringstream ss;
+
+    // An object literal with many fields.
+    ss << "{\n";
+    for (unsigned i = 0 ; i < 20000 ; ++i)
+        ss << "  f" << i << ": " << i << ",\n";
+    ss << "}\n";
+    r.push_back(Program{"<wide object>", ss.str()});
+
+    // A long chain of objects extending each other, each using super.
+    ss.str("");
+    ss << "{ x: 0 }";
+    for (unsigned i = 1 ; i <= 100 ; ++i)
+        ss << "\n+ { f" << i << ": self.x, x: super.x + 1 }";
+    ss << "\n";
+    r.push_back(Program{"<deep mixins>", ss.str()});
+
+    // A big string literal, and big strings built at runtime.
+    ss.str("");
+    ss << "local lit = '";
+    for (unsigned i = 0 ; i < 100000 ; ++i)
+        ss << char('a' + i % 26);
+    ss << "';\n";
+    ss << "[std.length(lit + lit), std.length(std.join(',', [std.toString(i) for i in "
+       << "std.range(1, 2000)]))]\n";
+    r.push_back(Program{"<big strings>", ss.str()});
+
+    // A big array literal, and big arrays built at runtime.
+    ss.str("");
+    ss << "local lit = [";
+    for (unsigned i = 0 ; i < 5000 ; ++i)
+        ss << i << ", ";
+    ss << "];\n";
+    ss << "local squares = [i * i for i in std.range(1, 5000)];\n";
+    ss << "[std.length(lit), std.foldl(function(a, b) a + b, squares, 0), "
+       << "std.length(std.filter(function(x) x % 3 == 0, lit))]\n";
+    r.push_back(Program{"<large arrays>", ss.str()});
+
+    return r;
+}
+
+}  // namespace
+
+int main(int argc, const char **argv)
+{
+    std::vector<Program> programs = synthetic_programs();
+    std::string json_file;
+    unsigned runs = 5;
+    for (int i = 1 ; i < argc ; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "--json" || arg == "--runs") && i + 1 < argc) {
+            if (arg == "--json") {
+                json_file = argv[++i];
+            } else {
+                runs = std::max(1, std::atoi(argv[++i]));
+            }
+            continue;
+        } else if (arg[0] == '-') {
+            std::cerr << "Usage: " << argv[0] << " [--runs <n>] [--json <file>] <filename>..."
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::string code;
+        if (!read_file(arg, code)) {
+            std::cerr << "Could not open " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+        programs.push_back(Program{arg, code});
+    }
+
+    std::vector<std::pair<const Program*, Measurements>> results;
+    for (const auto &p : programs) {
+        Measurements m;
+        try {
+            for (unsigned i = 0 ; i < runs ; ++i)
+                run(p, m);
+        } catch (const StaticError &) {
+            continue;
+        } catch (const RuntimeError &) {
+            continue;
+        }
+        results.emplace_back(&p, m);
+    }
+
+    std::cout << std::left << std::setw(40) << "program";
+    for (auto phase : PHASES)
+        std::cout << std::right << std::setw(10) << phase;
+    std::cout << "  (median ms)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    double totals[NUM_PHASES] = {};
+    for (const auto &result : results) {
+        std::cout << std::left << std::setw(40) << result.first->name << std::right;
+        for (unsigned i = 0 ; i < NUM_PHASES ; ++i) {
+            double ms = median(result.second.runs[i]) * 1000;
+            totals[i] += ms;
+            std::cout << std::setw(10) << ms;
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::left << std::setw(40) << "total" << std::right;
+    for (double ms : totals)
+        std::cout << std::setw(10) << ms;
+    std::cout << std::endl;
+    std::cout << "gc is the part of evaluate and manifest spent collecting garbage." << std::endl;
+
+    if (!json_file.empty()) {
+        std::ofstream f(json_file.c_str());
+        f << std::scientific << std::setprecision(6);
+        f << "{\n   \"runs\": " << runs << ",\n   \"programs\": [";
+        const char *prefix = "\n";
+        for (const auto &result : results) {
+            f << prefix << "      {\n         \"name\": \""
+              << encode_utf8(jsonnet_string_escape(decode_utf8(result.first->name), false))
+              << "\",\n";
+            for (unsigned i = 0 ; i < NUM_PHASES ; ++i) {
+                const std::vector<double> &v = result.second.runs[i];
+                f << "         \"" << PHASES[i] << "\": { \"median\": " << median(v)
+                  << ", \"variance\": " << variance(v) << " }"
+                  << (i + 1 < NUM_PHASES ? ",\n" : "\n");
+            }
+            f << "      }";
+            prefix = ",\n";
+        }
+        f << "\n   ]\n}\n";
+        f.close();
+        if (!f.good()) {
+            std::cerr << "Could not write " << json_file << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
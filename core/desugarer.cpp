@@ -25,7 +25,6 @@ static const Fodder EF;  // Empty fodder.
 
 static const LocationRange E;  // Empty.
 
-static unsigned long max_builtin = 24;
 BuiltinDecl jsonnet_builtin_decl(unsigned long builtin)
 {
     switch (builtin) {
@@ -54,6 +53,20 @@ BuiltinDecl jsonnet_builtin_decl(unsigned long builtin)
         case 22: return {U"modulo", {U"a", U"b"}};
         case 23: return {U"extVar", {U"x"}};
         case 24: return {U"primitiveEquals", {U"a", U"b"}};
+        case 25: return {U"native", {U"name"}};
+        case 26: return {U"md5", {U"s"}};
+        case 27: return {U"sha256", {U"s"}};
+        case 28: return {U"base64", {U"input"}};
+        case 29: return {U"base64DecodeBytes", {U"str"}};
+        case 30: return {U"base64Decode", {U"str"}};
+        case 31: return {U"escapeStringJson", {U"str_"}};
+        case 32: return {U"manifestJsonEx", {U"value", U"indent"}};
+        case BUILTIN_MERGE_PATCH: return {U"mergePatch", {U"target", U"patch"}};
+        case 34: return {U"splitLimit", {U"str", U"c", U"maxsplits"}};
+        case 35: return {U"findSubstr", {U"pat", U"str"}};
+        case 36: return {U"strReplace", {U"str", U"from", U"to"}};
+        case 37: return {U"slice", {U"indexable", U"index", U"end", U"step"}};
+        case 38: return {U"range", {U"from", U"to"}};
         default:
         std::cerr << "INTERNAL ERROR: Unrecognized builtin function: " << builtin << std::endl;
         std::abort();
@@ -62,10 +75,6 @@ BuiltinDecl jsonnet_builtin_decl(unsigned long builtin)
     return BuiltinDecl();
 }
 
-static constexpr char STD_CODE[] = {
-    #include "std.jsonnet.h"
-};
-
 /** Desugar Jsonnet expressions to reduce the number of constructs the rest of the implementation
  * needs to understand.
  *
@@ -718,32 +727,16 @@ class Desugarer {
     {
         desugar(ast, 0);
 
-        // Now, implement the std library by wrapping in a local construct.
-        Tokens tokens = jsonnet_lex("std.jsonnet", STD_CODE);
-        AST *std_ast = jsonnet_parse(alloc, tokens);
-        desugar(std_ast, 0);
-        auto *std_obj = dynamic_cast<DesugaredObject*>(std_ast);
-        if (std_obj == nullptr) {
-            std::cerr << "INTERNAL ERROR: std.jsonnet not an object." << std::endl;
-            std::abort();
-        }
-
-        // Bind 'std' builtins that are implemented natively.
-        DesugaredObject::Fields &fields = std_obj->fields;
-        for (unsigned long c=0 ; c <= max_builtin ; ++c) {
-            const auto &decl = jsonnet_builtin_decl(c);
-            Identifiers params;
-            for (const auto &p : decl.params)
-                params.push_back(alloc->makeIdentifier(p));
-            fields.emplace_back(
-                ObjectField::HIDDEN,
-                str(decl.name),
-                alloc->make<BuiltinFunction>(E, c, params));
-        }
+        // Now, implement the std library by wrapping in a local construct.  The std object
+        // itself is built once by the std_snapshot tool and bound to $std by the interpreter,
+        // only thisFile differs from one file to the next.
+        DesugaredObject::Fields fields;
         fields.emplace_back(
             ObjectField::HIDDEN,
             str(U"thisFile"),
             str(decode_utf8(ast->location.file)));
+        AST *std_obj = make<Binary>(E, EF, var(id(U"$std")), EF, BOP_PLUS,
+                                    make<DesugaredObject>(E, ASTs{}, fields));
 
         ast = alloc->make<Local>(ast->location, EF, singleBind(id(U"std"), std_obj), ast);
     }
@@ -754,3 +747,9 @@ void jsonnet_desugar(Allocator *alloc, AST *&ast)
     Desugarer desugarer(alloc);
     desugarer.desugarFile(ast);
 }
+
+void jsonnet_desugar_std(Allocator *alloc, AST *&ast)
+{
+    Desugarer desugarer(alloc);
+    desugarer.desugar(ast, 0);
+}
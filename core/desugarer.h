@@ -20,7 +20,16 @@ limitations under the License.
 #include "ast.h"
 
 /** Translate the AST to remove syntax sugar.
+ *
+ * The result refers to the standard library through the variable $std, which the interpreter
+ * binds to the standard library object (see std_snapshot.cpp).
  */
 void jsonnet_desugar(Allocator *alloc, AST *&ast);
 
+/** Translate the AST to remove syntax sugar, without binding std.
+ *
+ * This is only for std.jsonnet itself, which is desugared at build time by std_snapshot.cpp.
+ */
+void jsonnet_desugar_std(Allocator *alloc, AST *&ast);
+
 #endif
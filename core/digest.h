@@ -0,0 +1,31 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef JSONNET_DIGEST_H
+#define JSONNET_DIGEST_H
+
+#include <cstddef>
+
+#include <string>
+
+/** The MD5 digest of the bytes, in lower case hexadecimal. */
+std::string jsonnet_md5(const std::string &bytes);
+
+/** The SHA-256 digest of the bytes, in lower case hexadecimal. */
+std::string jsonnet_sha256(const char *bytes, size_t length);
+std::string jsonnet_sha256(const std::string &bytes);
+
+#endif  // JSONNET_DIGEST_H
@@ -0,0 +1,246 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <string>
+#include <vector>
+
+#include "json_parser.h"
+#include "static_error.h"
+#include "string_utils.h"
+
+namespace {
+
+class JsonParser {
+    const char *c;
+    const char *end;
+    JsonParseHandler &handler;
+
+    static bool isDigit(char x)
+    {
+        return x >= '0' && x <= '9';
+    }
+
+    static bool isHex(char x)
+    {
+        return isDigit(x) || (x >= 'a' && x <= 'f') || (x >= 'A' && x <= 'F');
+    }
+
+    void skipWhitespace(void)
+    {
+        while (c < end && (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r'))
+            ++c;
+    }
+
+    bool literal(const char *word)
+    {
+        size_t len = std::strlen(word);
+        if (size_t(end - c) < len || std::memcmp(c, word, len) != 0) return false;
+        c += len;
+        return true;
+    }
+
+    /** Parse a string, the opening quote having been consumed. */
+    bool string(String &r)
+    {
+        const char *begin = c;
+        bool escaped = false;
+        while (true) {
+            if (c == end) return false;
+            unsigned char x = *c;
+            if (x == '"') break;
+            // Jsonnet allows raw control characters, but JSON does not.
+            if (x < 0x20) return false;
+            if (x == '\\') {
+                escaped = true;
+                ++c;
+                if (c == end) return false;
+                switch (*c) {
+                    case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                    break;
+
+                    case 'u':
+                    if (end - c < 5) return false;
+                    for (int i = 1 ; i <= 4 ; ++i) {
+                        if (!isHex(c[i])) return false;
+                    }
+                    c += 4;
+                    break;
+
+                    default:
+                    return false;
+                }
+            }
+            ++c;
+        }
+        // Decode exactly as the lexer and desugarer would decode the same literal.
+        r = decode_utf8(std::string(begin, c));
+        if (escaped)
+            r = jsonnet_string_unescape(LocationRange(), r);
+        ++c;
+        return true;
+    }
+
+    bool number(double &r)
+    {
+        const char *begin = c;
+        if (c < end && *c == '-') ++c;
+        if (c == end) return false;
+        if (*c == '0') {
+            ++c;
+        } else if (isDigit(*c)) {
+            while (c < end && isDigit(*c)) ++c;
+        } else {
+            return false;
+        }
+        if (c < end && *c == '.') {
+            ++c;
+            if (c == end || !isDigit(*c)) return false;
+            while (c < end && isDigit(*c)) ++c;
+        }
+        if (c < end && (*c == 'e' || *c == 'E')) {
+            ++c;
+            if (c < end && (*c == '+' || *c == '-')) ++c;
+            if (c == end || !isDigit(*c)) return false;
+            while (c < end && isDigit(*c)) ++c;
+        }
+        r = std::strtod(std::string(begin, c).c_str(), nullptr);
+        // Jsonnet would only report an overflow if the value was used.
+        return std::isfinite(r);
+    }
+
+    /** Parse an object key and the colon after it. */
+    bool key(void)
+    {
+        skipWhitespace();
+        if (c == end || *c != '"') return false;
+        ++c;
+        String k;
+        if (!string(k)) return false;
+        handler.key(k);
+        skipWhitespace();
+        if (c == end || *c != ':') return false;
+        ++c;
+        return true;
+    }
+
+    public:
+
+    JsonParser(const char *data, size_t length, JsonParseHandler &handler)
+      : c(data), end(data + length), handler(handler)
+    { }
+
+    bool parse(void)
+    {
+        // Explicit, so that deeply nested documents cannot overflow the C++ stack.
+        struct Container {
+            bool object;
+            size_t size;
+        };
+        std::vector<Container> stack;
+
+        while (true) {
+            // Parse a value, or open a container and go around again for its first value.
+            skipWhitespace();
+            if (c == end) return false;
+            switch (*c) {
+                case '{':
+                ++c;
+                skipWhitespace();
+                if (c < end && *c == '}') {
+                    ++c;
+                    if (!handler.objectEnd(0)) return false;
+                    break;
+                }
+                if (!key()) return false;
+                stack.push_back(Container{true, 0});
+                continue;
+
+                case '[':
+                ++c;
+                skipWhitespace();
+                if (c < end && *c == ']') {
+                    ++c;
+                    handler.arrayEnd(0);
+                    break;
+                }
+                stack.push_back(Container{false, 0});
+                continue;
+
+                case '"': {
+                    ++c;
+                    String v;
+                    if (!string(v)) return false;
+                    handler.string(v);
+                } break;
+
+                case 't':
+                if (!literal("true")) return false;
+                handler.boolean(true);
+                break;
+
+                case 'f':
+                if (!literal("false")) return false;
+                handler.boolean(false);
+                break;
+
+                case 'n':
+                if (!literal("null")) return false;
+                handler.null();
+                break;
+
+                default: {
+                    double v;
+                    if (!number(v)) return false;
+                    handler.number(v);
+                }
+            }
+
+            // A value is complete.  Close every container that it completes.
+            while (true) {
+                skipWhitespace();
+                if (stack.empty()) return c == end;
+                Container &top = stack.back();
+                top.size++;
+                if (c == end) return false;
+                if (*c == ',') {
+                    ++c;
+                    if (top.object && !key()) return false;
+                    break;
+                }
+                if (*c != (top.object ? '}' : ']')) return false;
+                ++c;
+                Container closed = top;
+                stack.pop_back();
+                if (closed.object) {
+                    if (!handler.objectEnd(closed.size)) return false;
+                } else {
+                    handler.arrayEnd(closed.size);
+                }
+            }
+        }
+    }
+};
+
+}  // namespace
+
+bool jsonnet_parse_json(const char *data, size_t length, JsonParseHandler &handler)
+{
+    return JsonParser(data, length, handler).parse();
+}
@@ -0,0 +1,58 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef JSONNET_JSON_PARSER_H
+#define JSONNET_JSON_PARSER_H
+
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "unicode.h"
+
+/** Receives the values found by jsonnet_parse_json.
+ *
+ * Values are reported bottom-up: the elements of an array (or the keys and values of an object)
+ * come first, then arrayEnd (or objectEnd) with their number.
+ */
+struct JsonParseHandler {
+    virtual ~JsonParseHandler(void) { }
+    virtual void null(void) = 0;
+    virtual void boolean(bool v) = 0;
+    virtual void number(double v) = 0;
+    virtual void string(const String &v) = 0;
+    /** The key of the next value in the innermost object. */
+    virtual void key(const String &v) = 0;
+    virtual void arrayEnd(size_t elements) = 0;
+    /** \returns false to abandon the parse, e.g. for a duplicate key. */
+    virtual bool objectEnd(size_t fields) = 0;
+};
+
+/** Parse a strict JSON document, without building an AST.
+ *
+ * Only input that Jsonnet would evaluate to exactly the same value is accepted, so anything else
+ * (including JSON with duplicate keys or numbers out of range) can fall back to the full parser
+ * and get the usual error messages.
+ *
+ * \param data The document, which does not need to be terminated.
+ * \param length The number of bytes at data.
+ * \param handler Receives the values.
+ * \returns Whether the whole document was accepted.
+ */
+bool jsonnet_parse_json(const char *data, size_t length, JsonParseHandler &handler);
+
+#endif  // JSONNET_JSON_PARSER_H
@@ -24,6 +24,7 @@ limitations under the License.
 #include <string>
 #include <list>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include "unicode.h"
@@ -126,7 +127,11 @@ struct Token {
         END_OF_FILE
     } kind;
 
-    /** Fodder before this token. */
+    /** Fodder before this token.
+     *
+     * Kept inline rather than out of line: when lexing for evaluation it is always empty, which
+     * costs no allocation, only the size of an empty vector.
+     */
     Fodder fodder;
 
     /** Content of the token if it wasn't a keyword. */
@@ -142,15 +147,15 @@ struct Token {
      */
     std::string stringBlockTermIndent;
 
-    String data32(void) { return decode_utf8(data); }
+    String data32(void) const { return decode_utf8(data); }
 
     LocationRange location;
 
-    Token(Kind kind, const Fodder &fodder, const std::string &data,
-          const std::string &string_block_indent, const std::string &string_block_term_indent,
-          const LocationRange &location)
-      : kind(kind), fodder(fodder), data(data), stringBlockIndent(string_block_indent),
-        stringBlockTermIndent(string_block_term_indent), location(location)
+    Token(Kind kind, Fodder fodder, std::string data, std::string string_block_indent,
+          std::string string_block_term_indent, const LocationRange &location)
+      : kind(kind), fodder(std::move(fodder)), data(std::move(data)),
+        stringBlockIndent(std::move(string_block_indent)),
+        stringBlockTermIndent(std::move(string_block_term_indent)), location(location)
     { }
 
     Token(Kind kind, const std::string &data="")
@@ -207,9 +212,9 @@ struct Token {
 /** The result of lexing.
  *
  * Because of the EOF token, this will always contain at least one token.  So element 0 can be used
- * to get the filename.
+ * to get the filename, and the last element holds the fodder at the end of the file.
  */
-typedef std::list<Token> Tokens;
+typedef std::vector<Token> Tokens;
 
 static inline bool operator==(const Token &a, const Token &b)
 {
@@ -236,7 +241,15 @@ static inline std::ostream &operator<<(std::ostream &o, const Token &v)
     return o;
 }
 
-Tokens jsonnet_lex(const std::string &filename, const char *input);
+/** Split the input into tokens.
+ *
+ * \param filename Used in the locations of the tokens.
+ * \param input The Jsonnet code, terminated by a '\0'.
+ * \param keep_fodder If false, comments and whitespace are skipped rather than stored in the
+ * tokens' fodder.  Only the formatter needs them, so they are dropped for evaluation.
+ * \throws StaticError for code that cannot be lexed.
+ */
+Tokens jsonnet_lex(const std::string &filename, const char *input, bool keep_fodder = true);
 
 std::string jsonnet_unlex(const Tokens &tokens);
 
@@ -0,0 +1,81 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/** Measures the throughput of jsonnet_lex over the given files, e.g.
+ *
+ *   ./lexer_benchmark $(find test_suite case_studies -name '*.jsonnet')
+ *
+ * Files that do not lex (some tests are meant to fail) are left out.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "lexer.h"
+
+int main(int argc, const char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <filename>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::pair<std::string, std::string>> files;
+    size_t bytes = 0;
+    for (int i = 1 ; i < argc ; ++i) {
+        std::ifstream f(argv[i]);
+        if (!f.good()) {
+            std::cerr << "Could not open " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::string content;
+        content.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+        try {
+            jsonnet_lex(argv[i], content.c_str());
+        } catch (const StaticError &) {
+            continue;
+        }
+        bytes += content.length();
+        files.emplace_back(argv[i], content);
+    }
+    if (files.empty()) {
+        std::cerr << "No files could be lexed." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Repeat for at least a second, to get a stable figure.
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    double seconds;
+    unsigned long iterations = 0;
+    size_t tokens = 0;
+    do {
+        for (const auto &file : files)
+            tokens += jsonnet_lex(file.first, file.second.c_str()).size();
+        iterations++;
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (seconds < 1);
+
+    std::cout << files.size() << " files, " << bytes << " bytes, "
+              << tokens / iterations << " tokens, " << iterations << " iterations in "
+              << seconds << "s: " << (bytes * iterations / seconds / 1e6) << " MB/s" << std::endl;
+    return EXIT_SUCCESS;
+}
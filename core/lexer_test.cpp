@@ -16,21 +16,20 @@ limitations under the License.
 
 #include "lexer.h"
 
-#include <list>
 #include "gtest/gtest.h"
 
 namespace {
 
 void testLex(const char* name,
              const char* input,
-             const std::list<Token>& tokens,
+             const Tokens& tokens,
              const std::string& error)
 {
-    std::list<Token> test_tokens(tokens);
+    Tokens test_tokens(tokens);
     test_tokens.push_back(Token(Token::Kind::END_OF_FILE, ""));
 
     try {
-        std::list<Token> lexed_tokens = jsonnet_lex(name, input);
+        Tokens lexed_tokens = jsonnet_lex(name, input);
         ASSERT_EQ(test_tokens, lexed_tokens)
             << "Test failed: " << name << std::endl;
     } catch (StaticError& e) {
@@ -294,4 +293,18 @@ TEST(Lexer, TestComments)
             "c comment no term:1:1: Multi-line comment has no terminating */.");
 }
 
+TEST(Lexer, TestNoFodder)
+{
+    const char *input = "# hi\nlocal /* x */ x = 1;\n\n// there\nx /* a\n b */\n";
+    Tokens with_fodder = jsonnet_lex("fodder", input);
+    Tokens without_fodder = jsonnet_lex("fodder", input, false);
+    ASSERT_EQ(with_fodder, without_fodder);
+    EXPECT_FALSE(with_fodder.back().fodder.empty());
+    for (size_t i = 0 ; i < without_fodder.size() ; ++i) {
+        EXPECT_TRUE(without_fodder[i].fodder.empty());
+        EXPECT_EQ(with_fodder[i].location.begin.line, without_fodder[i].location.begin.line);
+        EXPECT_EQ(with_fodder[i].location.end.column, without_fodder[i].location.end.column);
+    }
+}
+
 }  // namespace
@@ -17,13 +17,18 @@ limitations under the License.
 #include <cstdlib>
 #include <cstring>
 #include <cerrno>
+#include <ctime>
 
+#include <atomic>
 #include <exception>
-#include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
+#include <sys/stat.h>
+
 extern "C" {
 #include "libjsonnet.h"
 }
@@ -32,6 +37,7 @@ extern "C" {
 #include "formatter.h"
 #include "parser.h"
 #include "static_analysis.h"
+#include "string_utils.h"
 #include "vm.h"
 
 static void memory_panic(void)
@@ -47,8 +53,39 @@ static char *from_string(JsonnetVm* vm, const std::string &v)
     return r;
 }
 
+enum ImportStatus {
+    IMPORT_STATUS_OK,
+    IMPORT_STATUS_FILE_NOT_FOUND,
+    IMPORT_STATUS_IO_ERROR
+};
+
+/** The content of a file, shared by the session and the imports that lend it to the VM. */
+typedef std::shared_ptr<const std::string> FileContent;
+
+/** Load a whole file, see jsonnet_read_file.
+ *
+ * \param path The file to load.
+ * \param content Set to the content of the file if successful.
+ * \param err_msg Set to the reason, if the file could not be read.
+ * \returns IMPORT_STATUS_FILE_NOT_FOUND if the file could not be opened, with errno set.
+ */
+static ImportStatus load_file(const std::string &path, FileContent &content,
+                              std::string &err_msg)
+{
+    std::string *buf = new std::string;
+    FileContent owner(buf);
+    bool opened;
+    if (!jsonnet_read_file(path, *buf, opened)) {
+        if (!opened) return IMPORT_STATUS_FILE_NOT_FOUND;
+        err_msg = strerror(errno);
+        return IMPORT_STATUS_IO_ERROR;
+    }
+    content = owner;
+    return IMPORT_STATUS_OK;
+}
+
 static char *default_import_callback(void *ctx, const char *dir, const char *file,
-                                     char **found_here_cptr, int *success);
+                                     char **found_here_cptr, JsonnetImportBuffer *content);
 
 struct JsonnetVm {
     double gcGrowthTrigger;
@@ -56,32 +93,121 @@ struct JsonnetVm {
     unsigned gcMinObjects;
     unsigned maxTrace;
     std::map<std::string, VmExt> ext;
-    JsonnetImportCallback *importCallback;
+    VmNativeCallbackMap nativeCallbacks;
+    JsonnetImportBufferCallback *importCallback;
     void *importCallbackContext;
+    /** Set by jsonnet_import_callback, which is then called through legacy_import_callback. */
+    JsonnetImportCallback *legacyImportCallback;
+    void *legacyImportCallbackContext;
     bool stringOutput;
     std::vector<std::string> jpaths;
 
     FmtOpts fmtOpts;
     bool fmtDebugDesugaring;
 
+    /** Set by jsonnet_freeze, after which the VM is only read. */
+    bool frozen;
+
+    /** Non-null while state is kept between evaluations, see jsonnet_session.  Also non-null
+     * once frozen, but then only read (each evaluation uses a child session of its own).
+     */
+    std::unique_ptr<VmSession> session;
+
+    /** A file read by the default import callback during the session. */
+    struct SessionFile {
+        time_t mtime;
+        off_t size;
+        FileContent content;
+    };
+    std::map<std::string, SessionFile> sessionFiles;
+
+    /** Where ASTs are cached between processes, see jsonnet_ast_cache_dir.  Empty if not. */
+    std::string astCacheDir;
+
+    /** The mtime of a directory that imports were looked for in. */
+    struct ImportDir {
+        time_t mtime;
+        /** The value of importGeneration when mtime was read. */
+        unsigned long generation;
+    };
+
+    /** Incremented by each evaluation.  Directories are looked at again once per evaluation. */
+    std::atomic<unsigned long> importGeneration;
+
+    /** Guards importDirs and importMisses, as a frozen VM is used by many threads. */
+    std::mutex importMutex;
+    std::map<std::string, ImportDir> importDirs;
+
+    /** Paths that the default import callback did not find, with the mtime of their directory
+     * at the time.  A path is only looked for again once that mtime changes, so the misses in
+     * the importing directory and library search path are not repeated for each import.
+     */
+    std::map<std::string, time_t> importMisses;
+
+    /** Whether evaluations are profiled, see jsonnet_profile. */
+    bool profiling;
+
+    /** Whether evaluations are counted, see jsonnet_collect_stats. */
+    bool collectingStats;
+
+    /** The profile and counters of the evaluations so far, guarded by statsMutex. */
+    VmProfile profile;
+    VmStats stats;
+    std::mutex statsMutex;
+
+    /** Set by jsonnet_trace_callback.  The callback is nullptr if not tracing. */
+    VmTrace trace;
+
+    /** Counters for jsonnet_import_stats.  Atomic, as a frozen VM is used by many threads. */
+    std::atomic<unsigned long> importProbes;
+    std::atomic<unsigned long> importCacheHits;
+
     JsonnetVm(void)
       : gcGrowthTrigger(2.0), maxStack(500), gcMinObjects(1000), maxTrace(20),
-        importCallback(default_import_callback), importCallbackContext(this), stringOutput(false),
-        fmtDebugDesugaring(false)
+        importCallback(default_import_callback), importCallbackContext(this),
+        legacyImportCallback(nullptr), legacyImportCallbackContext(nullptr), stringOutput(false),
+        fmtDebugDesugaring(false), frozen(false), importGeneration(0), profiling(false),
+        collectingStats(false), trace{nullptr, nullptr}, importProbes(0), importCacheHits(0)
     {
         jpaths.emplace_back("/usr/share/" + std::string(jsonnet_version()) + "/");
         jpaths.emplace_back("/usr/local/share/" + std::string(jsonnet_version()) + "/");
     }
 };
 
-enum ImportStatus {
-    IMPORT_STATUS_OK,
-    IMPORT_STATUS_FILE_NOT_FOUND,
-    IMPORT_STATUS_IO_ERROR
-};
+static void check_not_frozen(JsonnetVm *vm, const char *func)
+{
+    if (vm->frozen) {
+        fprintf(stderr, "FATAL ERROR: %s called on a frozen JsonnetVm.\n", func);
+        abort();
+    }
+}
 
-static enum ImportStatus try_path(const std::string &dir, const std::string &rel,
-                                  std::string &content, std::string &found_here,
+/** Get the mtime of a directory, reading it at most once per evaluation.
+ *
+ * \returns false if the directory could not be stat'ed.
+ */
+static bool import_dir_mtime(JsonnetVm *vm, const std::string &dir, time_t &mtime)
+{
+    unsigned long generation = vm->importGeneration;
+    {
+        std::lock_guard<std::mutex> lock(vm->importMutex);
+        auto it = vm->importDirs.find(dir);
+        if (it != vm->importDirs.end() && it->second.generation == generation) {
+            mtime = it->second.mtime;
+            return true;
+        }
+    }
+    struct stat st;
+    if (::stat(dir.empty() ? "." : dir.c_str(), &st) != 0) return false;
+    mtime = st.st_mtime;
+    std::lock_guard<std::mutex> lock(vm->importMutex);
+    vm->importDirs[dir] = JsonnetVm::ImportDir{mtime, generation};
+    return true;
+}
+
+static enum ImportStatus try_path(JsonnetVm *vm,
+                                  const std::string &dir, const std::string &rel,
+                                  FileContent &content, std::string &found_here,
                                   std::string &err_msg)
 {
     std::string abs_path;
@@ -101,60 +227,122 @@ static enum ImportStatus try_path(const std::string &dir, const std::string &rel
         return IMPORT_STATUS_IO_ERROR;
     }
 
-    std::ifstream f;
-    f.open(abs_path.c_str());
-    if (!f.good()) return IMPORT_STATUS_FILE_NOT_FOUND;
-    try {
-        content.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
-    } catch (const std::ios_base::failure &io_err) {
-        err_msg = io_err.what();
-        return IMPORT_STATUS_IO_ERROR;
+    // The directory is stat'ed before the file is looked for, so that a file created after the
+    // look changes the directory's mtime from the one remembered with the miss.
+    std::string abs_dir = abs_path.substr(0, abs_path.rfind('/') + 1);
+    time_t dir_mtime = 0;
+    bool dir_known = import_dir_mtime(vm, abs_dir, dir_mtime);
+    if (dir_known) {
+        std::lock_guard<std::mutex> lock(vm->importMutex);
+        auto it = vm->importMisses.find(abs_path);
+        if (it != vm->importMisses.end()) {
+            if (it->second == dir_mtime) {
+                vm->importCacheHits++;
+                return IMPORT_STATUS_FILE_NOT_FOUND;
+            }
+            vm->importMisses.erase(it);
+        }
     }
-    if (!f.good()) {
-        err_msg = strerror(errno);
-        return IMPORT_STATUS_IO_ERROR;
+
+    vm->importProbes++;
+
+    struct stat st;
+    bool cacheable = vm->session != nullptr && ::stat(abs_path.c_str(), &st) == 0;
+    if (cacheable) {
+        auto it = vm->sessionFiles.find(abs_path);
+        if (it != vm->sessionFiles.end()
+            && it->second.mtime == st.st_mtime && it->second.size == st.st_size) {
+            content = it->second.content;
+            found_here = abs_path;
+            return IMPORT_STATUS_OK;
+        }
+    }
+
+    ImportStatus status = load_file(abs_path, content, err_msg);
+    if (status == IMPORT_STATUS_IO_ERROR && errno == EISDIR)
+        err_msg = "Attempted to import a directory";
+    // As with sessionFiles, an mtime in the last second could be that of a change yet to come.
+    if (status == IMPORT_STATUS_FILE_NOT_FOUND && errno == ENOENT && dir_known
+        && dir_mtime < std::time(nullptr) - 1) {
+        std::lock_guard<std::mutex> lock(vm->importMutex);
+        vm->importMisses[abs_path] = dir_mtime;
     }
+    if (status != IMPORT_STATUS_OK) return status;
 
     found_here = abs_path;
 
+    if (cacheable && !vm->frozen) {
+        // The file could change again without its mtime changing if that happens within the
+        // same second, so do not trust an mtime that is not yet safely in the past.
+        if (st.st_mtime < std::time(nullptr) - 1) {
+            vm->sessionFiles[abs_path] = JsonnetVm::SessionFile{st.st_mtime, st.st_size, content};
+        } else {
+            vm->sessionFiles.erase(abs_path);
+        }
+    }
+
     return IMPORT_STATUS_OK;
 }
 
+static void release_file_content(void *ctx)
+{
+    delete static_cast<FileContent*>(ctx);
+}
+
 static char *default_import_callback(void *ctx, const char *dir, const char *file,
-                                     char **found_here_cptr, int *success)
+                                     char **found_here_cptr, JsonnetImportBuffer *content)
 {
     auto *vm = static_cast<JsonnetVm*>(ctx);
 
-    std::string input, found_here, err_msg;
+    FileContent input;
+    std::string found_here, err_msg;
 
-    ImportStatus status = try_path(dir, file, input, found_here, err_msg);
+    ImportStatus status = try_path(vm, dir, file, input, found_here, err_msg);
 
     std::vector<std::string> jpaths(vm->jpaths);
 
     // If not found, try library search path.
     while (status == IMPORT_STATUS_FILE_NOT_FOUND) {
         if (jpaths.size() == 0) {
-            *success = 0;
             const char *err = "No match locally or in the Jsonnet library paths.";
             char *r = jsonnet_realloc(vm, nullptr, std::strlen(err) + 1);
             std::strcpy(r, err);
             return r;
         }
-        status = try_path(jpaths.back(), file, input, found_here, err_msg);
+        status = try_path(vm, jpaths.back(), file, input, found_here, err_msg);
         jpaths.pop_back();
     }
 
     if (status == IMPORT_STATUS_IO_ERROR) {
-        *success = 0;
         return from_string(vm, err_msg);
     } else {
         assert(status == IMPORT_STATUS_OK);
-        *success = 1;
         *found_here_cptr = from_string(vm, found_here);
-        return from_string(vm, input);
+        // The content is shared with vm->sessionFiles, so lend it rather than copy it.
+        content->data = input->data();
+        content->length = input->length();
+        content->release = release_file_content;
+        content->release_ctx = new FileContent(input);
+        return nullptr;
     }
 }
 
+/** Adapts a callback given to jsonnet_import_callback to JsonnetImportBufferCallback. */
+static char *legacy_import_callback(void *ctx, const char *dir, const char *file,
+                                    char **found_here_cptr, JsonnetImportBuffer *content)
+{
+    auto *vm = static_cast<JsonnetVm*>(ctx);
+    int success = 0;
+    char *r = vm->legacyImportCallback(vm->legacyImportCallbackContext, dir, file,
+                                       found_here_cptr, &success);
+    if (!success) return r;
+    content->data = r;
+    content->length = std::strlen(r);
+    content->release = ::free;
+    content->release_ctx = r;
+    return nullptr;
+}
+
 #define TRY try {
 #define CATCH(func) \
     } catch (const std::bad_alloc &) {\
@@ -187,57 +375,175 @@ void jsonnet_destroy(JsonnetVm *vm)
 
 void jsonnet_max_stack(JsonnetVm *vm, unsigned v)
 {
+    check_not_frozen(vm, "jsonnet_max_stack");
     vm->maxStack = v;
 }
 
 void jsonnet_gc_min_objects(JsonnetVm *vm, unsigned v)
 {
+    check_not_frozen(vm, "jsonnet_gc_min_objects");
     vm->gcMinObjects = v;
 }
 
 void jsonnet_gc_growth_trigger(JsonnetVm *vm, double v)
 {
+    check_not_frozen(vm, "jsonnet_gc_growth_trigger");
     vm->gcGrowthTrigger = v;
 }
 
 void jsonnet_string_output(struct JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_string_output");
     vm->stringOutput = bool(v);
 }
 
 void jsonnet_import_callback(struct JsonnetVm *vm, JsonnetImportCallback *cb, void *ctx)
 {
+    check_not_frozen(vm, "jsonnet_import_callback");
+    vm->importCallback = legacy_import_callback;
+    vm->importCallbackContext = vm;
+    vm->legacyImportCallback = cb;
+    vm->legacyImportCallbackContext = ctx;
+}
+
+void jsonnet_import_buffer_callback(struct JsonnetVm *vm, JsonnetImportBufferCallback *cb,
+                                    void *ctx)
+{
+    check_not_frozen(vm, "jsonnet_import_buffer_callback");
     vm->importCallback = cb;
     vm->importCallbackContext = ctx;
 }
 
 void jsonnet_ext_var(JsonnetVm *vm, const char *key, const char *val)
 {
+    check_not_frozen(vm, "jsonnet_ext_var");
     vm->ext[key] = VmExt(val, false);
 }
 
 void jsonnet_ext_code(JsonnetVm *vm, const char *key, const char *val)
 {
+    check_not_frozen(vm, "jsonnet_ext_code");
     vm->ext[key] = VmExt(val, true);
 }
 
+const char *jsonnet_json_extract_string(JsonnetVm *vm, const struct JsonnetJsonValue *v)
+{
+    (void) vm;
+    if (v->kind != JsonnetJsonValue::STRING)
+        return nullptr;
+    return v->string.c_str();
+}
+
+int jsonnet_json_extract_number(JsonnetVm *vm, const struct JsonnetJsonValue *v, double *out)
+{
+    (void) vm;
+    if (v->kind != JsonnetJsonValue::NUMBER)
+        return 0;
+    *out = v->number;
+    return 1;
+}
+
+int jsonnet_json_extract_bool(JsonnetVm *vm, const struct JsonnetJsonValue *v)
+{
+    (void) vm;
+    if (v->kind != JsonnetJsonValue::BOOL) return 2;
+    return v->number != 0;
+}
+
+int jsonnet_json_extract_null(JsonnetVm *vm, const struct JsonnetJsonValue *v)
+{
+    (void) vm;
+    return v->kind == JsonnetJsonValue::NULL_KIND;
+}
+
+JsonnetJsonValue *jsonnet_json_make_string(JsonnetVm *vm, const char *v)
+{
+    (void) vm;
+    return new JsonnetJsonValue(JsonnetJsonValue::STRING, v, 0);
+}
+
+JsonnetJsonValue *jsonnet_json_make_number(JsonnetVm *vm, double v)
+{
+    (void) vm;
+    return new JsonnetJsonValue(JsonnetJsonValue::NUMBER, "", v);
+}
+
+JsonnetJsonValue *jsonnet_json_make_bool(JsonnetVm *vm, int v)
+{
+    (void) vm;
+    return new JsonnetJsonValue(JsonnetJsonValue::BOOL, "", v != 0);
+}
+
+JsonnetJsonValue *jsonnet_json_make_null(JsonnetVm *vm)
+{
+    (void) vm;
+    return new JsonnetJsonValue(JsonnetJsonValue::NULL_KIND, "", 0);
+}
+
+JsonnetJsonValue *jsonnet_json_make_array(JsonnetVm *vm)
+{
+    (void) vm;
+    return new JsonnetJsonValue(JsonnetJsonValue::ARRAY, "", 0);
+}
+
+void jsonnet_json_array_append(JsonnetVm *vm, JsonnetJsonValue *arr, JsonnetJsonValue *v)
+{
+    (void) vm;
+    assert(arr->kind == JsonnetJsonValue::ARRAY);
+    arr->elements.emplace_back(v);
+}
+
+JsonnetJsonValue *jsonnet_json_make_object(JsonnetVm *vm)
+{
+    (void) vm;
+    return new JsonnetJsonValue(JsonnetJsonValue::OBJECT, "", 0);
+}
+
+void jsonnet_json_object_append(JsonnetVm *vm, JsonnetJsonValue *obj, const char *f,
+                                JsonnetJsonValue *v)
+{
+    (void) vm;
+    assert(obj->kind == JsonnetJsonValue::OBJECT);
+    obj->fields[f] = std::unique_ptr<JsonnetJsonValue>(v);
+}
+
+void jsonnet_json_destroy(JsonnetVm *vm, JsonnetJsonValue *v)
+{
+    (void) vm;
+    delete v;
+}
+
+void jsonnet_native_callback(JsonnetVm *vm, const char *name, JsonnetNativeCallback *cb,
+                             void *ctx, const char *const *params)
+{
+    check_not_frozen(vm, "jsonnet_native_callback");
+    std::vector<std::string> params2;
+    for (; *params != nullptr ; ++params)
+        params2.push_back(*params);
+    vm->nativeCallbacks[name] = VmNativeCallback{cb, ctx, params2};
+}
+
 void jsonnet_fmt_debug_desugaring(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_debug_desugaring");
     vm->fmtDebugDesugaring = v;
 }
 
 void jsonnet_fmt_indent(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_indent");
     vm->fmtOpts.indent = v;
 }
 
 void jsonnet_fmt_max_blank_lines(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_max_blank_lines");
     vm->fmtOpts.maxBlankLines = v;
 }
 
 void jsonnet_fmt_string(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_string");
     if (v != 'd' && v != 's' && v != 'l')
         v = 'l';
     vm->fmtOpts.stringStyle = v;
@@ -245,6 +551,7 @@ void jsonnet_fmt_string(JsonnetVm *vm, int v)
 
 void jsonnet_fmt_comment(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_comment");
     if (v != 'h' && v != 's' && v != 'l')
         v = 'l';
     vm->fmtOpts.commentStyle = v;
@@ -252,32 +559,116 @@ void jsonnet_fmt_comment(JsonnetVm *vm, int v)
 
 void jsonnet_fmt_pad_arrays(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_pad_arrays");
     vm->fmtOpts.padArrays = v;
 }
 
 void jsonnet_fmt_pad_objects(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_pad_objects");
     vm->fmtOpts.padObjects = v;
 }
 
 void jsonnet_fmt_pretty_field_names(JsonnetVm *vm, int v)
 {
+    check_not_frozen(vm, "jsonnet_fmt_pretty_field_names");
     vm->fmtOpts.prettyFieldNames = v;
 }
 
 void jsonnet_max_trace(JsonnetVm *vm, unsigned v)
 {
+    check_not_frozen(vm, "jsonnet_max_trace");
     vm->maxTrace = v;
 }
 
 void jsonnet_jpath_add(JsonnetVm *vm, const char *path_)
 {
+    check_not_frozen(vm, "jsonnet_jpath_add");
     if (std::strlen(path_) == 0) return;
     std::string path = path_;
     if (path[path.length() - 1] != '/') path += '/';
     vm->jpaths.emplace_back(path);
 }
 
+void jsonnet_freeze(JsonnetVm *vm)
+{
+    TRY
+    if (vm->session == nullptr)
+        vm->session.reset(new VmSession(nullptr, vm->astCacheDir));
+    vm->frozen = true;
+    CATCH("jsonnet_freeze")
+}
+
+void jsonnet_session(JsonnetVm *vm, int v)
+{
+    check_not_frozen(vm, "jsonnet_session");
+    TRY
+    if (!v) {
+        vm->session.reset();
+        vm->sessionFiles.clear();
+    } else if (vm->session == nullptr) {
+        vm->session.reset(new VmSession(nullptr, vm->astCacheDir));
+    }
+    CATCH("jsonnet_session")
+}
+
+void jsonnet_profile(JsonnetVm *vm, int v)
+{
+    check_not_frozen(vm, "jsonnet_profile");
+    TRY
+    if (v && !vm->profiling)
+        vm->profile = VmProfile();
+    vm->profiling = v;
+    CATCH("jsonnet_profile")
+}
+
+char *jsonnet_profile_report(JsonnetVm *vm, int folded)
+{
+    TRY
+    std::lock_guard<std::mutex> lock(vm->statsMutex);
+    return from_string(vm, folded ? vm->profile.foldedReport() : vm->profile.flatReport());
+    CATCH("jsonnet_profile_report")
+    return nullptr;  // Never happens.
+}
+
+void jsonnet_collect_stats(JsonnetVm *vm, int v)
+{
+    check_not_frozen(vm, "jsonnet_collect_stats");
+    vm->collectingStats = v;
+}
+
+char *jsonnet_stats(JsonnetVm *vm)
+{
+    TRY
+    std::lock_guard<std::mutex> lock(vm->statsMutex);
+    return from_string(vm, vm->stats.toJson());
+    CATCH("jsonnet_stats")
+    return nullptr;  // Never happens.
+}
+
+void jsonnet_import_stats(JsonnetVm *vm, unsigned long *probes, unsigned long *cache_hits)
+{
+    *probes = vm->importProbes;
+    *cache_hits = vm->importCacheHits;
+}
+
+void jsonnet_trace_callback(JsonnetVm *vm, JsonnetTraceCallback *cb, void *ctx)
+{
+    check_not_frozen(vm, "jsonnet_trace_callback");
+    vm->trace.callback = cb;
+    vm->trace.ctx = ctx;
+}
+
+void jsonnet_ast_cache_dir(JsonnetVm *vm, const char *dir_)
+{
+    check_not_frozen(vm, "jsonnet_ast_cache_dir");
+    std::string dir = dir_;
+    if (dir.length() > 0 && dir[dir.length() - 1] != '/') dir += '/';
+    vm->astCacheDir = dir;
+    if (vm->session != nullptr)
+        vm->session->astCacheDir = dir;
+}
+
 static char *jsonnet_fmt_snippet_aux(JsonnetVm *vm, const char *filename, const char *snippet,
                                      int *error)
 {
@@ -291,7 +682,7 @@ static char *jsonnet_fmt_snippet_aux(JsonnetVm *vm, const char *filename, const
         // std::cout << jsonnet_unlex(tokens);
 
         expr = jsonnet_parse(&alloc, tokens);
-        Fodder final_fodder = tokens.front().fodder;
+        Fodder final_fodder = tokens.back().fodder;
 
         if (vm->fmtDebugDesugaring)
             jsonnet_desugar(&alloc, expr);
@@ -315,19 +706,17 @@ static char *jsonnet_fmt_snippet_aux(JsonnetVm *vm, const char *filename, const
 char *jsonnet_fmt_file(JsonnetVm *vm, const char *filename, int *error)
 {
     TRY
-        std::ifstream f;
-        f.open(filename);
-        if (!f.good()) {
+        FileContent input;
+        std::string err_msg;
+        if (load_file(filename, input, err_msg) != IMPORT_STATUS_OK) {
             std::stringstream ss;
-            ss << "Opening input file: " << filename << ": " << strerror(errno);
+            ss << "Opening input file: " << filename << ": "
+               << (err_msg.empty() ? strerror(errno) : err_msg) << std::endl;
             *error = true;
             return from_string(vm, ss.str());
         }
-        std::string input;
-        input.assign(std::istreambuf_iterator<char>(f),
-                     std::istreambuf_iterator<char>());
 
-        return jsonnet_fmt_snippet_aux(vm, filename, input.c_str(), error);
+        return jsonnet_fmt_snippet_aux(vm, filename, input->c_str(), error);
     CATCH("jsonnet_fmt_file")
     return nullptr;  // Never happens.
 }
@@ -342,27 +731,85 @@ char *jsonnet_fmt_snippet(JsonnetVm *vm, const char *filename, const char *snipp
 
 
 namespace {
-enum EvalKind { REGULAR, MULTI, STREAM };
+enum EvalKind { REGULAR, MULTI, STREAM, VISIT };
+
+/** Passes the value to the callbacks of a JsonnetVisitor, encoded as UTF-8. */
+struct CVisitor : public VmVisitor {
+    const JsonnetVisitor *visitor;
+    void *ctx;
+    std::string utf8;
+    CVisitor(const JsonnetVisitor *visitor, void *ctx)
+      : visitor(visitor), ctx(ctx)
+    { }
+    void null(void) { visitor->null(ctx); }
+    void boolean(bool v) { visitor->boolean(ctx, v); }
+    void number(double v) { visitor->number(ctx, v); }
+    void string(const String &v)
+    {
+        utf8 = encode_utf8(v);
+        visitor->string(ctx, utf8.data(), utf8.length());
+    }
+    void beginArray(void) { visitor->begin_array(ctx); }
+    void endArray(void) { visitor->end_array(ctx); }
+    void beginObject(void) { visitor->begin_object(ctx); }
+    void field(const String &name)
+    {
+        utf8 = encode_utf8(name);
+        visitor->field(ctx, utf8.data(), utf8.length());
+    }
+    void endObject(void) { visitor->end_object(ctx); }
+};
 }  // namespace
 
+/** Evaluate the snippet as for the given kind of jsonnet_evaluate_* function.
+ *
+ * \param visitor For VISIT, the visitor to give the value to.  Otherwise nullptr.
+ * \returns As the jsonnet_evaluate_* function, except that VISIT returns nullptr on success.
+ */
 static char *jsonnet_evaluate_snippet_aux(JsonnetVm *vm, const char *filename,
-                                          const char *snippet, int *error, EvalKind kind)
+                                          const char *snippet, int *error, EvalKind kind,
+                                          CVisitor *visitor = nullptr)
 {
     try {
-        Allocator alloc;
-        AST *expr;
-        Tokens tokens = jsonnet_lex(filename, snippet);
-
-        expr = jsonnet_parse(&alloc, tokens);
-
-        jsonnet_desugar(&alloc, expr);
+        // Without a session, the state is thrown away after this evaluation.  The session of
+        // a frozen VM is shared by all threads, so it is only read.
+        std::unique_ptr<VmSession> temp_session;
+        VmSession *session = vm->session.get();
+        // Files may have been created or moved since the last evaluation.
+        vm->importGeneration++;
+        if (session == nullptr || vm->frozen) {
+            temp_session.reset(new VmSession(session, vm->astCacheDir));
+            session = temp_session.get();
+        }
+        const VmTrace *trace = vm->trace.callback == nullptr ? nullptr : &vm->trace;
+        Allocator alloc(&session->alloc);
+        AST *expr = session->parse(&alloc, filename, snippet, std::strlen(snippet), trace);
+
+        // Each evaluation is measured separately, so that threads need not share the results.
+        struct StatsMerger {
+            JsonnetVm *vm;
+            bool profiling;
+            bool collectingStats;
+            VmProfile profile;
+            VmStats stats;
+            ~StatsMerger(void)
+            {
+                if (!profiling && !collectingStats) return;
+                std::lock_guard<std::mutex> lock(vm->statsMutex);
+                if (profiling) vm->profile.merge(profile);
+                if (collectingStats) vm->stats.merge(stats);
+            }
+        } merger{vm, vm->profiling, vm->collectingStats, VmProfile(), VmStats()};
+        VmProfile *profile = merger.profiling ? &merger.profile : nullptr;
+        VmStats *stats = merger.collectingStats ? &merger.stats : nullptr;
 
-        jsonnet_static_analysis(expr);
         switch (kind) {
             case REGULAR: {
                 std::string json_str = jsonnet_vm_execute(
-                    &alloc, expr, vm->ext, vm->maxStack, vm->gcMinObjects, vm->gcGrowthTrigger,
-                    vm->importCallback, vm->importCallbackContext, vm->stringOutput);
+                    session, &alloc, expr, vm->ext, vm->nativeCallbacks, vm->maxStack,
+                    vm->gcMinObjects, vm->gcGrowthTrigger,
+                    vm->importCallback, vm->importCallbackContext, vm->stringOutput, profile, stats,
+                    trace);
                 json_str += "\n";
                 *error = false;
                 return from_string(vm, json_str);
@@ -371,8 +818,10 @@ static char *jsonnet_evaluate_snippet_aux(JsonnetVm *vm, const char *filename,
 
             case MULTI: {
                 std::map<std::string, std::string> files = jsonnet_vm_execute_multi(
-                    &alloc, expr, vm->ext, vm->maxStack, vm->gcMinObjects, vm->gcGrowthTrigger,
-                    vm->importCallback, vm->importCallbackContext, vm->stringOutput);
+                    session, &alloc, expr, vm->ext, vm->nativeCallbacks, vm->maxStack,
+                    vm->gcMinObjects, vm->gcGrowthTrigger,
+                    vm->importCallback, vm->importCallbackContext, vm->stringOutput, profile, stats,
+                    trace);
                 size_t sz = 1; // final sentinel
                 for (const auto &pair : files) {
                     sz += pair.first.length() + 1; // include sentinel
@@ -399,8 +848,9 @@ static char *jsonnet_evaluate_snippet_aux(JsonnetVm *vm, const char *filename,
 
             case STREAM: {
                 std::vector<std::string> documents = jsonnet_vm_execute_stream(
-                    &alloc, expr, vm->ext, vm->maxStack, vm->gcMinObjects, vm->gcGrowthTrigger,
-                    vm->importCallback, vm->importCallbackContext);
+                    session, &alloc, expr, vm->ext, vm->nativeCallbacks, vm->maxStack,
+                    vm->gcMinObjects, vm->gcGrowthTrigger,
+                    vm->importCallback, vm->importCallbackContext, profile, stats, trace);
                 size_t sz = 1; // final sentinel
                 for (const auto &doc : documents) {
                     sz += doc.length() + 2; // Add a '\n' as well as sentinel
@@ -422,6 +872,16 @@ static char *jsonnet_evaluate_snippet_aux(JsonnetVm *vm, const char *filename,
             }
             break;
 
+            case VISIT: {
+                jsonnet_vm_execute_visit(
+                    session, &alloc, expr, vm->ext, vm->nativeCallbacks, vm->maxStack,
+                    vm->gcMinObjects, vm->gcGrowthTrigger,
+                    vm->importCallback, vm->importCallbackContext, *visitor, profile, stats, trace);
+                *error = false;
+                return nullptr;
+            }
+            break;
+
             default:
             fputs("INTERNAL ERROR: bad value of 'kind', probably memory corruption.\n", stderr);
             abort();
@@ -454,21 +914,20 @@ static char *jsonnet_evaluate_snippet_aux(JsonnetVm *vm, const char *filename,
 
 }
 
-static char *jsonnet_evaluate_file_aux(JsonnetVm *vm, const char *filename, int *error, EvalKind kind)
+static char *jsonnet_evaluate_file_aux(JsonnetVm *vm, const char *filename, int *error, EvalKind kind,
+                                       CVisitor *visitor = nullptr)
 {
-    std::ifstream f;
-    f.open(filename);
-    if (!f.good()) {
+    FileContent input;
+    std::string err_msg;
+    if (load_file(filename, input, err_msg) != IMPORT_STATUS_OK) {
         std::stringstream ss;
-        ss << "Opening input file: " << filename << ": " << strerror(errno);
+        ss << "Opening input file: " << filename << ": "
+           << (err_msg.empty() ? strerror(errno) : err_msg) << std::endl;
         *error = true;
         return from_string(vm, ss.str());
     }
-    std::string input;
-    input.assign(std::istreambuf_iterator<char>(f),
-                 std::istreambuf_iterator<char>());
 
-    return jsonnet_evaluate_snippet_aux(vm, filename, input.c_str(), error, kind);
+    return jsonnet_evaluate_snippet_aux(vm, filename, input->c_str(), error, kind, visitor);
 }
 
 char *jsonnet_evaluate_file(JsonnetVm *vm, const char *filename, int *error)
@@ -521,6 +980,28 @@ char *jsonnet_evaluate_snippet_stream(JsonnetVm *vm, const char *filename,
     return nullptr;  // Never happens.
 }
 
+char *jsonnet_evaluate_file_visit(JsonnetVm *vm, const char *filename,
+                                  const JsonnetVisitor *visitor, void *ctx)
+{
+    TRY
+    int error;
+    CVisitor cvisitor(visitor, ctx);
+    return jsonnet_evaluate_file_aux(vm, filename, &error, VISIT, &cvisitor);
+    CATCH("jsonnet_evaluate_file_visit")
+    return nullptr;  // Never happens.
+}
+
+char *jsonnet_evaluate_snippet_visit(JsonnetVm *vm, const char *filename, const char *snippet,
+                                     const JsonnetVisitor *visitor, void *ctx)
+{
+    TRY
+    int error;
+    CVisitor cvisitor(visitor, ctx);
+    return jsonnet_evaluate_snippet_aux(vm, filename, snippet, &error, VISIT, &cvisitor);
+    CATCH("jsonnet_evaluate_snippet_visit")
+    return nullptr;  // Never happens.
+}
+
 char *jsonnet_realloc(JsonnetVm *vm, char *str, size_t sz)
 {
     (void) vm;
@@ -0,0 +1,92 @@
+/*
+Copyright 2015 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" {
+    #include "libjsonnet.h"
+}
+
+#include "gtest/gtest.h"
+
+static std::vector<std::string> test_suite_files(void)
+{
+    std::vector<std::string> r;
+    DIR *dir = opendir("test_suite");
+    if (dir == nullptr) return r;
+    while (struct dirent *entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        const std::string ext = ".jsonnet";
+        if (name.length() > ext.length()
+            && name.compare(name.length() - ext.length(), ext.length(), ext) == 0) {
+            r.push_back("test_suite/" + name);
+        }
+    }
+    closedir(dir);
+    std::sort(r.begin(), r.end());
+    return r;
+}
+
+static std::string evaluate(struct JsonnetVm *vm, const std::string &filename)
+{
+    int error = 0;
+    char *output = jsonnet_evaluate_file(vm, filename.c_str(), &error);
+    std::string r = (error ? "ERROR: " : "") + std::string(output);
+    jsonnet_realloc(vm, output, 0);
+    return r;
+}
+
+TEST(JsonnetStressTest, TestFrozenVmConcurrentTestSuite)
+{
+    const unsigned num_threads = 8;
+    std::vector<std::string> files = test_suite_files();
+    ASSERT_FALSE(files.empty());
+
+    // Same configuration as test_suite/run_tests.sh.
+    struct JsonnetVm *vm = jsonnet_make();
+    jsonnet_ext_var(vm, "var1", "test");
+    jsonnet_ext_code(vm, "var2", "{x:1,y:2}");
+    jsonnet_freeze(vm);
+
+    std::vector<std::string> expected;
+    for (const auto &f : files)
+        expected.push_back(evaluate(vm, f));
+
+    // Every thread runs the whole suite, each starting at a different file.
+    std::vector<std::vector<std::string>> mismatches(num_threads);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0 ; t < num_threads ; ++t) {
+        threads.emplace_back([&, t]() {
+            for (unsigned i = 0 ; i < files.size() ; ++i) {
+                unsigned j = (i + t * files.size() / num_threads) % files.size();
+                if (evaluate(vm, files[j]) != expected[j])
+                    mismatches[t].push_back(files[j]);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &m : mismatches)
+        EXPECT_EQ(std::vector<std::string>{}, m);
+    jsonnet_destroy(vm);
+}
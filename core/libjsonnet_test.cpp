@@ -14,6 +14,11 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
 extern "C" {
     #include "libjsonnet.h"
 }
@@ -31,3 +36,379 @@ TEST(JsonnetTest, TestEvaluateSnippet)
     jsonnet_realloc(vm, output, 0);
     jsonnet_destroy(vm);
 }
+
+struct TestImports {
+    struct JsonnetVm *vm;
+    const char *content;
+};
+
+static char *test_import_callback(void *ctx, const char *, const char *rel, char **found_here,
+                                  int *success)
+{
+    auto *imports = static_cast<TestImports*>(ctx);
+    *found_here = jsonnet_realloc(imports->vm, nullptr, std::strlen(rel) + 1);
+    std::strcpy(*found_here, rel);
+    char *r = jsonnet_realloc(imports->vm, nullptr, std::strlen(imports->content) + 1);
+    std::strcpy(r, imports->content);
+    *success = 1;
+    return r;
+}
+
+TEST(JsonnetTest, TestSession)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    TestImports imports = {vm, "{ x: 1 }"};
+    jsonnet_import_callback(vm, test_import_callback, &imports);
+    jsonnet_session(vm, 1);
+    const char* snippet = "(import 'lib.jsonnet').x + std.length(std.thisFile)";
+    int error = 0;
+    char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet, &error);
+    EXPECT_EQ(0, error);
+    EXPECT_STREQ("8\n", output);
+    jsonnet_realloc(vm, output, 0);
+
+    // Changed content must not be served from the session.
+    imports.content = "{ x: 2 }";
+    output = jsonnet_evaluate_snippet(vm, "snippet", snippet, &error);
+    EXPECT_EQ(0, error);
+    EXPECT_STREQ("9\n", output);
+    jsonnet_realloc(vm, output, 0);
+
+    jsonnet_session(vm, 0);
+    output = jsonnet_evaluate_snippet(vm, "snippet", snippet, &error);
+    EXPECT_EQ(0, error);
+    EXPECT_STREQ("9\n", output);
+    jsonnet_realloc(vm, output, 0);
+    jsonnet_destroy(vm);
+}
+
+struct TestBufferImports {
+    struct JsonnetVm *vm;
+    unsigned released;
+};
+
+static void test_release(void *ctx)
+{
+    static_cast<TestBufferImports*>(ctx)->released++;
+}
+
+static char *test_import_buffer_callback(void *ctx, const char *, const char *rel,
+                                         char **found_here, struct JsonnetImportBuffer *content)
+{
+    auto *imports = static_cast<TestBufferImports*>(ctx);
+    *found_here = jsonnet_realloc(imports->vm, nullptr, std::strlen(rel) + 1);
+    std::strcpy(*found_here, rel);
+    // The buffer need not be terminated.
+    static const char data[] = "{ x: 3 }garbage";
+    content->data = data;
+    content->length = 8;
+    content->release = test_release;
+    content->release_ctx = imports;
+    return nullptr;
+}
+
+TEST(JsonnetTest, TestImportBuffer)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    TestBufferImports imports = {vm, 0};
+    jsonnet_import_buffer_callback(vm, test_import_buffer_callback, &imports);
+    const char* snippet = "(import 'a').x + (import 'a').x + std.length(importstr 'b')";
+    int error = 0;
+    char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet, &error);
+    EXPECT_EQ(0, error);
+    EXPECT_STREQ("14\n", output);
+    EXPECT_EQ(2u, imports.released);
+    jsonnet_realloc(vm, output, 0);
+    jsonnet_destroy(vm);
+}
+
+TEST(JsonnetTest, TestImportBufferSession)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    TestBufferImports imports = {vm, 0};
+    jsonnet_import_buffer_callback(vm, test_import_buffer_callback, &imports);
+    jsonnet_session(vm, 1);
+    const char* snippet = "(import 'a').x";
+    for (unsigned i = 0 ; i < 2 ; ++i) {
+        // The session holds the buffer of 'a' that it parsed, and each later one is released.
+        int error = 0;
+        char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet, &error);
+        EXPECT_EQ(0, error);
+        EXPECT_STREQ("3\n", output);
+        EXPECT_EQ(i, imports.released);
+        jsonnet_realloc(vm, output, 0);
+    }
+    jsonnet_destroy(vm);
+    EXPECT_EQ(2u, imports.released);
+}
+
+TEST(JsonnetTest, TestSessionRewrite)
+{
+    char dir[] = "/tmp/jsonnet_session_rewrite_XXXXXX";
+    ASSERT_FALSE(mkdtemp(dir) == nullptr);
+    std::string lib = std::string(dir) + "/lib.jsonnet";
+    // A 1MB file, rewritten in place below with the same length, which the next evaluation of
+    // the session must see.  Its old mtime lets the default import callback keep it in between.
+    std::string content = "{ x: 1 }" + std::string(1 << 20, ' ');
+    std::FILE *f = std::fopen(lib.c_str(), "w");
+    ASSERT_FALSE(f == nullptr);
+    std::fwrite(content.data(), 1, content.length(), f);
+    std::fclose(f);
+    ASSERT_EQ(0, std::system(("touch -d 2000-01-01 " + lib).c_str()));
+    std::string snippet = "(import '" + lib + "').x";
+
+    struct JsonnetVm* vm = jsonnet_make();
+    jsonnet_session(vm, 1);
+    int error = 0;
+    char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet.c_str(), &error);
+    EXPECT_EQ(0, error);
+    EXPECT_STREQ("1\n", output);
+    jsonnet_realloc(vm, output, 0);
+
+    // Rewrite the file in place, with the same length.
+    f = std::fopen(lib.c_str(), "r+");
+    ASSERT_FALSE(f == nullptr);
+    std::fputs("{ x: 2 }", f);
+    std::fclose(f);
+    output = jsonnet_evaluate_snippet(vm, "snippet", snippet.c_str(), &error);
+    EXPECT_EQ(0, error);
+    EXPECT_STREQ("2\n", output);
+    jsonnet_realloc(vm, output, 0);
+    jsonnet_destroy(vm);
+    EXPECT_EQ(0, std::system(("rm -r " + std::string(dir)).c_str()));
+}
+
+static void test_trace_callback(void *ctx, JsonnetTracePhase phase, int begin, const char *detail,
+                                double)
+{
+    static const char *const NAMES[] = {"lex", "parse", "desugar", "analysis", "import",
+                                        "evaluate", "gc", "manifest"};
+    std::string &events = *static_cast<std::string*>(ctx);
+    if (phase == JSONNET_TRACE_GC) return;
+    events += std::string(begin ? "+" : "-") + NAMES[phase] + (begin ? detail : "") + " ";
+}
+
+TEST(JsonnetTest, TestAstCache)
+{
+    char dir[] = "/tmp/jsonnet_ast_cache_XXXXXX";
+    ASSERT_FALSE(mkdtemp(dir) == nullptr);
+    const char* snippet = "local f(x) = { a: x, b:: [x, 'y'] }; f(1) { c: super.b[1] }";
+    for (int i = 0 ; i < 2 ; ++i) {
+        // The first VM fills the cache, the second reads from it.
+        struct JsonnetVm* vm = jsonnet_make();
+        jsonnet_ast_cache_dir(vm, dir);
+        std::string events;
+        jsonnet_trace_callback(vm, test_trace_callback, &events);
+        int error = 0;
+        char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet, &error);
+        EXPECT_EQ(0, error);
+        EXPECT_STREQ("{\n   \"a\": 1,\n   \"c\": \"y\"\n}\n", output);
+        // A cache hit skips lexing and parsing.
+        EXPECT_EQ(i == 0, events.find("+lexsnippet") != std::string::npos);
+        EXPECT_EQ(i == 0, events.find("+parsesnippet") != std::string::npos);
+        jsonnet_realloc(vm, output, 0);
+        jsonnet_destroy(vm);
+    }
+    EXPECT_EQ(0, std::system(("rm -r " + std::string(dir)).c_str()));
+}
+
+TEST(JsonnetTest, TestImportStats)
+{
+    char dir[] = "/tmp/jsonnet_import_stats_XXXXXX";
+    ASSERT_FALSE(mkdtemp(dir) == nullptr);
+    std::string lib_dir = std::string(dir) + "/lib";
+    std::string empty_dir = std::string(dir) + "/empty";
+    std::string script = "mkdir " + lib_dir + " " + empty_dir + " " + dir + "/a " + dir + "/b"
+                       + " && echo '{ x: 1 }' > " + lib_dir + "/lib.jsonnet"
+                       + " && echo \"(import 'lib.jsonnet').x\" > " + dir + "/a/a.jsonnet"
+                       + " && echo \"(import 'lib.jsonnet').x\" > " + dir + "/b/b.jsonnet"
+                       // Misses are only remembered in directories that changed a while ago.
+                       + " && touch -d 2000-01-01 " + lib_dir + " " + empty_dir + " " + dir
+                       + "/a " + dir + "/b";
+    ASSERT_EQ(0, std::system(script.c_str()));
+    std::string snippet = std::string("(import '") + dir + "/a/a.jsonnet') + (import '" + dir
+                        + "/b/b.jsonnet')";
+
+    struct JsonnetVm* vm = jsonnet_make();
+    jsonnet_jpath_add(vm, lib_dir.c_str());
+    jsonnet_jpath_add(vm, empty_dir.c_str());
+    for (int i = 1 ; i <= 2 ; ++i) {
+        int error = 0;
+        char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet.c_str(), &error);
+        EXPECT_EQ(0, error);
+        EXPECT_STREQ("2\n", output);
+        jsonnet_realloc(vm, output, 0);
+
+        // a.jsonnet, then lib.jsonnet is missing from a/ and empty/ and found in lib/.  Then
+        // b.jsonnet, and lib.jsonnet is missing from b/, known to be missing from empty/ and
+        // found in lib/.  The next evaluation only looks for what was found.
+        unsigned long probes, cache_hits;
+        jsonnet_import_stats(vm, &probes, &cache_hits);
+        EXPECT_EQ(i == 1 ? 7u : 11u, probes);
+        EXPECT_EQ(i == 1 ? 1u : 5u, cache_hits);
+    }
+
+    // A new library in empty/ changes the directory, so it is found there from then on.
+    ASSERT_EQ(0, std::system(("echo '{ x: 2 }' > " + empty_dir + "/lib.jsonnet").c_str()));
+    int error = 0;
+    char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet.c_str(), &error);
+    EXPECT_EQ(0, error);
+    EXPECT_STREQ("4\n", output);
+    jsonnet_realloc(vm, output, 0);
+    jsonnet_destroy(vm);
+    EXPECT_EQ(0, std::system(("rm -r " + std::string(dir)).c_str()));
+}
+
+TEST(JsonnetTest, TestProfile)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    jsonnet_profile(vm, 1);
+    const char* snippet = "local fib(n) = if n < 2 then n else fib(n - 1) + fib(n - 2); fib(10)";
+    int error = 0;
+    char* output = jsonnet_evaluate_snippet(vm, "snippet", snippet, &error);
+    EXPECT_EQ(0, error);
+    jsonnet_realloc(vm, output, 0);
+
+    // fib(10) makes 177 calls, each forcing its parameter n.
+    char* report = jsonnet_profile_report(vm, 0);
+    std::string flat = report;
+    jsonnet_realloc(vm, report, 0);
+    size_t line = flat.find("thunk <n> snippet:1:19\n");
+    ASSERT_NE(std::string::npos, line);
+    line = flat.rfind('\n', line);
+    EXPECT_NE(std::string::npos, flat.substr(line, 40).find(" 177 "));
+
+    // The folded stacks nest the recursive calls.
+    report = jsonnet_profile_report(vm, 1);
+    std::string folded = report;
+    jsonnet_realloc(vm, report, 0);
+    EXPECT_EQ(0u, folded.find("<top level>"));
+    EXPECT_NE(std::string::npos, folded.find(
+        ";function <fib> snippet:1:62-68;function <fib> snippet:1:37-46;"));
+    jsonnet_destroy(vm);
+}
+
+TEST(JsonnetTest, TestStats)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    jsonnet_gc_min_objects(vm, 10);
+    jsonnet_collect_stats(vm, 1);
+    int error = 0;
+    for (int i = 0 ; i < 2 ; ++i) {
+        char* output = jsonnet_evaluate_snippet(vm, "snippet", "std.range(1, 100)", &error);
+        EXPECT_EQ(0, error);
+        jsonnet_realloc(vm, output, 0);
+    }
+    char* stats = jsonnet_stats(vm);
+    std::string json = stats;
+    jsonnet_realloc(vm, stats, 0);
+    EXPECT_NE(std::string::npos, json.find("\"evaluations\": 2,"));
+    EXPECT_NE(std::string::npos, json.find("\"thunk\": { \"allocations\": "));
+    EXPECT_EQ(std::string::npos, json.find("\"gc_cycles\": 0,"));
+    jsonnet_destroy(vm);
+}
+
+TEST(JsonnetTest, TestTrace)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    TestImports imports = {vm, "1 + 2"};
+    jsonnet_import_callback(vm, test_import_callback, &imports);
+    std::string events;
+    jsonnet_trace_callback(vm, test_trace_callback, &events);
+    int error = 0;
+    char* output = jsonnet_evaluate_snippet(vm, "snippet", "{ x: import 'lib' }", &error);
+    EXPECT_EQ(0, error);
+    jsonnet_realloc(vm, output, 0);
+    EXPECT_EQ("+lexsnippet -lex +parsesnippet -parse +desugarsnippet -desugar "
+              "+analysissnippet -analysis +evaluate -evaluate +manifest +importlib -import "
+              "+lexlib -lex +parselib -parse +desugarlib -desugar +analysislib -analysis "
+              "-manifest ", events);
+    jsonnet_destroy(vm);
+}
+
+static void test_visit_value(void *ctx, const std::string &value)
+{
+    *static_cast<std::string*>(ctx) += value + " ";
+}
+
+static const JsonnetVisitor test_visitor = {
+    [](void *ctx) { test_visit_value(ctx, "null"); },
+    [](void *ctx, int v) { test_visit_value(ctx, v ? "true" : "false"); },
+    [](void *ctx, double v) { test_visit_value(ctx, std::to_string(int(v))); },
+    [](void *ctx, const char *v, size_t length) {
+        test_visit_value(ctx, "'" + std::string(v, length) + "'");
+    },
+    [](void *ctx) { test_visit_value(ctx, "["); },
+    [](void *ctx) { test_visit_value(ctx, "]"); },
+    [](void *ctx) { test_visit_value(ctx, "{"); },
+    [](void *ctx, const char *name, size_t length) {
+        test_visit_value(ctx, std::string(name, length) + ":");
+    },
+    [](void *ctx) { test_visit_value(ctx, "}"); },
+};
+
+TEST(JsonnetTest, TestVisit)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    std::string values;
+    char* error = jsonnet_evaluate_snippet_visit(
+        vm, "snippet", "{ b: [1, null, true, 'x\\u0000y'], a:: 2, c: {} }", &test_visitor,
+        &values);
+    EXPECT_EQ(nullptr, error);
+    EXPECT_EQ("{ b: [ 1 null true 'x" + std::string(1, '\0') + "y' ] c: { } } ", values);
+
+    values.clear();
+    error = jsonnet_evaluate_snippet_visit(vm, "snippet", "[1, error 'e']", &test_visitor,
+                                           &values);
+    ASSERT_NE(nullptr, error);
+    EXPECT_EQ("RUNTIME ERROR: e", std::string(error).substr(0, 16));
+    jsonnet_realloc(vm, error, 0);
+    jsonnet_destroy(vm);
+}
+
+static JsonnetJsonValue *test_native_callback(void *ctx, const JsonnetJsonValue *const *argv,
+                                              int *success)
+{
+    auto *vm = static_cast<JsonnetVm*>(ctx);
+    double n;
+    if (!jsonnet_json_extract_number(vm, argv[1], &n)) {
+        *success = 0;
+        return jsonnet_json_make_string(vm, "n must be a number");
+    }
+    const char *s = jsonnet_json_extract_string(vm, argv[0]);
+    JsonnetJsonValue *r = jsonnet_json_make_object(vm);
+    jsonnet_json_object_append(vm, r, "s", jsonnet_json_make_string(vm, s == nullptr ? "" : s));
+    jsonnet_json_object_append(vm, r, "n", jsonnet_json_make_number(vm, n + 1));
+    jsonnet_json_object_append(vm, r, "isNull", jsonnet_json_make_bool(vm,
+        jsonnet_json_extract_null(vm, argv[0])));
+    *success = 1;
+    return r;
+}
+
+TEST(JsonnetTest, TestNativeCallback)
+{
+    struct JsonnetVm* vm = jsonnet_make();
+    const char *params[] = {"s", "n", nullptr};
+    jsonnet_native_callback(vm, "f", test_native_callback, vm, params);
+    int error = 0;
+    char* output = jsonnet_evaluate_snippet(
+        vm, "snippet", "local f = std.native('f'); [f('a', 1), f(null, 2).isNull, std.native('g')]",
+        &error);
+    EXPECT_EQ(0, error);
+    EXPECT_EQ(std::string("[\n   {\n      \"isNull\": false,\n      \"n\": 2,\n"
+                          "      \"s\": \"a\"\n   },\n   true,\n   null\n]\n"),
+              output);
+    jsonnet_realloc(vm, output, 0);
+
+    output = jsonnet_evaluate_snippet(vm, "snippet", "std.native('f')('a', 'b')", &error);
+    EXPECT_EQ(1, error);
+    EXPECT_EQ(std::string("RUNTIME ERROR: n must be a number\n"), std::string(output, 34));
+    jsonnet_realloc(vm, output, 0);
+
+    output = jsonnet_evaluate_snippet(vm, "snippet", "std.native('f')([], 1)", &error);
+    EXPECT_EQ(1, error);
+    EXPECT_NE(std::string::npos,
+              std::string(output).find("Native extensions can only take primitives"));
+    jsonnet_realloc(vm, output, 0);
+    jsonnet_destroy(vm);
+}
@@ -94,26 +94,34 @@ class Parser {
         return StaticError(tok.location, ss.str());
     }
 
-    Token pop(void)
+    const Token &pop(void)
     {
-        Token tok = peek();
-        tokens.pop_front();
+        if (!pushed.empty()) {
+            // Keep the token alive, the caller may still be holding a reference to it.
+            spent.splice(spent.end(), pushed, pushed.begin());
+            return spent.back();
+        }
+        const Token &tok = tokens[pos];
+        // The last token is always END_OF_FILE, it is never consumed.
+        if (pos + 1 < tokens.size())
+            pos++;
         return tok;
     }
 
-    void push(Token tok) {
-        tokens.push_front(tok);
+    void push(const Token &tok) {
+        pushed.push_front(tok);
     }
 
-    Token peek(void)
+    const Token &peek(void)
     {
-        Token tok = tokens.front();
-        return tok;
+        if (!pushed.empty())
+            return pushed.front();
+        return tokens[pos];
     }
 
-    Token popExpect(Token::Kind k, const char *data=nullptr)
+    const Token &popExpect(Token::Kind k, const char *data=nullptr)
     {
-        Token tok = pop();
+        const Token &tok = pop();
         if (tok.kind != k) {
             std::stringstream ss;
             ss << "Expected token " << k << " but got " << tok;
@@ -127,15 +135,31 @@ class Parser {
         return tok;
     }
 
-    std::list<Token> &tokens;
+    const Tokens &tokens;
+
+    /** The index of the next token in tokens. */
+    Tokens::size_type pos;
+
+    /** Tokens pushed back onto the front of the stream, these come before tokens[pos]. */
+    std::list<Token> pushed;
+
+    /** Pushed tokens that were popped again. */
+    std::list<Token> spent;
+
     Allocator *alloc;
 
     public:
 
-    Parser(Tokens &tokens, Allocator *alloc)
-      : tokens(tokens), alloc(alloc)
+    Parser(const Tokens &tokens, Allocator *alloc)
+      : tokens(tokens), pos(0), alloc(alloc)
     { }
 
+    /** The next token, which must be END_OF_FILE once parsing is done. */
+    const Token &remaining(void)
+    {
+        return peek();
+    }
+
     /** Parse a comma-separated list of expressions.
      *
      * Allows an optional ending comma.
@@ -144,7 +168,7 @@ class Parser {
      * \param element_kind Used in error messages when a comma was not found.
      * \returns The last token (the one that matched parameter end).
      */
-    Token parseCommaList(std::vector<std::pair<AST*, Fodder>> &exprs, Token::Kind end,
+    const Token &parseCommaList(std::vector<std::pair<AST*, Fodder>> &exprs, Token::Kind end,
                          const std::string &element_kind,
                          bool &got_comma)
     {
@@ -152,23 +176,23 @@ class Parser {
         bool first = true;
         do {
             Fodder comma_fodder;
-            Token next = peek();
+            const Token *next = &peek();
             if (!first && !got_comma) {
-                if (next.kind == Token::COMMA) {
-                    Token comma = pop();
+                if (next->kind == Token::COMMA) {
+                    const Token &comma = pop();
                     comma_fodder = comma.fodder;
-                    next = peek();
+                    next = &peek();
                     got_comma = true;
                 }
             }
-            if (next.kind == end) {
+            if (next->kind == end) {
                 // got_comma can be true or false here.
                 return pop();
             }
             if (!first && !got_comma) {
                 std::stringstream ss;
                 ss << "Expected a comma before next " << element_kind <<  ".";
-                throw StaticError(next.location, ss.str());
+                throw StaticError(next->location, ss.str());
             }
             exprs.emplace_back(parse(MAX_PRECEDENCE), comma_fodder);
             got_comma = false;
@@ -179,7 +203,7 @@ class Parser {
     Params parseParams(const std::string &element_kind, bool &got_comma, Fodder &close_fodder)
     {
         std::vector<std::pair<AST*, Fodder>> exprs;
-        Token paren_r = parseCommaList(exprs, Token::PAREN_R, element_kind, got_comma);
+        const Token &paren_r = parseCommaList(exprs, Token::PAREN_R, element_kind, got_comma);
 
         // Check they're all identifiers
         Params ret;
@@ -197,9 +221,9 @@ class Parser {
         return ret;
     }
 
-    Token parseBind(Local::Binds &binds)
+    const Token &parseBind(Local::Binds &binds)
     {
-        Token var_id = popExpect(Token::IDENTIFIER);
+        const Token &var_id = popExpect(Token::IDENTIFIER);
         auto *id = alloc->makeIdentifier(var_id.data32());
         for (const auto &bind : binds) {
             if (bind.var == id)
@@ -210,21 +234,21 @@ class Parser {
         bool trailing_comma = false;
         Fodder fodder_l, fodder_r;
         if (peek().kind == Token::PAREN_L) {
-            Token paren_l = pop();
+            const Token &paren_l = pop();
             fodder_l = paren_l.fodder;
             params = parseParams("function parameter", trailing_comma, fodder_r);
             is_function = true;
         }
-        Token eq = popExpect(Token::OPERATOR, "=");
+        const Token &eq = popExpect(Token::OPERATOR, "=");
         AST *body = parse(MAX_PRECEDENCE);
-        Token delim = pop();
+        const Token &delim = pop();
         binds.emplace_back(var_id.fodder, id, eq.fodder, body, is_function, fodder_l, params,
                            trailing_comma, fodder_r, delim.fodder);
         return delim;
     }
 
 
-    Token parseObjectRemainder(AST *&obj, const Token &tok)
+    const Token &parseObjectRemainder(AST *&obj, const Token &tok)
     {
         ObjectFields fields;
         std::set<std::string> literal_fields;  // For duplicate fields detection.
@@ -232,16 +256,16 @@ class Parser {
 
         bool got_comma = false;
         bool first = true;
-        Token next = pop();
+        const Token *next = &pop();
 
         do {
 
-            if (next.kind == Token::BRACE_R) {
+            if (next->kind == Token::BRACE_R) {
                 obj = alloc->make<Object>(
-                    span(tok, next), tok.fodder, fields, got_comma, next.fodder);
-                return next;
+                    span(tok, *next), tok.fodder, fields, got_comma, next->fodder);
+                return *next;
 
-            } else if (next.kind == Token::FOR) {
+            } else if (next->kind == Token::FOR) {
                 // It's a comprehension
                 unsigned num_fields = 0;
                 unsigned num_asserts = 0;
@@ -257,26 +281,26 @@ class Parser {
                 }
                 if (num_asserts > 0) {
                     auto msg = "Object comprehension cannot have asserts.";
-                    throw StaticError(next.location, msg);
+                    throw StaticError(next->location, msg);
                 }
                 if (num_fields != 1) {
                     auto msg = "Object comprehension can only have one field.";
-                    throw StaticError(next.location, msg);
+                    throw StaticError(next->location, msg);
                 }
                 const ObjectField &field = *field_ptr;
 
                 if (field.hide != ObjectField::INHERIT) {
                     auto msg = "Object comprehensions cannot have hidden fields.";
-                    throw StaticError(next.location, msg);
+                    throw StaticError(next->location, msg);
                 }
 
                 if (field.kind != ObjectField::FIELD_EXPR) {
                     auto msg = "Object comprehensions can only have [e] fields.";
-                    throw StaticError(next.location, msg);
+                    throw StaticError(next->location, msg);
                 }
 
                 std::vector<ComprehensionSpec> specs;
-                Token last = parseComprehensionSpecs(Token::BRACE_R, next.fodder, specs);
+                const Token &last = parseComprehensionSpecs(Token::BRACE_R, next->fodder, specs);
                 obj = alloc->make<ObjectComprehension>(
                     span(tok, last), tok.fodder, fields, got_comma, specs, last.fodder);
 
@@ -284,42 +308,42 @@ class Parser {
             }
 
             if (!got_comma && !first)
-                throw StaticError(next.location, "Expected a comma before next field.");
+                throw StaticError(next->location, "Expected a comma before next field.");
 
             first = false;
             got_comma = false;
 
-            switch (next.kind) {
+            switch (next->kind) {
                 case Token::BRACKET_L: case Token::IDENTIFIER: case Token::STRING_DOUBLE:
                 case Token::STRING_SINGLE: case Token::STRING_BLOCK: {
                     ObjectField::Kind kind;
                     AST *expr1 = nullptr;
                     const Identifier *id = nullptr;
                     Fodder fodder1, fodder2;
-                    if (next.kind == Token::IDENTIFIER) {
-                        fodder1 = next.fodder;
+                    if (next->kind == Token::IDENTIFIER) {
+                        fodder1 = next->fodder;
                         kind = ObjectField::FIELD_ID;
-                        id = alloc->makeIdentifier(next.data32());
-                    } else if (next.kind == Token::STRING_DOUBLE) {
+                        id = alloc->makeIdentifier(next->data32());
+                    } else if (next->kind == Token::STRING_DOUBLE) {
                         kind = ObjectField::FIELD_STR;
                         expr1 = alloc->make<LiteralString>(
-                            next.location, next.fodder, next.data32(), LiteralString::DOUBLE,
+                            next->location, next->fodder, next->data32(), LiteralString::DOUBLE,
                             "", "");
-                    } else if (next.kind == Token::STRING_SINGLE) {
+                    } else if (next->kind == Token::STRING_SINGLE) {
                         kind = ObjectField::FIELD_STR;
                         expr1 = alloc->make<LiteralString>(
-                            next.location, next.fodder, next.data32(), LiteralString::SINGLE,
+                            next->location, next->fodder, next->data32(), LiteralString::SINGLE,
                             "", "");
-                    } else if (next.kind == Token::STRING_BLOCK) {
+                    } else if (next->kind == Token::STRING_BLOCK) {
                         kind = ObjectField::FIELD_STR;
                         expr1 = alloc->make<LiteralString>(
-                            next.location, next.fodder, next.data32(), LiteralString::BLOCK,
-                            next.stringBlockIndent, next.stringBlockTermIndent);
+                            next->location, next->fodder, next->data32(), LiteralString::BLOCK,
+                            next->stringBlockIndent, next->stringBlockTermIndent);
                     } else {
                         kind = ObjectField::FIELD_EXPR;
-                        fodder1 = next.fodder;
+                        fodder1 = next->fodder;
                         expr1 = parse(MAX_PRECEDENCE);
-                        Token bracket_r = popExpect(Token::BRACKET_R);
+                        const Token &bracket_r = popExpect(Token::BRACKET_R);
                         fodder2 = bracket_r.fodder;
                     }
 
@@ -329,7 +353,7 @@ class Parser {
                     Fodder fodder_l;
                     Fodder fodder_r;
                     if (peek().kind == Token::PAREN_L) {
-                        Token paren_l = pop();
+                        const Token &paren_l = pop();
                         fodder_l = paren_l.fodder;
                         params = parseParams("method parameter", meth_comma, fodder_r);
                         is_method = true;
@@ -337,7 +361,7 @@ class Parser {
 
                     bool plus_sugar = false;
 
-                    Token op = popExpect(Token::OPERATOR);
+                    const Token &op = popExpect(Token::OPERATOR);
                     const char *od = op.data.c_str();
                     if (*od == '+') {
                         plus_sugar = true;
@@ -347,7 +371,7 @@ class Parser {
                     for (; *od != '\0' ; ++od) {
                         if (*od != ':') {
                             throw StaticError(
-                                next.location,
+                                next->location,
                                 "Expected one of :, ::, :::, +:, +::, +:::, got: " + op.data);
                         }
                         ++colons;
@@ -368,28 +392,28 @@ class Parser {
 
                         default:
                             throw StaticError(
-                                next.location,
+                                next->location,
                                 "Expected one of :, ::, :::, +:, +::, +:::, got: " + op.data);
                     }
 
                     // Basic checks for invalid Jsonnet code.
                     if (is_method && plus_sugar) {
                         throw StaticError(
-                            next.location, "Cannot use +: syntax sugar in a method: " + next.data);
+                            next->location, "Cannot use +: syntax sugar in a method: " + next->data);
                     }
                     if (kind != ObjectField::FIELD_EXPR) {
-                        if (!literal_fields.insert(next.data).second) {
-                            throw StaticError(next.location, "Duplicate field: "+next.data);
+                        if (!literal_fields.insert(next->data).second) {
+                            throw StaticError(next->location, "Duplicate field: "+next->data);
                         }
                     }
 
                     AST *body = parse(MAX_PRECEDENCE);
 
                     Fodder comma_fodder;
-                    next = pop();
-                    if (next.kind == Token::COMMA) {
-                        comma_fodder = next.fodder;
-                        next = pop();
+                    next = &pop();
+                    if (next->kind == Token::COMMA) {
+                        comma_fodder = next->fodder;
+                        next = &pop();
                         got_comma = true;
                     }
                     fields.emplace_back(
@@ -400,8 +424,8 @@ class Parser {
                 break;
 
                 case Token::LOCAL: {
-                    Fodder local_fodder = next.fodder;
-                    Token var_id = popExpect(Token::IDENTIFIER);
+                    Fodder local_fodder = next->fodder;
+                    const Token &var_id = popExpect(Token::IDENTIFIER);
                     auto *id = alloc->makeIdentifier(var_id.data32());
 
                     if (binds.find(id) != binds.end()) {
@@ -413,20 +437,20 @@ class Parser {
                     Fodder paren_l_fodder;
                     Fodder paren_r_fodder;
                     if (peek().kind == Token::PAREN_L) {
-                        Token paren_l = pop();
+                        const Token &paren_l = pop();
                         paren_l_fodder = paren_l.fodder;
                         is_method = true;
                         params = parseParams("function parameter", func_comma, paren_r_fodder);
                     }
-                    Token eq = popExpect(Token::OPERATOR, "=");
+                    const Token &eq = popExpect(Token::OPERATOR, "=");
                     AST *body = parse(MAX_PRECEDENCE);
                     binds.insert(id);
 
                     Fodder comma_fodder;
-                    next = pop();
-                    if (next.kind == Token::COMMA) {
-                        comma_fodder = next.fodder;
-                        next = pop();
+                    next = &pop();
+                    if (next->kind == Token::COMMA) {
+                        comma_fodder = next->fodder;
+                        next = &pop();
                         got_comma = true;
                     }
                     fields.push_back(
@@ -438,21 +462,21 @@ class Parser {
                 break;
 
                 case Token::ASSERT: {
-                    Fodder assert_fodder = next.fodder;
+                    Fodder assert_fodder = next->fodder;
                     AST *cond = parse(MAX_PRECEDENCE);
                     AST *msg = nullptr;
                     Fodder colon_fodder;
                     if (peek().kind == Token::OPERATOR && peek().data == ":") {
-                        Token colon = pop();
+                        const Token &colon = pop();
                         colon_fodder = colon.fodder;
                         msg = parse(MAX_PRECEDENCE);
                     }
 
                     Fodder comma_fodder;
-                    next = pop();
-                    if (next.kind == Token::COMMA) {
-                        comma_fodder = next.fodder;
-                        next = pop();
+                    next = &pop();
+                    if (next->kind == Token::COMMA) {
+                        comma_fodder = next->fodder;
+                        next = &pop();
                         got_comma = true;
                     }
                     fields.push_back(ObjectField::Assert(assert_fodder, cond, colon_fodder, msg,
@@ -461,7 +485,7 @@ class Parser {
                 break;
 
                 default:
-                throw unexpected(next, "parsing field definition");
+                throw unexpected(*next, "parsing field definition");
             }
 
 
@@ -469,39 +493,39 @@ class Parser {
     }
 
     /** parses for x in expr for y in expr if expr for z in expr ... */
-    Token parseComprehensionSpecs(Token::Kind end, Fodder for_fodder,
+    const Token &parseComprehensionSpecs(Token::Kind end, Fodder for_fodder,
                                   std::vector<ComprehensionSpec> &specs)
     {
         while (true) {
             LocationRange l;
-            Token id_token = popExpect(Token::IDENTIFIER);
+            const Token &id_token = popExpect(Token::IDENTIFIER);
             const Identifier *id = alloc->makeIdentifier(id_token.data32());
-            Token in_token = popExpect(Token::IN);
+            const Token &in_token = popExpect(Token::IN);
             AST *arr = parse(MAX_PRECEDENCE);
             specs.emplace_back(ComprehensionSpec::FOR, for_fodder, id_token.fodder, id,
                                in_token.fodder, arr);
 
-            Token maybe_if = pop();
-            for (; maybe_if.kind == Token::IF; maybe_if = pop()) {
+            const Token *maybe_if = &pop();
+            for (; maybe_if->kind == Token::IF; maybe_if = &pop()) {
                 AST *cond = parse(MAX_PRECEDENCE);
-                specs.emplace_back(ComprehensionSpec::IF, maybe_if.fodder, Fodder{}, nullptr,
+                specs.emplace_back(ComprehensionSpec::IF, maybe_if->fodder, Fodder{}, nullptr,
                                    Fodder{}, cond);
             }
-            if (maybe_if.kind == end) {
-                return maybe_if;
+            if (maybe_if->kind == end) {
+                return *maybe_if;
             }
-            if (maybe_if.kind != Token::FOR) {
+            if (maybe_if->kind != Token::FOR) {
                 std::stringstream ss;
-                ss << "Expected for, if or " << end << " after for clause, got: " << maybe_if;
-                throw StaticError(maybe_if.location, ss.str());
+                ss << "Expected for, if or " << end << " after for clause, got: " << *maybe_if;
+                throw StaticError(maybe_if->location, ss.str());
             }
-            for_fodder = maybe_if.fodder;
+            for_fodder = maybe_if->fodder;
         }
     }
 
     AST *parseTerminal(void)
     {
-        Token tok = pop();
+        const Token &tok = pop();
         switch (tok.kind) {
             case Token::ASSERT:
             case Token::BRACE_R:
@@ -534,28 +558,28 @@ class Parser {
             }
 
             case Token::BRACKET_L: {
-                Token next = peek();
-                if (next.kind == Token::BRACKET_R) {
-                    Token bracket_r = pop();
-                    return alloc->make<Array>(span(tok, next), tok.fodder, Array::Elements{},
+                const Token *next = &peek();
+                if (next->kind == Token::BRACKET_R) {
+                    const Token &bracket_r = pop();
+                    return alloc->make<Array>(span(tok, *next), tok.fodder, Array::Elements{},
                                               false, bracket_r.fodder);
                 }
                 AST *first = parse(MAX_PRECEDENCE);
                 bool got_comma = false;
                 Fodder comma_fodder;
-                next = peek();
-                if (!got_comma && next.kind == Token::COMMA) {
-                    Token comma = pop();
+                next = &peek();
+                if (!got_comma && next->kind == Token::COMMA) {
+                    const Token &comma = pop();
                     comma_fodder = comma.fodder;
-                    next = peek();
+                    next = &peek();
                     got_comma = true;
                 }
 
-                if (next.kind == Token::FOR) {
+                if (next->kind == Token::FOR) {
                     // It's a comprehension
-                    Token for_token = pop();
+                    const Token &for_token = pop();
                     std::vector<ComprehensionSpec> specs;
-                    Token last = parseComprehensionSpecs(Token::BRACKET_R, for_token.fodder, specs);
+                    const Token &last = parseComprehensionSpecs(Token::BRACKET_R, for_token.fodder, specs);
                     return alloc->make<ArrayComprehension>(
                         span(tok, last), tok.fodder, first, comma_fodder, got_comma, specs,
                         last.fodder);
@@ -565,24 +589,24 @@ class Parser {
                 Array::Elements elements;
                 elements.emplace_back(first, comma_fodder);
                 do {
-                    if (next.kind == Token::BRACKET_R) {
-                        Token bracket_r = pop();
+                    if (next->kind == Token::BRACKET_R) {
+                        const Token &bracket_r = pop();
                         return alloc->make<Array>(
-                            span(tok, next), tok.fodder, elements, got_comma, bracket_r.fodder);
+                            span(tok, *next), tok.fodder, elements, got_comma, bracket_r.fodder);
                     }
                     if (!got_comma) {
                         std::stringstream ss;
                         ss << "Expected a comma before next array element.";
-                        throw StaticError(next.location, ss.str());
+                        throw StaticError(next->location, ss.str());
                     }
                     AST *expr = parse(MAX_PRECEDENCE);
                     comma_fodder.clear();
                     got_comma = false;
-                    next = peek();
-                    if (next.kind == Token::COMMA) {
-                        Token comma = pop();
+                    next = &peek();
+                    if (next->kind == Token::COMMA) {
+                        const Token &comma = pop();
                         comma_fodder = comma.fodder;
-                        next = peek();
+                        next = &peek();
                         got_comma = true;
                     }
                     elements.emplace_back(expr, comma_fodder);
@@ -591,7 +615,7 @@ class Parser {
 
             case Token::PAREN_L: {
                 auto *inner = parse(MAX_PRECEDENCE);
-                Token close = popExpect(Token::PAREN_R);
+                const Token &close = popExpect(Token::PAREN_R);
                 return alloc->make<Parens>(span(tok, close), tok.fodder, inner, close.fodder);
             }
 
@@ -630,19 +654,19 @@ class Parser {
             return alloc->make<Self>(span(tok), tok.fodder);
 
             case Token::SUPER: {
-                Token next = pop();
+                const Token &next = pop();
                 AST *index = nullptr;
                 const Identifier *id = nullptr;
                 Fodder id_fodder;
                 switch (next.kind) {
                     case Token::DOT: {
-                        Token field_id = popExpect(Token::IDENTIFIER);
+                        const Token &field_id = popExpect(Token::IDENTIFIER);
                         id_fodder = field_id.fodder;
                         id = alloc->makeIdentifier(field_id.data32());
                     } break;
                     case Token::BRACKET_L: {
                         index = parse(MAX_PRECEDENCE);
-                        Token bracket_r = popExpect(Token::BRACKET_R);
+                        const Token &bracket_r = popExpect(Token::BRACKET_R);
                         id_fodder = bracket_r.fodder;  // Not id_fodder, but use the same var.
                     } break;
                     default:
@@ -660,7 +684,7 @@ class Parser {
 
     AST *parse(int precedence)
     {
-        Token begin = peek();
+        const Token &begin = peek();
 
         switch (begin.kind) {
 
@@ -672,11 +696,11 @@ class Parser {
                 Fodder colonFodder;
                 AST *msg = nullptr;
                 if (peek().kind == Token::OPERATOR && peek().data == ":") {
-                    Token colon = pop();
+                    const Token &colon = pop();
                     colonFodder = colon.fodder;
                     msg = parse(MAX_PRECEDENCE);
                 }
-                Token semicolon = popExpect(Token::SEMICOLON);
+                const Token &semicolon = popExpect(Token::SEMICOLON);
                 AST *rest = parse(MAX_PRECEDENCE);
                 return alloc->make<Assert>(span(begin, rest), begin.fodder, cond, colonFodder,
                                            msg, semicolon.fodder, rest);
@@ -691,10 +715,10 @@ class Parser {
             case Token::IF: {
                 pop();
                 AST *cond = parse(MAX_PRECEDENCE);
-                Token then = popExpect(Token::THEN);
+                const Token &then = popExpect(Token::THEN);
                 AST *branch_true = parse(MAX_PRECEDENCE);
                 if (peek().kind == Token::ELSE) {
-                    Token else_ = pop();
+                    const Token &else_ = pop();
                     AST *branch_false = parse(MAX_PRECEDENCE);
                     return alloc->make<Conditional>(
                         span(begin, branch_false), begin.fodder, cond, then.fodder, branch_true,
@@ -706,7 +730,7 @@ class Parser {
 
             case Token::FUNCTION: {
                 pop();  // Still available in 'begin'.
-                Token paren_l = pop();
+                const Token &paren_l = pop();
                 if (paren_l.kind == Token::PAREN_L) {
                     std::vector<AST*> params_asts;
                     bool got_comma;
@@ -760,7 +784,7 @@ class Parser {
                 pop();
                 Local::Binds binds;
                 do {
-                    Token delim = parseBind(binds);
+                    const Token &delim = parseBind(binds);
                     if (delim.kind != Token::SEMICOLON && delim.kind != Token::COMMA) {
                         std::stringstream ss;
                         ss << "Expected , or ; but got " << delim;
@@ -783,7 +807,7 @@ class Parser {
                     throw StaticError(begin.location, ss.str());
                 }
                 if (UNARY_PRECEDENCE == precedence) {
-                    Token op = pop();
+                    const Token &op = pop();
                     AST *expr = parse(precedence);
                     return alloc->make<Unary>(span(op, expr), op.fodder, uop, expr);
                 }
@@ -822,7 +846,7 @@ class Parser {
                         ss << "Not a binary operator: " << peek().data;
                         throw StaticError(peek().location, ss.str());
                     }
-                    if (precedence_map[bop] != precedence) return lhs;
+                    if (precedence_map.at(bop) != precedence) return lhs;
                     break;
 
                     // Index, Apply
@@ -835,7 +859,7 @@ class Parser {
                     return lhs;
                 }
 
-                Token op = pop();
+                const Token &op = pop();
                 if (op.kind == Token::BRACKET_L) {
                     bool is_slice;
                     AST *first = nullptr;
@@ -849,14 +873,14 @@ class Parser {
 
                     // break up "::" into ":", ":" before we start parsing.
                     if (peek().kind == Token::OPERATOR && peek().data == "::") {
-                        Token joined = pop();
+                        const Token &joined = pop();
                         push(Token(Token::OPERATOR, joined.fodder, ":", "", "", joined.location));
                         push(Token(Token::OPERATOR, Fodder{}, ":", "", "", joined.location));
                     }
 
-                    Token first_token = pop();
+                    const Token &first_token = pop();
                     if (peek().kind == Token::OPERATOR && peek().data == "::") {
-                        Token joined = pop();
+                        const Token &joined = pop();
                         push(Token(Token::OPERATOR, joined.fodder, ":", "", "", joined.location));
                         push(Token(Token::OPERATOR, Fodder{}, ":", "", "", joined.location));
                     }
@@ -867,7 +891,7 @@ class Parser {
 
                     if (peek().kind != Token::BRACKET_R) {
                         is_slice = true;
-                        Token delim = pop();
+                        const Token &delim = pop();
                         if (delim.data != ":")
                             throw unexpected(delim, "parsing slice");
 
@@ -877,7 +901,7 @@ class Parser {
                             second = parse(MAX_PRECEDENCE);
 
                         if (peek().kind != Token::BRACKET_R) {
-                            Token delim = pop();
+                            const Token &delim = pop();
                             if (delim.data != ":")
                                 throw unexpected(delim, "parsing slice");
 
@@ -889,13 +913,13 @@ class Parser {
                     } else {
                         is_slice = false;
                     }
-                    Token end = popExpect(Token::BRACKET_R);
+                    const Token &end = popExpect(Token::BRACKET_R);
                     lhs = alloc->make<Index>(span(begin, end), begin_fodder, lhs, op.fodder,
                                              is_slice, first, second_fodder, second,
                                              third_fodder, third, end.fodder);
 
                 } else if (op.kind == Token::DOT) {
-                    Token field_id = popExpect(Token::IDENTIFIER);
+                    const Token &field_id = popExpect(Token::IDENTIFIER);
                     const Identifier *id = alloc->makeIdentifier(field_id.data32());
                     lhs = alloc->make<Index>(span(begin, field_id), begin_fodder, lhs,
                                              op.fodder, field_id.fodder, id);
@@ -903,12 +927,12 @@ class Parser {
                 } else if (op.kind == Token::PAREN_L) {
                     std::vector<std::pair<AST*, Fodder>> args;
                     bool got_comma;
-                    Token end = parseCommaList(args, Token::PAREN_R,
+                    const Token &end = parseCommaList(args, Token::PAREN_R,
                                                "function argument", got_comma);
                     bool tailstrict = false;
                     Fodder tailstrict_fodder;
                     if (peek().kind == Token::TAILSTRICT) {
-                        Token tailstrict_token = pop();
+                        const Token &tailstrict_token = pop();
                         tailstrict_fodder = tailstrict_token.fodder;
                         tailstrict = true;
                     }
@@ -920,7 +944,7 @@ class Parser {
 
                 } else if (op.kind == Token::BRACE_L) {
                     AST *obj;
-                    Token end = parseObjectRemainder(obj, op);
+                    const Token &end = parseObjectRemainder(obj, op);
                     lhs = alloc->make<ApplyBrace>(span(begin, end), begin_fodder, lhs, obj);
 
                 } else {
@@ -940,14 +964,15 @@ class Parser {
 
 }  // namespace
 
-AST *jsonnet_parse(Allocator *alloc, Tokens &tokens)
+AST *jsonnet_parse(Allocator *alloc, const Tokens &tokens)
 {
     Parser parser(tokens, alloc);
     AST *expr = parser.parse(MAX_PRECEDENCE);
-    if (tokens.front().kind != Token::END_OF_FILE) {
+    const Token &remaining = parser.remaining();
+    if (remaining.kind != Token::END_OF_FILE) {
         std::stringstream ss;
-        ss << "Did not expect: " << tokens.front();
-        throw StaticError(tokens.front().location, ss.str());
+        ss << "Did not expect: " << remaining;
+        throw StaticError(remaining.location, ss.str());
     }
 
     return expr;
@@ -27,10 +27,10 @@ limitations under the License.
  *
  * \param alloc Used to allocate the AST nodes.  The Allocator must outlive the
  * AST pointer returned.
- * \param tokens The list of tokens (all tokens are popped except EOF).
+ * \param tokens The tokens, which are not modified.  The last one is EOF.
  * \returns The parsed abstract syntax tree.
  */
-AST *jsonnet_parse(Allocator *alloc, Tokens &tokens);
+AST *jsonnet_parse(Allocator *alloc, const Tokens &tokens);
 
 /** Outputs a number, trying to preserve precision as well as possible.
  */
@@ -44,6 +44,12 @@ struct BuiltinDecl {
 /** Returns the signature of each built-in function. */
 BuiltinDecl jsonnet_builtin_decl(unsigned long builtin);
 
+/** The number of the last built-in function, they are numbered from 0. */
+static const unsigned long BUILTIN_MAX = 38;
+
+/** The number of std.mergePatch, which the interpreter also calls itself. */
+static const unsigned long BUILTIN_MERGE_PATCH = 33;
+
 /** The inverse of jsonnet_parse.
  */
 std::string jsonnet_unparse_jsonnet(const AST *ast, const Fodder &final_fodder, unsigned indent,
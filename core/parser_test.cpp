@@ -16,7 +16,6 @@ limitations under the License.
 
 #include "parser.h"
 
-#include <list>
 #include "ast.h"
 #include "lexer.h"
 #include "gtest/gtest.h"
@@ -28,7 +27,7 @@ namespace {
 void testParse(const char* snippet)
 {
     try {
-        std::list<Token> tokens = jsonnet_lex("test", snippet);
+        Tokens tokens = jsonnet_lex("test", snippet);
         Allocator allocator;
         AST* ast = jsonnet_parse(&allocator, tokens);
         (void)ast;
@@ -127,7 +126,7 @@ TEST(Parser, TestTuple)
 void testParseError(const char* snippet, const std::string& expectedError)
 {
     try {
-        std::list<Token> tokens = jsonnet_lex("test", snippet);
+        Tokens tokens = jsonnet_lex("test", snippet);
         Allocator allocator;
         AST* ast = jsonnet_parse(&allocator, tokens);
         (void)ast;
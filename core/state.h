@@ -23,10 +23,24 @@ namespace {
  */
 typedef unsigned char GarbageCollectionMark;
 
+/** The kinds of heap entity, for statistics. */
+enum HeapEntityKind {
+    HEAP_THUNK,
+    HEAP_ARRAY,
+    HEAP_SIMPLE_OBJECT,
+    HEAP_EXTENDED_OBJECT,
+    HEAP_COMPREHENSION_OBJECT,
+    HEAP_CLOSURE,
+    HEAP_STRING,
+    HEAP_NUM_KINDS
+};
+
 /** Supertype of everything that is allocated on the heap.
  */
 struct HeapEntity {
     GarbageCollectionMark mark;
+    /** Set by Heap::makeEntity. */
+    HeapEntityKind kind;
     virtual ~HeapEntity() { }
 };
 
@@ -81,6 +95,12 @@ std::string type_str(const Value &v)
     return type_str(v.t);
 }
 
+/** The name of the value's type as returned by std.type, for errors of std functions. */
+std::string std_type_str(const Value &v)
+{
+    return v.t == Value::DOUBLE ? "number" : type_str(v.t);
+}
+
 struct HeapThunk;
 
 /** Stores the values bound to variables.
@@ -134,14 +154,138 @@ struct HeapThunk : public HeapEntity {
     }
 };
 
+/** The elements of a HeapArray.
+ *
+ * So that a + b and slicing do not copy their operands, the elements are a view of part of a
+ * buffer that can be shared with other arrays.  The elements seen by a view never change: the
+ * buffer is only appended to by a view that ends where the buffer ends, and other views ending
+ * there keep their length, so do not see the new elements.  Any other view copies its
+ * elements into a new buffer before appending.
+ */
+class HeapArrayElements {
+    /** The thunks, and how many of them were already counted by takeUncountedBytes. */
+    struct Buffer : public std::vector<HeapThunk*> {
+        size_t counted;
+        Buffer(void) : counted(0) { }
+        Buffer(const std::vector<HeapThunk*> &elements)
+          : std::vector<HeapThunk*>(elements), counted(0)
+        { }
+    };
+    std::shared_ptr<Buffer> buffer;
+    size_t offset;
+    size_t length;
+
+    bool atEndOfBuffer(void) const
+    {
+        return offset + length == buffer->size();
+    }
+
+    /** Copy the viewed elements into a buffer of their own, with room for n more. */
+    void unshare(size_t n)
+    {
+        auto copy = std::make_shared<Buffer>();
+        copy->reserve(length + n);
+        copy->assign(begin(), end());
+        buffer = copy;
+        offset = 0;
+    }
+
+    public:
+    HeapArrayElements(void)
+      : buffer(std::make_shared<Buffer>()), offset(0), length(0)
+    { }
+
+    HeapArrayElements(const std::vector<HeapThunk*> &elements)
+      : buffer(std::make_shared<Buffer>(elements)), offset(0),
+        length(elements.size())
+    { }
+
+    size_t size(void) const { return length; }
+    HeapThunk *operator[](size_t i) const { return (*buffer)[offset + i]; }
+    HeapThunk * const *begin(void) const { return buffer->data() + offset; }
+    HeapThunk * const *end(void) const { return begin() + length; }
+
+    void reserve(size_t n)
+    {
+        if (n <= length) return;
+        if (atEndOfBuffer())
+            buffer->reserve(offset + n);
+        else
+            unshare(n - length);
+    }
+
+    void push_back(HeapThunk *th)
+    {
+        if (!atEndOfBuffer()) unshare(1);
+        buffer->push_back(th);
+        length++;
+    }
+
+    /** The elements of this followed by those of other.
+     *
+     * When this view ends where its buffer does, other is appended to the same buffer, so
+     * building an array by repeatedly appending to it takes amortized O(1) per element.
+     */
+    HeapArrayElements concat(const HeapArrayElements &other) const
+    {
+        HeapArrayElements r = *this;
+        if (!r.atEndOfBuffer()) r.unshare(other.length);
+        // Other can view the same buffer, so index it rather than holding pointers into it.
+        for (size_t i = 0 ; i < other.length ; ++i)
+            r.push_back(other[i]);
+        return r;
+    }
+
+    /** The memory of the buffer's elements that no view of it has returned here before.
+     *
+     * As the buffer is shared, this is how its elements are counted once however many arrays
+     * view them, including those appended after the arrays were created.
+     */
+    size_t takeUncountedBytes(void)
+    {
+        size_t n = buffer->size() - buffer->counted;
+        buffer->counted = buffer->size();
+        return n * sizeof(HeapThunk*);
+    }
+
+    /** The len elements starting at index from, without copying them. */
+    HeapArrayElements slice(size_t from, size_t len) const
+    {
+        HeapArrayElements r = *this;
+        r.offset += from;
+        r.length = len;
+        return r;
+    }
+};
+
 struct HeapArray : public HeapEntity {
     // It is convenient for this to not be const, so that we can add elements to it one at a
     // time after creation.  Thus, elements are not GCed as the array is being
     // created.
-    std::vector<HeapThunk*> elements;
-    HeapArray(const std::vector<HeapThunk*> &elements)
-      : elements(elements)
+    HeapArrayElements elements;
+
+    /** Whether the array is the rangeLength numbers rangeFrom, rangeFrom + 1, ...
+     *
+     * Such arrays, e.g. from std.range, do not hold a thunk per element: elements is empty,
+     * and thunks are only made for the elements that are needed as thunks, e.g. to bind them
+     * to a variable.
+     */
+    bool isRange;
+    double rangeFrom;
+    size_t rangeLength;
+
+    HeapArray(const HeapArrayElements &elements)
+      : elements(elements), isRange(false), rangeFrom(0), rangeLength(0)
     { }
+
+    HeapArray(double range_from, size_t range_length)
+      : isRange(true), rangeFrom(range_from), rangeLength(range_length)
+    { }
+
+    size_t size(void) const
+    {
+        return isRange ? rangeLength : elements.size();
+    }
 };
 
 /** Supertype of all objects that are not super objects or extended objects.  */
@@ -192,7 +336,7 @@ struct HeapExtendedObject : public HeapObject {
     { }
 };
 
-/** Objects created by the ObjectComprehensionSimple construct. */
+/** Objects created by the ObjectComprehensionSimple construct, or imported from JSON. */
 struct HeapComprehensionObject : public HeapLeafObject {
 
     /** The captured environment. */
@@ -212,10 +356,14 @@ struct HeapComprehensionObject : public HeapLeafObject {
      */
     const std::map<const Identifier*, HeapThunk*> compValues;
 
+    /** The visibility of every field: INHERIT for JSON, whose fields are written a: b. */
+    const ObjectField::Hide hide;
+
     HeapComprehensionObject(const BindingFrame &up_values, const AST *value,
                             const Identifier *id,
-                            const std::map<const Identifier*, HeapThunk*> &comp_values)
-      : upValues(up_values), value(value), id(id), compValues(comp_values)
+                            const std::map<const Identifier*, HeapThunk*> &comp_values,
+                            ObjectField::Hide hide = ObjectField::VISIBLE)
+      : upValues(up_values), value(value), id(id), compValues(comp_values), hide(hide)
     { }
 };
 
@@ -224,7 +372,8 @@ struct HeapComprehensionObject : public HeapLeafObject {
  * Either body is non-null and builtin is 0, or body is null and builtin refers to a built-in
  * function.  In the former case, the closure represents a user function, otherwise calling it
  * will trigger the builtin function to execute.  Params is empty when the function is a
- * builtin.
+ * builtin.  A function given by std.native has a null body and the name of the native callback
+ * to call instead.
  */
 struct HeapClosure : public HeapEntity {
     /** The captured environment. */
@@ -236,13 +385,16 @@ struct HeapClosure : public HeapEntity {
     const std::vector<const Identifier*> params;
     const AST *body;
     const unsigned long builtin;
+    /** The name of the native callback, or empty if this is not a native function. */
+    const std::string nativeName;
     HeapClosure(const BindingFrame &up_values,
                  HeapObject *self,
                  unsigned offset,
                  const std::vector<const Identifier*> &params,
-                 const AST *body, unsigned long builtin)
+                 const AST *body, unsigned long builtin,
+                 const std::string &native_name = "")
       : upValues(up_values), self(self), offset(offset),
-        params(params), body(body), builtin(builtin)
+        params(params), body(body), builtin(builtin), nativeName(native_name)
     { }
 };
 
@@ -254,6 +406,68 @@ struct HeapString : public HeapEntity {
     { }
 };
 
+static inline HeapEntityKind heap_entity_kind(const HeapThunk *) { return HEAP_THUNK; }
+static inline HeapEntityKind heap_entity_kind(const HeapArray *) { return HEAP_ARRAY; }
+static inline HeapEntityKind heap_entity_kind(const HeapSimpleObject *)
+{ return HEAP_SIMPLE_OBJECT; }
+static inline HeapEntityKind heap_entity_kind(const HeapExtendedObject *)
+{ return HEAP_EXTENDED_OBJECT; }
+static inline HeapEntityKind heap_entity_kind(const HeapComprehensionObject *)
+{ return HEAP_COMPREHENSION_OBJECT; }
+static inline HeapEntityKind heap_entity_kind(const HeapClosure *) { return HEAP_CLOSURE; }
+static inline HeapEntityKind heap_entity_kind(const HeapString *) { return HEAP_STRING; }
+
+static inline const char *heap_entity_kind_name(HeapEntityKind kind)
+{
+    switch (kind) {
+        case HEAP_THUNK: return "thunk";
+        case HEAP_ARRAY: return "array";
+        case HEAP_SIMPLE_OBJECT: return "simple_object";
+        case HEAP_EXTENDED_OBJECT: return "extended_object";
+        case HEAP_COMPREHENSION_OBJECT: return "comprehension_object";
+        case HEAP_CLOSURE: return "closure";
+        case HEAP_STRING: return "string";
+        default:
+        std::cerr << "INTERNAL ERROR: Unknown heap entity kind: " << kind << std::endl;
+        std::abort();
+        return "";  // Quiet, compiler.
+    }
+}
+
+/** The memory used by a new heap entity, not counting what it points to.
+ *
+ * The elements of arrays are not included, as arrays share them and can gain them after they
+ * are created.  The heap can count them as it frees arrays instead.
+ */
+template <class T> size_t heap_entity_bytes(const T *)
+{
+    return sizeof(T);
+}
+
+static inline size_t heap_entity_bytes(const HeapString *str)
+{
+    return sizeof(HeapString) + str->value.size() * sizeof(char32_t);
+}
+
+/** Counters kept by the heap, for tuning the garbage collector. */
+struct HeapStats {
+    /** The number of entities of each kind ever allocated. */
+    unsigned long allocations[HEAP_NUM_KINDS];
+
+    /** Their memory, see heap_entity_bytes, and for arrays that of their elements if counted. */
+    unsigned long bytes[HEAP_NUM_KINDS];
+
+    /** The greatest number of entities that have been in the heap at once. */
+    unsigned long peakEntities;
+
+    /** The number of garbage collection cycles. */
+    unsigned long cycles;
+
+    HeapStats(void)
+      : allocations(), bytes(), peakEntities(0), cycles(0)
+    { }
+};
+
 /** The heap does memory management, i.e. garbage collection. */
 class Heap {
 
@@ -282,6 +496,15 @@ class Heap {
     /** The number of heap entities now. */
     unsigned long numEntities;
 
+    /** The number of heap entities ever allocated. */
+    unsigned long numAllocations;
+
+    /** \see getStats */
+    HeapStats stats;
+
+    /** Whether the stats count the memory of array elements, which slows down collection. */
+    bool countArrayElements;
+
     /** Add the HeapEntity inside v to vec, if the value exists on the heap.   
      */
     void addIfHeapEntity(Value v, std::vector<HeapEntity*> &vec)
@@ -296,18 +519,43 @@ class Heap {
         vec.push_back(v);
     }
 
+    /** Delete everything that was not marked since the last collection. */
+    void deleteUnmarked(void)
+    {
+        lastMark++;
+        // Heap shrinks during this loop.  Do not cache entities.size().
+        for (unsigned long i=0 ; i<entities.size() ; ++i) {
+            HeapEntity *x = entities[i];
+            if (x->mark != lastMark) {
+                if (countArrayElements && x->kind == HEAP_ARRAY) {
+                    auto *arr = static_cast<HeapArray*>(x);
+                    stats.bytes[HEAP_ARRAY] += arr->elements.takeUncountedBytes();
+                }
+                delete x;
+                if (i != entities.size() - 1) {
+                    // Swap it with the back.
+                    entities[i] = entities[entities.size()-1];
+                }
+                entities.pop_back();
+                --i;
+            }
+        }
+        lastNumEntities = numEntities = entities.size();
+    }
+
     public:
 
-    Heap(unsigned gc_tune_min_objects, double gc_tune_growth_trigger)
+    Heap(unsigned gc_tune_min_objects, double gc_tune_growth_trigger,
+         bool count_array_elements)
       : gcTuneMinObjects(gc_tune_min_objects), gcTuneGrowthTrigger(gc_tune_growth_trigger),
-        lastMark(0), lastNumEntities(0), numEntities(0)
+        lastMark(0), lastNumEntities(0), numEntities(0), numAllocations(0),
+        countArrayElements(count_array_elements)
     {
     }
 
     ~Heap(void)
     {
-        // Nothing is marked, everything will be collected.
-        sweep();
+        clear();
     }
 
     /** Garbage collection: Mark v, and entities reachable from v. */
@@ -388,21 +636,15 @@ class Heap {
     /** Delete everything that was not marked since the last collection. */
     void sweep(void)
     {
-        lastMark++;
-        // Heap shrinks during this loop.  Do not cache entities.size().
-        for (unsigned long i=0 ; i<entities.size() ; ++i) {
-            HeapEntity *x = entities[i];
-            if (x->mark != lastMark) {
-                delete x;
-                if (i != entities.size() - 1) {
-                    // Swap it with the back.
-                    entities[i] = entities[entities.size()-1];
-                }
-                entities.pop_back();
-                --i;
-            }
-        }
-        lastNumEntities = numEntities = entities.size();
+        deleteUnmarked();
+        stats.cycles++;
+    }
+
+    /** Delete every entity, e.g. so that the stats count the elements of all arrays. */
+    void clear(void)
+    {
+        // Nothing is marked, everything will be collected.
+        deleteUnmarked();
     }
 
     /** Is it time to initiate a GC cycle? */
@@ -412,6 +654,18 @@ class Heap {
             && numEntities > gcTuneGrowthTrigger * lastNumEntities;
     }
 
+    /** The number of heap entities ever allocated, including those since collected. */
+    unsigned long getNumAllocations(void) const
+    {
+        return numAllocations;
+    }
+
+    /** Counters since the heap was created. */
+    const HeapStats &getStats(void) const
+    {
+        return stats;
+    }
+
     /** Allocate a heap entity.
      *
      * If the heap is large enough (\see gcTuneMinObjects) and has grown by enough since the
@@ -423,6 +677,12 @@ class Heap {
         entities.push_back(r);
         r->mark = lastMark;
         numEntities = entities.size();
+        numAllocations++;
+        HeapEntityKind kind = heap_entity_kind(r);
+        r->kind = kind;
+        stats.allocations[kind]++;
+        stats.bytes[kind] += heap_entity_bytes(r);
+        if (numEntities > stats.peakEntities) stats.peakEntities = numEntities;
         return r;
     }
 
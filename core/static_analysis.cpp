@@ -149,7 +149,8 @@ static IdSet static_analysis(AST *ast_, bool in_object, const IdSet &vars)
         append(r, static_analysis(ast->expr, in_object, vars));
 
     } else if (auto *ast = dynamic_cast<const Var*>(ast_)) {
-        if (vars.find(ast->id) == vars.end()) {
+        // $std is bound by the interpreter, see jsonnet_desugar.
+        if (vars.find(ast->id) == vars.end() && ast->id->name != U"$std") {
             throw StaticError(ast->location, "Unknown variable: "+encode_utf8(ast->id->name));
         }
         r.insert(ast->id);
@@ -0,0 +1,1886 @@
+2,11,115,116,100,46,106,115,111,110,110,101,116,0,144,1,3,115,116,100,1,36,1,97,3,115,116,114,4,102,114,111,
+109,3,108,101,110,1,105,1,98,1,99,3,97,114,114,1,120,1,118,4,102,117,110,99,3,115,101,112,3,97,117,120,
+5,102,105,114,115,116,7,114,117,110,110,105,110,103,4,118,97,108,115,21,116,114,121,95,112,97,114,115,101,95,109,97,
+112,112,105,110,103,95,107,101,121,7,99,111,110,115,117,109,101,1,106,16,116,114,121,95,112,97,114,115,101,95,99,102,
+108,97,103,115,21,116,114,121,95,112,97,114,115,101,95,102,105,101,108,100,95,119,105,100,116,104,19,116,114,121,95,112,
+97,114,115,101,95,112,114,101,99,105,115,105,111,110,25,116,114,121,95,112,97,114,115,101,95,108,101,110,103,116,104,95,
+109,111,100,105,102,105,101,114,15,112,97,114,115,101,95,99,111,110,118,95,116,121,112,101,10,112,97,114,115,101,95,99,
+111,100,101,4,109,107,101,121,6,99,102,108,97,103,115,2,102,119,4,112,114,101,99,7,108,101,110,95,109,111,100,5,
+99,116,121,112,101,11,112,97,114,115,101,95,99,111,100,101,115,3,111,117,116,3,99,117,114,1,114,5,99,111,100,101,
+115,7,112,97,100,100,105,110,103,1,119,1,115,8,112,97,100,95,108,101,102,116,9,112,97,100,95,114,105,103,104,116,
+10,114,101,110,100,101,114,95,105,110,116,3,110,95,95,9,109,105,110,95,99,104,97,114,115,10,109,105,110,95,100,105,
+103,105,116,115,5,98,108,97,110,107,4,115,105,103,110,5,114,97,100,105,120,11,122,101,114,111,95,112,114,101,102,105,
+120,2,110,95,1,110,3,100,101,99,3,110,101,103,2,122,112,3,122,112,50,4,100,101,99,50,10,114,101,110,100,101,
+114,95,104,101,120,9,97,100,100,95,122,101,114,111,120,8,99,97,112,105,116,97,108,115,8,110,117,109,101,114,97,108,
+115,3,104,101,120,4,104,101,120,50,19,115,116,114,105,112,95,116,114,97,105,108,105,110,103,95,122,101,114,111,16,114,
+101,110,100,101,114,95,102,108,111,97,116,95,100,101,99,8,122,101,114,111,95,112,97,100,9,101,110,115,117,114,101,95,
+112,116,8,116,114,97,105,108,105,110,103,5,119,104,111,108,101,8,100,111,116,95,115,105,122,101,4,102,114,97,99,8,
+102,114,97,99,95,115,116,114,16,114,101,110,100,101,114,95,102,108,111,97,116,95,115,99,105,4,99,97,112,115,8,101,
+120,112,111,110,101,110,116,4,115,117,102,102,8,109,97,110,116,105,115,115,97,11,102,111,114,109,97,116,95,99,111,100,
+101,3,118,97,108,4,99,111,100,101,12,112,114,101,99,95,111,114,95,110,117,108,108,6,102,112,112,114,101,99,5,105,
+112,114,101,99,16,100,105,103,105,116,115,95,98,101,102,111,114,101,95,112,116,16,102,111,114,109,97,116,95,99,111,100,
+101,115,95,97,114,114,3,116,109,112,4,116,109,112,50,2,106,50,8,115,95,112,97,100,100,101,100,16,102,111,114,109,
+97,116,95,99,111,100,101,115,95,111,98,106,3,111,98,106,1,102,4,105,110,105,116,3,105,100,120,11,102,105,108,116,
+101,114,95,102,117,110,99,8,109,97,112,95,102,117,110,99,4,97,114,114,115,3,105,110,105,10,98,111,100,121,95,108,
+105,110,101,115,4,98,111,100,121,2,36,108,6,36,97,117,120,95,48,4,36,105,95,48,2,36,114,1,107,13,115,101,
+99,116,105,111,110,95,108,105,110,101,115,5,115,110,97,109,101,5,115,98,111,100,121,9,109,97,105,110,95,98,111,100,
+121,12,97,108,108,95,115,101,99,116,105,111,110,115,4,115,116,114,95,5,116,114,97,110,115,2,99,104,1,111,6,102,
+105,101,108,100,115,2,111,50,4,99,111,110,102,4,118,97,114,115,1,108,5,112,105,118,111,116,4,114,101,115,116,4,
+108,101,102,116,5,114,105,103,104,116,3,97,99,99,2,116,97,2,116,98,2,108,97,7,108,102,105,101,108,100,115,2,
+115,122,10,105,110,99,95,104,105,100,100,101,110,4,110,97,109,101,5,105,110,112,117,116,5,118,97,108,117,101,6,105,
+110,100,101,110,116,6,116,97,114,103,101,116,5,112,97,116,99,104,9,109,97,120,115,112,108,105,116,115,3,112,97,116,
+2,116,111,9,105,110,100,101,120,97,98,108,101,5,105,110,100,101,120,3,101,110,100,4,115,116,101,112,8,0,23,1,
+250,5,1,0,0,78,0,19,1,0,0,0,0,0,8,116,111,83,116,114,105,110,103,1,0,0,15,0,28,9,28,53,
+0,2,0,24,0,25,17,25,20,0,1,24,1,0,0,0,0,0,11,0,28,9,28,53,1,0,1,2,7,0,28,9,
+28,53,2,0,2,0,0,28,12,28,34,2,0,2,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,
+0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,28,12,28,22,2,0,
+2,14,0,28,12,28,19,1,0,27,0,28,12,28,14,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,
+1,0,0,254,1,254,1,0,1,27,0,28,21,28,21,1,2,2,2,0,19,0,28,27,28,34,0,6,115,116,114,105,
+110,103,1,0,0,1,27,0,28,41,28,41,1,2,2,2,5,0,28,48,28,53,1,2,3,19,0,28,48,28,49,0,
+0,1,0,0,27,0,28,53,28,53,1,2,2,2,0,19,1,0,0,0,0,0,6,115,117,98,115,116,114,1,0,0,
+15,0,31,9,40,71,0,2,0,255,1,1,1,255,1,2,11,0,31,9,40,71,1,0,3,3,4,5,7,0,31,9,
+40,71,4,0,3,4,5,26,0,31,12,31,36,2,0,3,0,0,0,31,12,31,36,2,0,3,14,1,0,0,0,0,
+1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,
+254,1,0,2,0,0,31,12,31,24,2,0,3,14,0,31,12,31,19,1,0,27,0,31,12,31,14,1,0,0,0,0,
+19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,31,21,31,23,1,3,3,3,0,
+19,0,31,29,31,36,0,6,115,116,114,105,110,103,1,0,0,1,10,0,32,13,32,83,2,0,3,5,0,32,19,32,
+83,2,0,3,3,19,0,32,19,32,67,0,47,115,117,98,115,116,114,32,102,105,114,115,116,32,112,97,114,97,109,101,
+116,101,114,32,115,104,111,117,108,100,32,98,101,32,97,32,115,116,114,105,110,103,44,32,103,111,116,32,1,0,0,0,
+0,32,71,32,83,2,0,3,14,0,32,71,32,78,1,0,27,0,32,71,32,73,1,0,0,0,0,19,1,0,0,0,
+0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,32,80,32,82,1,3,3,3,0,7,0,33,14,40,
+71,4,0,3,4,5,26,0,33,17,33,42,2,0,4,0,0,0,33,17,33,42,2,0,4,14,1,0,0,0,0,1,
+0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,
+1,0,2,0,0,33,17,33,30,2,0,4,14,0,33,17,33,24,1,0,27,0,33,17,33,19,1,0,0,0,0,19,
+1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,33,26,33,29,1,4,4,4,0,19,
+0,33,35,33,42,0,6,110,117,109,98,101,114,1,0,0,1,10,0,34,13,34,85,2,0,4,5,0,34,19,34,85,
+2,0,4,3,19,0,34,19,34,68,0,48,115,117,98,115,116,114,32,115,101,99,111,110,100,32,112,97,114,97,109,101,
+116,101,114,32,115,104,111,117,108,100,32,98,101,32,97,32,110,117,109,98,101,114,44,32,103,111,116,32,1,0,0,0,
+0,34,72,34,85,2,0,4,14,0,34,72,34,79,1,0,27,0,34,72,34,74,1,0,0,0,0,19,1,0,0,0,
+0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,34,81,34,84,1,4,4,4,0,7,0,35,14,40,
+71,4,0,3,4,5,26,0,35,17,35,41,2,0,5,0,0,0,35,17,35,41,2,0,5,14,1,0,0,0,0,1,
+0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,
+1,0,2,0,0,35,17,35,29,2,0,5,14,0,35,17,35,24,1,0,27,0,35,17,35,19,1,0,0,0,0,19,
+1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,35,26,35,28,1,5,5,5,0,19,
+0,35,34,35,41,0,6,110,117,109,98,101,114,1,0,0,1,10,0,36,13,36,83,2,0,5,5,0,36,19,36,83,
+2,0,5,3,19,0,36,19,36,67,0,47,115,117,98,115,116,114,32,116,104,105,114,100,32,112,97,114,97,109,101,116,
+101,114,32,115,104,111,117,108,100,32,98,101,32,97,32,110,117,109,98,101,114,44,32,103,111,116,32,1,0,0,0,0,
+36,71,36,83,2,0,5,14,0,36,71,36,78,1,0,27,0,36,71,36,73,1,0,0,0,0,19,1,0,0,0,0,
+0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,36,80,36,82,1,5,5,5,0,7,0,37,14,40,71,
+4,0,3,4,5,5,0,37,17,37,23,1,5,9,27,0,37,17,37,19,1,5,5,5,18,0,37,23,37,23,0,1,
+48,10,0,38,13,38,82,1,5,5,0,38,19,38,82,1,5,3,19,0,38,19,38,76,0,56,115,117,98,115,116,114,
+32,116,104,105,114,100,32,112,97,114,97,109,101,116,101,114,32,115,104,111,117,108,100,32,98,101,32,103,114,101,97,116,
+101,114,32,116,104,97,110,32,122,101,114,111,44,32,103,111,116,32,1,0,0,27,0,38,80,38,82,1,5,5,5,0,
+0,40,13,40,71,4,0,3,4,5,14,0,40,13,40,20,1,0,27,0,40,13,40,15,1,0,0,0,0,19,1,0,
+0,0,0,0,4,106,111,105,110,1,0,0,254,1,254,1,0,2,19,0,40,22,40,23,0,0,1,0,0,0,0,40,
+26,40,70,4,0,3,4,5,14,0,40,26,40,38,1,0,27,0,40,26,40,28,1,0,0,0,0,19,1,0,0,0,
+0,0,9,109,97,107,101,65,114,114,97,121,1,0,0,254,1,254,1,0,2,27,0,40,40,40,42,1,5,5,5,11,
+0,40,45,40,69,2,3,4,1,6,14,0,40,57,40,69,3,3,4,6,27,0,40,57,40,59,1,3,3,3,0,5,
+0,40,61,40,68,2,4,6,3,27,0,40,61,40,61,1,6,6,6,27,0,40,65,40,68,1,4,4,4,254,1,254,
+1,0,0,0,1,19,1,0,0,0,0,0,10,115,116,97,114,116,115,87,105,116,104,1,0,0,15,0,43,9,46,48,
+0,2,0,255,1,1,1,255,1,2,11,0,43,9,46,48,1,0,2,2,7,7,0,43,9,46,48,3,0,2,7,5,
+0,43,12,43,40,3,0,2,7,9,0,0,43,12,43,24,2,0,2,14,0,43,12,43,21,1,0,27,0,43,12,43,
+14,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,43,
+23,43,23,1,2,2,2,0,0,0,43,28,43,40,2,0,7,14,0,43,28,43,37,1,0,27,0,43,28,43,30,1,
+0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,43,39,43,
+39,1,7,7,7,0,16,0,44,13,44,17,0,0,0,0,46,13,46,48,3,0,2,7,14,1,0,0,0,0,1,0,
+27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,
+0,2,0,0,46,13,46,43,3,0,2,7,14,0,46,13,46,22,1,0,27,0,46,13,46,15,1,0,0,0,0,19,
+1,0,0,0,0,0,6,115,117,98,115,116,114,1,0,0,254,1,254,1,0,3,27,0,46,24,46,24,1,2,2,2,
+18,0,46,27,46,27,0,1,48,0,0,46,30,46,42,2,0,7,14,0,46,30,46,39,1,0,27,0,46,30,46,32,
+1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,46,41,
+46,41,1,7,7,7,0,0,27,0,46,48,46,48,1,7,7,7,1,1,19,1,0,0,0,0,0,8,101,110,100,115,
+87,105,116,104,1,0,0,15,0,49,9,52,76,0,2,0,255,1,1,1,255,1,2,11,0,49,9,52,76,1,0,2,
+2,7,7,0,49,9,52,76,3,0,2,7,5,0,49,12,49,40,3,0,2,7,9,0,0,49,12,49,24,2,0,2,
+14,0,49,12,49,21,1,0,27,0,49,12,49,14,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,
+104,1,0,0,254,1,254,1,0,1,27,0,49,23,49,23,1,2,2,2,0,0,0,49,28,49,40,2,0,7,14,0,
+49,28,49,37,1,0,27,0,49,28,49,30,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,
+0,0,254,1,254,1,0,1,27,0,49,39,49,39,1,7,7,7,0,16,0,50,13,50,17,0,0,0,0,52,13,52,
+76,3,0,2,7,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,
+101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,52,13,52,71,3,0,2,7,14,0,52,13,52,22,1,
+0,27,0,52,13,52,15,1,0,0,0,0,19,1,0,0,0,0,0,6,115,117,98,115,116,114,1,0,0,254,1,254,
+1,0,3,27,0,52,24,52,24,1,2,2,2,5,0,52,27,52,55,3,0,2,7,4,0,0,52,27,52,39,2,0,
+2,14,0,52,27,52,36,1,0,27,0,52,27,52,29,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,
+116,104,1,0,0,254,1,254,1,0,1,27,0,52,38,52,38,1,2,2,2,0,0,0,52,43,52,55,2,0,7,14,
+0,52,43,52,52,1,0,27,0,52,43,52,45,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,
+1,0,0,254,1,254,1,0,1,27,0,52,54,52,54,1,7,7,7,0,0,0,52,58,52,70,2,0,7,14,0,52,
+58,52,67,1,0,27,0,52,58,52,60,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,
+0,254,1,254,1,0,1,27,0,52,69,52,69,1,7,7,7,0,0,27,0,52,76,52,76,1,7,7,7,1,0,19,
+1,0,0,0,0,0,11,115,116,114,105,110,103,67,104,97,114,115,1,0,0,15,0,55,9,55,58,0,2,0,255,1,
+1,1,255,1,2,11,0,55,9,55,58,1,0,1,3,0,0,55,9,55,58,2,0,3,14,0,55,9,55,21,1,0,
+27,0,55,9,55,11,1,0,0,0,0,19,1,0,0,0,0,0,9,109,97,107,101,65,114,114,97,121,1,0,0,254,
+1,254,1,0,2,0,0,55,23,55,37,2,0,3,14,0,55,23,55,32,1,0,27,0,55,23,55,25,1,0,0,0,
+0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,55,34,55,36,1,3,
+3,3,0,11,0,55,40,55,57,1,3,1,6,14,0,55,52,55,57,2,3,6,27,0,55,52,55,54,1,3,3,3,
+0,27,0,55,56,55,56,1,6,6,6,254,1,254,1,0,0,0,19,1,0,0,0,0,0,5,115,112,108,105,116,1,
+0,0,15,0,58,9,65,38,0,2,0,255,1,1,1,255,1,2,11,0,58,9,65,38,1,0,2,3,8,7,0,58,
+9,65,38,3,0,3,8,26,0,58,12,58,36,2,0,3,0,0,0,58,12,58,36,2,0,3,14,1,0,0,0,0,
+1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,
+254,1,0,2,0,0,58,12,58,24,2,0,3,14,0,58,12,58,19,1,0,27,0,58,12,58,14,1,0,0,0,0,
+19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,58,21,58,23,1,3,3,3,0,
+19,0,58,29,58,36,0,6,115,116,114,105,110,103,1,0,0,1,10,0,59,13,59,86,2,0,3,5,0,59,19,59,
+86,2,0,3,3,19,0,59,19,59,70,0,50,115,116,100,46,115,112,108,105,116,32,102,105,114,115,116,32,112,97,114,
+97,109,101,116,101,114,32,115,104,111,117,108,100,32,98,101,32,97,32,115,116,114,105,110,103,44,32,103,111,116,32,1,
+0,0,0,0,59,74,59,86,2,0,3,14,0,59,74,59,81,1,0,27,0,59,74,59,76,1,0,0,0,0,19,1,
+0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,59,83,59,85,1,3,3,3,0,7,0,
+60,14,65,38,3,0,3,8,26,0,60,17,60,39,2,0,8,0,0,0,60,17,60,39,2,0,8,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,
+1,254,1,0,2,0,0,60,17,60,27,2,0,8,14,0,60,17,60,24,1,0,27,0,60,17,60,19,1,0,0,0,
+0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,60,26,60,26,1,8,8,8,
+0,19,0,60,32,60,39,0,6,115,116,114,105,110,103,1,0,0,1,10,0,61,13,61,85,2,0,8,5,0,61,19,
+61,85,2,0,8,3,19,0,61,19,61,71,0,51,115,116,100,46,115,112,108,105,116,32,115,101,99,111,110,100,32,112,
+97,114,97,109,101,116,101,114,32,115,104,111,117,108,100,32,98,101,32,97,32,115,116,114,105,110,103,44,32,103,111,116,
+32,1,0,0,0,0,61,75,61,85,2,0,8,14,0,61,75,61,82,1,0,27,0,61,75,61,77,1,0,0,0,0,
+19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,61,84,61,84,1,8,8,8,0,
+7,0,62,14,65,38,3,0,3,8,26,0,62,17,62,34,2,0,8,0,0,0,62,17,62,34,2,0,8,14,1,0,
+0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,
+0,254,1,254,1,0,2,0,0,62,17,62,29,2,0,8,14,0,62,17,62,26,1,0,27,0,62,17,62,19,1,0,
+0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,62,28,62,28,
+1,8,8,8,0,18,0,62,34,62,34,0,1,49,1,10,0,63,13,63,89,2,0,8,5,0,63,19,63,89,2,0,
+8,3,19,0,63,19,63,73,0,53,115,116,100,46,115,112,108,105,116,32,115,101,99,111,110,100,32,112,97,114,97,109,
+101,116,101,114,32,115,104,111,117,108,100,32,104,97,118,101,32,108,101,110,103,116,104,32,49,44,32,103,111,116,32,1,
+0,0,0,0,63,77,63,89,2,0,8,14,0,63,77,63,86,1,0,27,0,63,77,63,79,1,0,0,0,0,19,1,
+0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,63,88,63,88,1,8,8,8,0,
+0,0,65,13,65,38,3,0,3,8,14,0,65,13,65,26,1,0,27,0,65,13,65,15,1,0,0,0,0,19,1,0,
+0,0,0,0,10,115,112,108,105,116,76,105,109,105,116,1,0,0,254,1,254,1,0,3,27,0,65,28,65,30,1,3,
+3,3,27,0,65,33,65,33,1,8,8,8,26,0,65,36,65,37,0,3,18,0,65,37,65,37,0,1,49,0,0,19,
+1,0,0,0,0,0,5,99,111,117,110,116,1,0,0,15,0,67,21,67,65,0,2,0,255,1,1,1,255,1,2,11,
+0,67,21,67,65,1,0,2,9,10,0,0,67,21,67,65,3,0,9,10,14,0,67,21,67,30,1,0,27,0,67,21,
+67,23,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,0,0,
+67,32,67,64,3,0,9,10,14,0,67,32,67,41,1,0,27,0,67,32,67,34,1,0,0,0,0,19,1,0,0,0,
+0,0,6,102,105,108,116,101,114,1,0,0,254,1,254,1,0,2,11,0,67,43,67,58,2,0,10,1,11,0,0,67,
+55,67,58,3,0,10,11,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,67,55,67,55,1,11,11,11,27,0,67,58,67,
+58,1,10,10,10,1,27,0,67,61,67,63,1,9,9,9,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,0,
+0,15,0,70,9,75,99,0,2,0,255,1,1,1,255,1,2,11,0,70,9,75,99,1,0,2,2,7,7,0,70,9,
+75,99,3,0,2,7,5,0,70,12,70,61,3,0,2,7,16,0,0,70,12,70,34,2,0,2,14,1,0,0,0,0,
+1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,
+254,1,0,2,0,0,70,12,70,22,2,0,2,14,0,70,12,70,19,1,0,27,0,70,12,70,14,1,0,0,0,0,
+19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,70,21,70,21,1,2,2,2,0,
+19,0,70,27,70,34,0,6,110,117,109,98,101,114,1,0,0,1,0,0,70,39,70,61,2,0,7,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,
+1,254,1,0,2,0,0,70,39,70,49,2,0,7,14,0,70,39,70,46,1,0,27,0,70,39,70,41,1,0,0,0,
+0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,70,48,70,48,1,7,7,7,
+0,19,0,70,54,70,61,0,6,110,117,109,98,101,114,1,0,0,1,0,0,71,13,71,28,3,0,2,7,14,0,71,
+13,71,22,1,0,27,0,71,13,71,15,1,0,0,0,0,19,1,0,0,0,0,0,6,109,111,100,117,108,111,1,0,
+0,254,1,254,1,0,2,27,0,71,24,71,24,1,2,2,2,27,0,71,27,71,27,1,7,7,7,0,7,0,72,14,
+75,99,3,0,2,7,0,0,72,17,72,39,2,0,2,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,
+0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,72,17,72,27,2,
+0,2,14,0,72,17,72,24,1,0,27,0,72,17,72,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,
+101,1,0,0,254,1,254,1,0,1,27,0,72,26,72,26,1,2,2,2,0,19,0,72,32,72,39,0,6,115,116,114,
+105,110,103,1,0,0,1,0,0,73,13,73,28,3,0,2,7,14,0,73,13,73,22,1,0,27,0,73,13,73,15,1,
+0,0,0,0,19,1,0,0,0,0,0,6,102,111,114,109,97,116,1,0,0,254,1,254,1,0,2,27,0,73,24,73,
+24,1,2,2,2,27,0,73,27,73,27,1,7,7,7,0,10,0,75,13,75,99,3,0,2,7,5,0,75,19,75,99,
+3,0,2,7,3,5,0,75,19,75,93,3,0,2,7,3,5,0,75,19,75,79,2,0,2,3,5,0,75,19,75,69,
+2,0,2,3,19,0,75,19,75,55,0,35,79,112,101,114,97,116,111,114,32,37,32,99,97,110,110,111,116,32,98,101,
+32,117,115,101,100,32,111,110,32,116,121,112,101,115,32,1,0,0,0,0,75,59,75,69,2,0,2,14,0,75,59,75,
+66,1,0,27,0,75,59,75,61,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,
+1,0,1,27,0,75,68,75,68,1,2,2,2,0,19,0,75,73,75,79,0,5,32,97,110,100,32,1,0,0,0,0,
+75,83,75,93,2,0,7,14,0,75,83,75,90,1,0,27,0,75,83,75,85,1,0,0,0,0,19,1,0,0,0,0,
+0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,75,92,75,92,1,7,7,7,0,19,0,75,97,75,99,
+0,1,46,1,0,0,0,19,1,0,0,0,0,0,3,109,97,112,1,0,0,15,0,78,9,83,68,0,2,0,255,1,
+1,1,255,1,2,11,0,78,9,83,68,1,0,2,12,9,7,0,78,9,83,68,3,0,9,12,26,0,78,12,78,39,
+2,0,12,0,0,0,78,12,78,39,2,0,12,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,
+19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,78,12,78,25,2,0,12,
+14,0,78,12,78,19,1,0,27,0,78,12,78,14,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,
+0,0,254,1,254,1,0,1,27,0,78,21,78,24,1,12,12,12,0,19,0,78,30,78,39,0,8,102,117,110,99,116,
+105,111,110,1,0,0,1,10,0,79,13,79,80,2,0,12,5,0,79,19,79,79,2,0,12,3,19,0,79,19,79,62,
+0,42,115,116,100,46,109,97,112,32,102,105,114,115,116,32,112,97,114,97,109,32,109,117,115,116,32,98,101,32,102,117,
+110,99,116,105,111,110,44,32,103,111,116,32,1,0,0,0,0,79,66,79,79,2,0,12,14,0,79,66,79,73,1,0,
+27,0,79,66,79,68,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,
+27,0,79,75,79,78,1,12,12,12,0,7,0,80,14,83,68,3,0,9,12,5,0,80,17,80,69,2,0,9,16,26,
+0,80,17,80,40,2,0,9,0,0,0,80,17,80,40,2,0,9,14,1,0,0,0,0,1,0,27,1,0,0,0,0,
+1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,80,17,
+80,29,2,0,9,14,0,80,17,80,24,1,0,27,0,80,17,80,19,1,0,0,0,0,19,1,0,0,0,0,0,4,
+116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,80,26,80,28,1,9,9,9,0,19,0,80,34,80,40,0,5,
+97,114,114,97,121,1,0,0,1,26,0,80,45,80,69,2,0,9,0,0,0,80,45,80,69,2,0,9,14,1,0,0,
+0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,
+254,1,254,1,0,2,0,0,80,45,80,57,2,0,9,14,0,80,45,80,52,1,0,27,0,80,45,80,47,1,0,0,
+0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,80,54,80,56,1,9,9,
+9,0,19,0,80,62,80,69,0,6,115,116,114,105,110,103,1,0,0,1,10,0,81,13,81,86,2,0,9,5,0,81,
+19,81,85,2,0,9,3,19,0,81,19,81,69,0,49,115,116,100,46,109,97,112,32,115,101,99,111,110,100,32,112,97,
+114,97,109,32,109,117,115,116,32,98,101,32,97,114,114,97,121,32,47,32,115,116,114,105,110,103,44,32,103,111,116,32,
+1,0,0,0,0,81,73,81,85,2,0,9,14,0,81,73,81,80,1,0,27,0,81,73,81,75,1,0,0,0,0,19,
+1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,81,82,81,84,1,9,9,9,0,0,
+0,83,13,83,68,3,0,9,12,14,0,83,13,83,25,1,0,27,0,83,13,83,15,1,0,0,0,0,19,1,0,0,
+0,0,0,9,109,97,107,101,65,114,114,97,121,1,0,0,254,1,254,1,0,2,0,0,83,27,83,41,2,0,9,14,
+0,83,27,83,36,1,0,27,0,83,27,83,29,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,
+1,0,0,254,1,254,1,0,1,27,0,83,38,83,40,1,9,9,9,0,11,0,83,44,83,67,2,9,12,1,6,0,
+0,83,56,83,67,3,6,9,12,27,0,83,56,83,59,1,12,12,12,1,14,0,83,61,83,66,2,6,9,27,0,83,
+61,83,63,1,9,9,9,0,27,0,83,65,83,65,1,6,6,6,254,1,254,1,0,0,0,0,19,1,0,0,0,0,
+0,4,106,111,105,110,1,0,0,15,0,86,9,102,88,0,2,0,255,1,1,1,255,1,2,11,0,86,9,102,88,1,
+0,2,13,9,15,0,86,9,102,88,3,0,9,13,1,14,11,0,86,9,102,88,3,0,13,14,4,9,6,15,16,7,
+0,87,13,94,62,7,0,6,9,13,14,15,16,5,0,87,16,87,35,3,0,6,9,8,27,0,87,16,87,16,1,6,
+6,6,0,0,87,21,87,35,2,0,9,14,0,87,21,87,30,1,0,27,0,87,21,87,23,1,0,0,0,0,19,1,
+0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,87,32,87,34,1,9,9,9,0,
+27,0,88,17,88,23,1,16,16,16,7,0,89,18,94,62,7,0,6,9,13,14,15,16,0,0,89,21,89,34,3,0,
+6,9,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,
+97,108,115,1,0,0,254,1,254,1,0,2,14,0,89,21,89,26,2,6,9,27,0,89,21,89,23,1,9,9,9,0,
+27,0,89,25,89,25,1,6,6,6,254,1,254,1,0,17,0,89,31,89,34,0,1,0,0,90,17,90,47,5,6,9,
+14,15,16,27,0,90,17,90,19,1,14,14,14,4,27,0,90,21,90,23,1,9,9,9,5,0,90,26,90,30,1,6,
+3,27,0,90,26,90,26,1,6,6,6,18,0,90,30,90,30,0,1,49,27,0,90,33,90,37,1,15,15,15,27,0,
+90,40,90,46,1,16,16,16,1,7,0,91,18,94,62,6,6,9,13,14,15,16,27,0,91,21,91,25,1,15,15,15,
+0,0,92,17,92,56,4,6,9,14,16,27,0,92,17,92,19,1,14,14,14,4,27,0,92,21,92,23,1,9,9,9,
+5,0,92,26,92,30,1,6,3,27,0,92,26,92,26,1,6,6,6,18,0,92,30,92,30,0,1,49,16,0,92,33,
+92,37,0,0,5,0,92,40,92,55,3,6,9,16,3,27,0,92,40,92,46,1,16,16,16,14,0,92,50,92,55,2,
+6,9,27,0,92,50,92,52,1,9,9,9,0,27,0,92,54,92,54,1,6,6,6,254,1,254,1,0,1,0,0,94,
+17,94,62,5,6,9,13,14,16,27,0,94,17,94,19,1,14,14,14,4,27,0,94,21,94,23,1,9,9,9,5,0,
+94,26,94,30,1,6,3,27,0,94,26,94,26,1,6,6,6,18,0,94,30,94,30,0,1,49,16,0,94,33,94,37,
+0,0,5,0,94,40,94,61,4,6,9,13,16,3,5,0,94,40,94,52,2,13,16,3,27,0,94,40,94,46,1,16,
+16,16,27,0,94,50,94,52,1,13,13,13,14,0,94,56,94,61,2,6,9,27,0,94,56,94,58,1,9,9,9,0,
+27,0,94,60,94,60,1,6,6,6,254,1,254,1,0,1,7,0,95,9,102,88,4,0,9,13,14,26,0,95,12,95,
+35,2,0,9,0,0,0,95,12,95,35,2,0,9,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,
+0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,95,12,95,24,2,0,
+9,14,0,95,12,95,19,1,0,27,0,95,12,95,14,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,
+1,0,0,254,1,254,1,0,1,27,0,95,21,95,23,1,9,9,9,0,19,0,95,29,95,35,0,5,97,114,114,97,
+121,1,0,0,1,10,0,96,13,96,79,2,0,9,5,0,96,19,96,79,2,0,9,3,19,0,96,19,96,63,0,43,
+106,111,105,110,32,115,101,99,111,110,100,32,112,97,114,97,109,101,116,101,114,32,115,104,111,117,108,100,32,98,101,32,
+97,114,114,97,121,44,32,103,111,116,32,1,0,0,0,0,96,67,96,79,2,0,9,14,0,96,67,96,74,1,0,27,
+0,96,67,96,69,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,
+0,96,76,96,78,1,9,9,9,0,7,0,97,14,102,88,4,0,9,13,14,0,0,97,17,97,41,2,0,13,14,1,
+0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,
+0,0,254,1,254,1,0,2,0,0,97,17,97,29,2,0,13,14,0,97,17,97,24,1,0,27,0,97,17,97,19,1,
+0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,97,26,97,28,1,
+13,13,13,0,19,0,97,34,97,41,0,6,115,116,114,105,110,103,1,0,0,1,0,0,98,13,98,33,2,9,14,27,
+0,98,13,98,15,1,14,14,14,4,27,0,98,17,98,19,1,9,9,9,18,0,98,22,98,22,0,1,48,16,0,98,
+25,98,28,0,1,19,0,98,31,98,32,0,0,1,0,0,0,7,0,99,14,102,88,4,0,9,13,14,0,0,99,17,
+99,40,2,0,13,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,
+101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,99,17,99,29,2,0,13,14,0,99,17,99,24,1,0,
+27,0,99,17,99,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,
+27,0,99,26,99,28,1,13,13,13,0,19,0,99,34,99,40,0,5,97,114,114,97,121,1,0,0,1,0,0,100,13,
+100,33,2,9,14,27,0,100,13,100,15,1,14,14,14,4,27,0,100,17,100,19,1,9,9,9,18,0,100,22,100,22,
+0,1,48,16,0,100,25,100,28,0,1,1,0,100,31,100,32,0,0,0,10,0,102,13,102,88,2,0,13,5,0,102,
+19,102,88,2,0,13,3,19,0,102,19,102,72,0,52,106,111,105,110,32,102,105,114,115,116,32,112,97,114,97,109,101,
+116,101,114,32,115,104,111,117,108,100,32,98,101,32,115,116,114,105,110,103,32,111,114,32,97,114,114,97,121,44,32,103,
+111,116,32,1,0,0,0,0,102,76,102,88,2,0,13,14,0,102,76,102,83,1,0,27,0,102,76,102,78,1,0,0,
+0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,102,85,102,87,1,13,13,
+13,0,0,19,1,0,0,0,0,0,5,108,105,110,101,115,1,0,0,15,0,105,9,105,34,0,2,0,255,1,1,1,
+255,1,2,11,0,105,9,105,34,1,0,1,9,0,0,105,9,105,34,2,0,9,14,0,105,9,105,16,1,0,27,0,
+105,9,105,11,1,0,0,0,0,19,1,0,0,0,0,0,4,106,111,105,110,1,0,0,254,1,254,1,0,2,19,0,
+105,18,105,21,0,1,10,1,0,0,5,0,105,24,105,33,1,9,3,27,0,105,24,105,26,1,9,9,9,1,0,105,
+30,105,33,0,1,19,0,105,31,105,32,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,102,111,114,109,97,116,
+1,0,0,15,0,113,9,152,4,53,0,2,0,255,1,1,1,255,1,2,11,0,113,9,152,4,53,1,0,2,3,17,
+15,0,113,9,152,4,53,3,0,3,17,1,18,11,0,113,9,152,4,53,1,0,2,3,6,7,0,114,13,130,1,37,
+3,0,3,6,5,0,114,16,114,35,3,0,3,6,8,27,0,114,16,114,16,1,6,6,6,0,0,114,21,114,35,2,
+0,3,14,0,114,21,114,30,1,0,27,0,114,21,114,23,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,
+103,116,104,1,0,0,254,1,254,1,0,1,27,0,114,32,114,34,1,3,3,3,0,10,0,115,17,115,46,0,19,0,
+115,23,115,46,0,22,84,114,117,110,99,97,116,101,100,32,102,111,114,109,97,116,32,99,111,100,101,46,1,0,0,15,
+0,117,17,130,1,37,3,0,3,6,1,8,14,0,117,27,117,32,2,3,6,27,0,117,27,117,29,1,3,3,3,0,
+27,0,117,31,117,31,1,6,6,6,254,1,254,1,0,7,0,118,17,130,1,37,4,0,3,6,8,0,0,118,20,118,
+27,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,
+113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,118,20,118,20,1,8,8,8,19,0,118,25,118,27,0,1,
+40,1,0,0,1,15,0,119,21,128,1,43,3,0,3,6,1,19,11,0,119,21,128,1,43,2,0,19,3,3,20,11,
+7,0,120,25,127,50,5,0,3,11,19,20,5,0,120,28,120,47,3,0,3,20,8,27,0,120,28,120,28,1,20,20,
+20,0,0,120,33,120,47,2,0,3,14,0,120,33,120,42,1,0,27,0,120,33,120,35,1,0,0,0,0,19,1,0,
+0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,120,44,120,46,1,3,3,3,0,10,
+0,121,29,121,58,0,19,0,121,35,121,58,0,22,84,114,117,110,99,97,116,101,100,32,102,111,114,109,97,116,32,99,
+111,100,101,46,1,0,0,15,0,123,29,127,50,5,0,3,11,19,20,1,8,14,0,123,39,123,44,2,3,20,27,0,
+123,39,123,41,1,3,3,3,0,27,0,123,43,123,43,1,20,20,20,254,1,254,1,0,7,0,124,29,127,50,6,0,
+3,8,11,19,20,26,0,124,32,124,39,2,0,8,0,0,0,124,32,124,39,2,0,8,14,1,0,0,0,0,1,0,
+27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,
+0,2,27,0,124,32,124,32,1,8,8,8,19,0,124,37,124,39,0,1,41,1,0,0,1,0,0,125,33,125,58,5,
+3,8,11,19,20,27,0,125,33,125,39,1,19,19,19,3,27,0,125,41,125,43,1,3,3,3,5,0,125,46,125,50,
+1,20,3,27,0,125,46,125,46,1,20,20,20,18,0,125,50,125,50,0,1,49,5,0,125,53,125,57,2,8,11,3,
+27,0,125,53,125,53,1,11,11,11,27,0,125,57,125,57,1,8,8,8,0,8,0,127,33,127,50,2,11,20,0,2,
+1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,127,38,127,42,1,20,3,27,0,127,38,127,38,1,20,20,20,
+18,0,127,42,127,42,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,27,0,127,48,127,48,1,11,11,11,
+0,0,128,1,21,128,1,43,3,3,6,19,27,0,128,1,21,128,1,27,1,19,19,19,3,27,0,128,1,29,128,1,
+31,1,3,3,3,5,0,128,1,34,128,1,38,1,6,3,27,0,128,1,34,128,1,34,1,6,6,6,18,0,128,1,
+38,128,1,38,0,1,49,19,0,128,1,41,128,1,42,0,0,1,0,0,0,8,0,130,1,21,130,1,37,1,6,0,
+2,1,19,1,0,0,0,0,0,1,105,1,0,0,27,0,130,1,26,130,1,26,1,6,6,6,1,19,1,0,0,0,
+0,0,1,118,1,0,0,17,0,130,1,32,130,1,35,0,15,0,132,1,9,152,4,53,4,0,3,17,18,1,21,11,
+0,132,1,9,152,4,53,1,0,2,3,6,15,0,133,1,13,150,1,95,3,0,3,6,1,19,11,0,133,1,13,150,
+1,95,2,0,19,3,3,20,11,7,0,134,1,17,149,1,38,5,0,3,11,19,20,5,0,134,1,20,134,1,39,3,
+0,3,20,8,27,0,134,1,20,134,1,20,1,20,20,20,0,0,134,1,25,134,1,39,2,0,3,14,0,134,1,25,
+134,1,34,1,0,27,0,134,1,25,134,1,27,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,
+1,0,0,254,1,254,1,0,1,27,0,134,1,36,134,1,38,1,3,3,3,0,10,0,135,1,21,135,1,50,0,19,
+0,135,1,27,135,1,50,0,22,84,114,117,110,99,97,116,101,100,32,102,111,114,109,97,116,32,99,111,100,101,46,1,
+0,0,15,0,137,1,21,149,1,38,5,0,3,11,19,20,1,8,14,0,137,1,31,137,1,36,2,3,20,27,0,137,
+1,31,137,1,33,1,3,3,3,0,27,0,137,1,35,137,1,35,1,20,20,20,254,1,254,1,0,7,0,138,1,21,
+149,1,38,6,0,3,8,11,19,20,0,0,138,1,24,138,1,31,2,0,8,14,1,0,0,0,0,1,0,27,1,0,
+0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,
+0,138,1,24,138,1,24,1,8,8,8,19,0,138,1,29,138,1,31,0,1,35,1,0,0,1,0,0,139,1,25,139,
+1,62,4,3,11,19,20,27,0,139,1,25,139,1,31,1,19,19,19,3,27,0,139,1,33,139,1,35,1,3,3,3,
+5,0,139,1,38,139,1,42,1,20,3,27,0,139,1,38,139,1,38,1,20,20,20,18,0,139,1,42,139,1,42,0,
+1,49,5,0,139,1,45,139,1,61,1,11,3,27,0,139,1,45,139,1,45,1,11,11,11,8,0,139,1,49,139,1,
+61,0,0,1,1,19,1,0,0,0,0,0,3,97,108,116,1,0,0,16,0,139,1,56,139,1,59,0,1,0,7,0,
+140,1,26,149,1,38,6,0,3,8,11,19,20,0,0,140,1,29,140,1,36,2,0,8,14,1,0,0,0,0,1,0,
+27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,
+0,2,27,0,140,1,29,140,1,29,1,8,8,8,19,0,140,1,34,140,1,36,0,1,48,1,0,0,1,0,0,141,
+1,25,141,1,63,4,3,11,19,20,27,0,141,1,25,141,1,31,1,19,19,19,3,27,0,141,1,33,141,1,35,1,
+3,3,3,5,0,141,1,38,141,1,42,1,20,3,27,0,141,1,38,141,1,38,1,20,20,20,18,0,141,1,42,141,
+1,42,0,1,49,5,0,141,1,45,141,1,62,1,11,3,27,0,141,1,45,141,1,45,1,11,11,11,8,0,141,1,
+49,141,1,62,0,0,1,1,19,1,0,0,0,0,0,4,122,101,114,111,1,0,0,16,0,141,1,57,141,1,60,0,
+1,0,7,0,142,1,26,149,1,38,6,0,3,8,11,19,20,0,0,142,1,29,142,1,36,2,0,8,14,1,0,0,
+0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,
+254,1,254,1,0,2,27,0,142,1,29,142,1,29,1,8,8,8,19,0,142,1,34,142,1,36,0,1,45,1,0,0,
+1,0,0,143,1,25,143,1,63,4,3,11,19,20,27,0,143,1,25,143,1,31,1,19,19,19,3,27,0,143,1,33,
+143,1,35,1,3,3,3,5,0,143,1,38,143,1,42,1,20,3,27,0,143,1,38,143,1,38,1,20,20,20,18,0,
+143,1,42,143,1,42,0,1,49,5,0,143,1,45,143,1,62,1,11,3,27,0,143,1,45,143,1,45,1,11,11,11,
+8,0,143,1,49,143,1,62,0,0,1,1,19,1,0,0,0,0,0,4,108,101,102,116,1,0,0,16,0,143,1,57,
+143,1,60,0,1,0,7,0,144,1,26,149,1,38,6,0,3,8,11,19,20,0,0,144,1,29,144,1,36,2,0,8,
+14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,
+115,1,0,0,254,1,254,1,0,2,27,0,144,1,29,144,1,29,1,8,8,8,19,0,144,1,34,144,1,36,0,1,
+32,1,0,0,1,0,0,145,1,25,145,1,64,4,3,11,19,20,27,0,145,1,25,145,1,31,1,19,19,19,3,27,
+0,145,1,33,145,1,35,1,3,3,3,5,0,145,1,38,145,1,42,1,20,3,27,0,145,1,38,145,1,38,1,20,
+20,20,18,0,145,1,42,145,1,42,0,1,49,5,0,145,1,45,145,1,63,1,11,3,27,0,145,1,45,145,1,45,
+1,11,11,11,8,0,145,1,49,145,1,63,0,0,1,1,19,1,0,0,0,0,0,5,98,108,97,110,107,1,0,0,
+16,0,145,1,58,145,1,61,0,1,0,7,0,146,1,26,149,1,38,6,0,3,8,11,19,20,0,0,146,1,29,146,
+1,36,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,
+101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,146,1,29,146,1,29,1,8,8,8,19,0,146,1,34,
+146,1,36,0,1,43,1,0,0,1,0,0,147,1,25,147,1,63,4,3,11,19,20,27,0,147,1,25,147,1,31,1,
+19,19,19,3,27,0,147,1,33,147,1,35,1,3,3,3,5,0,147,1,38,147,1,42,1,20,3,27,0,147,1,38,
+147,1,38,1,20,20,20,18,0,147,1,42,147,1,42,0,1,49,5,0,147,1,45,147,1,62,1,11,3,27,0,147,
+1,45,147,1,45,1,11,11,11,8,0,147,1,49,147,1,62,0,0,1,1,19,1,0,0,0,0,0,4,115,105,103,
+110,1,0,0,16,0,147,1,57,147,1,60,0,1,0,8,0,149,1,25,149,1,38,2,11,20,0,2,1,19,1,0,
+0,0,0,0,1,105,1,0,0,27,0,149,1,30,149,1,30,1,20,20,20,1,19,1,0,0,0,0,0,1,118,1,
+0,0,27,0,149,1,36,149,1,36,1,11,11,11,0,0,150,1,13,150,1,95,3,3,6,19,27,0,150,1,13,150,
+1,19,1,19,19,19,3,27,0,150,1,21,150,1,23,1,3,3,3,27,0,150,1,26,150,1,26,1,6,6,6,8,
+0,150,1,29,150,1,94,0,0,5,1,19,1,0,0,0,0,0,3,97,108,116,1,0,0,16,0,150,1,36,150,1,
+40,0,0,1,19,1,0,0,0,0,0,4,122,101,114,111,1,0,0,16,0,150,1,49,150,1,53,0,0,1,19,1,
+0,0,0,0,0,4,108,101,102,116,1,0,0,16,0,150,1,62,150,1,66,0,0,1,19,1,0,0,0,0,0,5,
+98,108,97,110,107,1,0,0,16,0,150,1,76,150,1,80,0,0,1,19,1,0,0,0,0,0,4,115,105,103,110,1,
+0,0,16,0,150,1,89,150,1,93,0,0,0,15,0,152,1,9,152,4,53,5,0,3,17,18,21,1,22,11,0,152,
+1,9,152,4,53,1,0,2,3,6,7,0,153,1,13,183,1,34,3,0,3,6,5,0,153,1,16,153,1,51,3,0,
+3,6,16,5,0,153,1,16,153,1,34,3,0,3,6,9,27,0,153,1,16,153,1,16,1,6,6,6,0,0,153,1,
+20,153,1,34,2,0,3,14,0,153,1,20,153,1,29,1,0,27,0,153,1,20,153,1,22,1,0,0,0,0,19,1,
+0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,153,1,31,153,1,33,1,3,3,
+3,0,0,0,153,1,39,153,1,51,3,0,3,6,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,
+0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,153,1,39,153,1,44,
+2,3,6,27,0,153,1,39,153,1,41,1,3,3,3,0,27,0,153,1,43,153,1,43,1,6,6,6,254,1,254,1,
+0,19,0,153,1,49,153,1,51,0,1,42,1,0,0,1,8,0,154,1,17,154,1,34,1,6,0,2,1,19,1,0,
+0,0,0,0,1,105,1,0,0,5,0,154,1,22,154,1,24,1,6,3,27,0,154,1,22,154,1,22,1,6,6,6,
+18,0,154,1,24,154,1,24,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,154,1,30,154,1,32,
+0,1,42,1,0,0,15,0,156,1,17,183,1,34,3,0,3,6,1,19,11,0,156,1,17,183,1,34,2,0,19,3,
+3,20,11,7,0,157,1,21,182,1,42,5,0,3,11,19,20,5,0,157,1,24,157,1,43,3,0,3,20,8,27,0,
+157,1,24,157,1,24,1,20,20,20,0,0,157,1,29,157,1,43,2,0,3,14,0,157,1,29,157,1,38,1,0,27,
+0,157,1,29,157,1,31,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,
+1,0,1,27,0,157,1,40,157,1,42,1,3,3,3,0,10,0,158,1,25,158,1,54,0,19,0,158,1,31,158,1,
+54,0,22,84,114,117,110,99,97,116,101,100,32,102,111,114,109,97,116,32,99,111,100,101,46,1,0,0,15,0,160,1,
+25,182,1,42,5,0,3,11,19,20,1,8,14,0,160,1,35,160,1,40,2,3,20,27,0,160,1,35,160,1,37,1,
+3,3,3,0,27,0,160,1,39,160,1,39,1,20,20,20,254,1,254,1,0,7,0,161,1,25,182,1,42,6,0,3,
+8,11,19,20,0,0,161,1,28,161,1,35,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,
+0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,161,1,28,161,1,
+28,1,8,8,8,19,0,161,1,33,161,1,35,0,1,48,1,0,0,1,0,0,162,1,29,162,1,59,4,3,11,19,
+20,27,0,162,1,29,162,1,35,1,19,19,19,3,27,0,162,1,37,162,1,39,1,3,3,3,5,0,162,1,42,162,
+1,46,1,20,3,27,0,162,1,42,162,1,42,1,20,20,20,18,0,162,1,46,162,1,46,0,1,49,5,0,162,1,
+49,162,1,58,1,11,3,5,0,162,1,49,162,1,54,1,11,0,27,0,162,1,49,162,1,49,1,11,11,11,18,0,
+162,1,53,162,1,54,0,2,49,48,18,0,162,1,58,162,1,58,0,1,48,0,7,0,163,1,30,182,1,42,6,0,
+3,8,11,19,20,0,0,163,1,33,163,1,40,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,
+0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,163,1,33,163,
+1,33,1,8,8,8,19,0,163,1,38,163,1,40,0,1,49,1,0,0,1,0,0,164,1,29,164,1,59,4,3,11,
+19,20,27,0,164,1,29,164,1,35,1,19,19,19,3,27,0,164,1,37,164,1,39,1,3,3,3,5,0,164,1,42,
+164,1,46,1,20,3,27,0,164,1,42,164,1,42,1,20,20,20,18,0,164,1,46,164,1,46,0,1,49,5,0,164,
+1,49,164,1,58,1,11,3,5,0,164,1,49,164,1,54,1,11,0,27,0,164,1,49,164,1,49,1,11,11,11,18,
+0,164,1,53,164,1,54,0,2,49,48,18,0,164,1,58,164,1,58,0,1,49,0,7,0,165,1,30,182,1,42,6,
+0,3,8,11,19,20,0,0,165,1,33,165,1,40,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,
+0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,165,1,33,
+165,1,33,1,8,8,8,19,0,165,1,38,165,1,40,0,1,50,1,0,0,1,0,0,166,1,29,166,1,59,4,3,
+11,19,20,27,0,166,1,29,166,1,35,1,19,19,19,3,27,0,166,1,37,166,1,39,1,3,3,3,5,0,166,1,
+42,166,1,46,1,20,3,27,0,166,1,42,166,1,42,1,20,20,20,18,0,166,1,46,166,1,46,0,1,49,5,0,
+166,1,49,166,1,58,1,11,3,5,0,166,1,49,166,1,54,1,11,0,27,0,166,1,49,166,1,49,1,11,11,11,
+18,0,166,1,53,166,1,54,0,2,49,48,18,0,166,1,58,166,1,58,0,1,50,0,7,0,167,1,30,182,1,42,
+6,0,3,8,11,19,20,0,0,167,1,33,167,1,40,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,
+1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,167,1,
+33,167,1,33,1,8,8,8,19,0,167,1,38,167,1,40,0,1,51,1,0,0,1,0,0,168,1,29,168,1,59,4,
+3,11,19,20,27,0,168,1,29,168,1,35,1,19,19,19,3,27,0,168,1,37,168,1,39,1,3,3,3,5,0,168,
+1,42,168,1,46,1,20,3,27,0,168,1,42,168,1,42,1,20,20,20,18,0,168,1,46,168,1,46,0,1,49,5,
+0,168,1,49,168,1,58,1,11,3,5,0,168,1,49,168,1,54,1,11,0,27,0,168,1,49,168,1,49,1,11,11,
+11,18,0,168,1,53,168,1,54,0,2,49,48,18,0,168,1,58,168,1,58,0,1,51,0,7,0,169,1,30,182,1,
+42,6,0,3,8,11,19,20,0,0,169,1,33,169,1,40,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,
+0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,169,
+1,33,169,1,33,1,8,8,8,19,0,169,1,38,169,1,40,0,1,52,1,0,0,1,0,0,170,1,29,170,1,59,
+4,3,11,19,20,27,0,170,1,29,170,1,35,1,19,19,19,3,27,0,170,1,37,170,1,39,1,3,3,3,5,0,
+170,1,42,170,1,46,1,20,3,27,0,170,1,42,170,1,42,1,20,20,20,18,0,170,1,46,170,1,46,0,1,49,
+5,0,170,1,49,170,1,58,1,11,3,5,0,170,1,49,170,1,54,1,11,0,27,0,170,1,49,170,1,49,1,11,
+11,11,18,0,170,1,53,170,1,54,0,2,49,48,18,0,170,1,58,170,1,58,0,1,52,0,7,0,171,1,30,182,
+1,42,6,0,3,8,11,19,20,0,0,171,1,33,171,1,40,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,
+0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,
+171,1,33,171,1,33,1,8,8,8,19,0,171,1,38,171,1,40,0,1,53,1,0,0,1,0,0,172,1,29,172,1,
+59,4,3,11,19,20,27,0,172,1,29,172,1,35,1,19,19,19,3,27,0,172,1,37,172,1,39,1,3,3,3,5,
+0,172,1,42,172,1,46,1,20,3,27,0,172,1,42,172,1,42,1,20,20,20,18,0,172,1,46,172,1,46,0,1,
+49,5,0,172,1,49,172,1,58,1,11,3,5,0,172,1,49,172,1,54,1,11,0,27,0,172,1,49,172,1,49,1,
+11,11,11,18,0,172,1,53,172,1,54,0,2,49,48,18,0,172,1,58,172,1,58,0,1,53,0,7,0,173,1,30,
+182,1,42,6,0,3,8,11,19,20,0,0,173,1,33,173,1,40,2,0,8,14,1,0,0,0,0,1,0,27,1,0,
+0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,
+0,173,1,33,173,1,33,1,8,8,8,19,0,173,1,38,173,1,40,0,1,54,1,0,0,1,0,0,174,1,29,174,
+1,59,4,3,11,19,20,27,0,174,1,29,174,1,35,1,19,19,19,3,27,0,174,1,37,174,1,39,1,3,3,3,
+5,0,174,1,42,174,1,46,1,20,3,27,0,174,1,42,174,1,42,1,20,20,20,18,0,174,1,46,174,1,46,0,
+1,49,5,0,174,1,49,174,1,58,1,11,3,5,0,174,1,49,174,1,54,1,11,0,27,0,174,1,49,174,1,49,
+1,11,11,11,18,0,174,1,53,174,1,54,0,2,49,48,18,0,174,1,58,174,1,58,0,1,54,0,7,0,175,1,
+30,182,1,42,6,0,3,8,11,19,20,0,0,175,1,33,175,1,40,2,0,8,14,1,0,0,0,0,1,0,27,1,
+0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,
+27,0,175,1,33,175,1,33,1,8,8,8,19,0,175,1,38,175,1,40,0,1,55,1,0,0,1,0,0,176,1,29,
+176,1,59,4,3,11,19,20,27,0,176,1,29,176,1,35,1,19,19,19,3,27,0,176,1,37,176,1,39,1,3,3,
+3,5,0,176,1,42,176,1,46,1,20,3,27,0,176,1,42,176,1,42,1,20,20,20,18,0,176,1,46,176,1,46,
+0,1,49,5,0,176,1,49,176,1,58,1,11,3,5,0,176,1,49,176,1,54,1,11,0,27,0,176,1,49,176,1,
+49,1,11,11,11,18,0,176,1,53,176,1,54,0,2,49,48,18,0,176,1,58,176,1,58,0,1,55,0,7,0,177,
+1,30,182,1,42,6,0,3,8,11,19,20,0,0,177,1,33,177,1,40,2,0,8,14,1,0,0,0,0,1,0,27,
+1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,
+2,27,0,177,1,33,177,1,33,1,8,8,8,19,0,177,1,38,177,1,40,0,1,56,1,0,0,1,0,0,178,1,
+29,178,1,59,4,3,11,19,20,27,0,178,1,29,178,1,35,1,19,19,19,3,27,0,178,1,37,178,1,39,1,3,
+3,3,5,0,178,1,42,178,1,46,1,20,3,27,0,178,1,42,178,1,42,1,20,20,20,18,0,178,1,46,178,1,
+46,0,1,49,5,0,178,1,49,178,1,58,1,11,3,5,0,178,1,49,178,1,54,1,11,0,27,0,178,1,49,178,
+1,49,1,11,11,11,18,0,178,1,53,178,1,54,0,2,49,48,18,0,178,1,58,178,1,58,0,1,56,0,7,0,
+179,1,30,182,1,42,6,0,3,8,11,19,20,0,0,179,1,33,179,1,40,2,0,8,14,1,0,0,0,0,1,0,
+27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,
+0,2,27,0,179,1,33,179,1,33,1,8,8,8,19,0,179,1,38,179,1,40,0,1,57,1,0,0,1,0,0,180,
+1,29,180,1,59,4,3,11,19,20,27,0,180,1,29,180,1,35,1,19,19,19,3,27,0,180,1,37,180,1,39,1,
+3,3,3,5,0,180,1,42,180,1,46,1,20,3,27,0,180,1,42,180,1,42,1,20,20,20,18,0,180,1,46,180,
+1,46,0,1,49,5,0,180,1,49,180,1,58,1,11,3,5,0,180,1,49,180,1,54,1,11,0,27,0,180,1,49,
+180,1,49,1,11,11,11,18,0,180,1,53,180,1,54,0,2,49,48,18,0,180,1,58,180,1,58,0,1,57,0,8,
+0,182,1,29,182,1,42,2,11,20,0,2,1,19,1,0,0,0,0,0,1,105,1,0,0,27,0,182,1,34,182,1,
+34,1,20,20,20,1,19,1,0,0,0,0,0,1,118,1,0,0,27,0,182,1,40,182,1,40,1,11,11,11,0,0,
+183,1,17,183,1,34,3,3,6,19,27,0,183,1,17,183,1,23,1,19,19,19,3,27,0,183,1,25,183,1,27,1,
+3,3,3,27,0,183,1,30,183,1,30,1,6,6,6,18,0,183,1,33,183,1,33,0,1,48,0,15,0,185,1,9,
+152,4,53,6,0,3,17,18,21,22,1,23,11,0,185,1,9,152,4,53,2,0,22,2,3,6,7,0,186,1,13,193,
+1,37,4,0,3,6,22,5,0,186,1,16,186,1,35,3,0,3,6,8,27,0,186,1,16,186,1,16,1,6,6,6,
+0,0,186,1,21,186,1,35,2,0,3,14,0,186,1,21,186,1,30,1,0,27,0,186,1,21,186,1,23,1,0,0,
+0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,186,1,32,186,1,
+34,1,3,3,3,0,10,0,187,1,17,187,1,46,0,19,0,187,1,23,187,1,46,0,22,84,114,117,110,99,97,116,
+101,100,32,102,111,114,109,97,116,32,99,111,100,101,46,1,0,0,15,0,189,1,17,193,1,37,4,0,3,6,22,1,
+8,14,0,189,1,27,189,1,32,2,3,6,27,0,189,1,27,189,1,29,1,3,3,3,0,27,0,189,1,31,189,1,
+31,1,6,6,6,254,1,254,1,0,7,0,190,1,17,193,1,37,5,0,3,6,8,22,0,0,190,1,20,190,1,27,
+2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,
+117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,190,1,20,190,1,20,1,8,8,8,19,0,190,1,25,190,1,
+27,0,1,46,1,0,0,1,0,0,191,1,21,191,1,53,3,3,6,22,27,0,191,1,21,191,1,41,1,22,22,22,
+2,27,0,191,1,43,191,1,45,1,3,3,3,5,0,191,1,48,191,1,52,1,6,3,27,0,191,1,48,191,1,48,
+1,6,6,6,18,0,191,1,52,191,1,52,0,1,49,0,8,0,193,1,21,193,1,37,1,6,0,2,1,19,1,0,
+0,0,0,0,1,105,1,0,0,27,0,193,1,26,193,1,26,1,6,6,6,1,19,1,0,0,0,0,0,1,118,1,
+0,0,17,0,193,1,32,193,1,35,0,15,0,196,1,9,152,4,53,7,0,3,17,18,21,22,23,1,24,11,0,196,
+1,9,152,4,53,1,0,2,3,6,7,0,197,1,13,204,1,21,3,0,3,6,5,0,197,1,16,197,1,35,3,0,
+3,6,8,27,0,197,1,16,197,1,16,1,6,6,6,0,0,197,1,21,197,1,35,2,0,3,14,0,197,1,21,197,
+1,30,1,0,27,0,197,1,21,197,1,23,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,
+0,0,254,1,254,1,0,1,27,0,197,1,32,197,1,34,1,3,3,3,0,10,0,198,1,17,198,1,46,0,19,0,
+198,1,23,198,1,46,0,22,84,114,117,110,99,97,116,101,100,32,102,111,114,109,97,116,32,99,111,100,101,46,1,0,
+0,15,0,200,1,17,204,1,21,3,0,3,6,1,8,14,0,200,1,27,200,1,32,2,3,6,27,0,200,1,27,200,
+1,29,1,3,3,3,0,27,0,200,1,31,200,1,31,1,6,6,6,254,1,254,1,0,7,0,201,1,17,204,1,21,
+3,0,6,8,5,0,201,1,20,201,1,51,2,0,8,17,5,0,201,1,20,201,1,39,2,0,8,17,0,0,201,1,
+20,201,1,27,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,201,1,20,201,1,20,1,8,8,8,19,0,201,
+1,25,201,1,27,0,1,104,1,0,0,1,0,0,201,1,32,201,1,39,2,0,8,14,1,0,0,0,0,1,0,27,
+1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,
+2,27,0,201,1,32,201,1,32,1,8,8,8,19,0,201,1,37,201,1,39,0,1,108,1,0,0,1,0,0,201,1,
+44,201,1,51,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,201,1,44,201,1,44,1,8,8,8,19,0,201,
+1,49,201,1,51,0,1,76,1,0,0,1,5,0,202,1,21,202,1,25,1,6,3,27,0,202,1,21,202,1,21,1,
+6,6,6,18,0,202,1,25,202,1,25,0,1,49,27,0,204,1,21,204,1,21,1,6,6,6,15,0,206,1,9,152,
+4,53,8,0,3,17,18,21,22,23,24,1,25,11,0,206,1,9,152,4,53,1,0,2,3,6,7,0,207,1,13,238,
+1,62,3,0,3,6,5,0,207,1,16,207,1,35,3,0,3,6,8,27,0,207,1,16,207,1,16,1,6,6,6,0,
+0,207,1,21,207,1,35,2,0,3,14,0,207,1,21,207,1,30,1,0,27,0,207,1,21,207,1,23,1,0,0,0,
+0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,207,1,32,207,1,34,
+1,3,3,3,0,10,0,208,1,17,208,1,46,0,19,0,208,1,23,208,1,46,0,22,84,114,117,110,99,97,116,101,
+100,32,102,111,114,109,97,116,32,99,111,100,101,46,1,0,0,15,0,210,1,17,238,1,62,3,0,3,6,1,8,14,
+0,210,1,27,210,1,32,2,3,6,27,0,210,1,27,210,1,29,1,3,3,3,0,27,0,210,1,31,210,1,31,1,
+6,6,6,254,1,254,1,0,7,0,211,1,17,238,1,62,3,0,6,8,5,0,211,1,20,211,1,51,2,0,8,17,
+5,0,211,1,20,211,1,39,2,0,8,17,0,0,211,1,20,211,1,27,2,0,8,14,1,0,0,0,0,1,0,27,
+1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,
+2,27,0,211,1,20,211,1,20,1,8,8,8,19,0,211,1,25,211,1,27,0,1,100,1,0,0,1,0,0,211,1,
+32,211,1,39,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,211,1,32,211,1,32,1,8,8,8,19,0,211,
+1,37,211,1,39,0,1,105,1,0,0,1,0,0,211,1,44,211,1,51,2,0,8,14,1,0,0,0,0,1,0,27,
+1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,
+2,27,0,211,1,44,211,1,44,1,8,8,8,19,0,211,1,49,211,1,51,0,1,117,1,0,0,1,8,0,212,1,
+21,212,1,53,1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,212,1,26,212,1,30,1,6,3,
+27,0,212,1,26,212,1,26,1,6,6,6,18,0,212,1,30,212,1,30,0,1,49,1,19,1,0,0,0,0,0,1,
+118,1,0,0,19,0,212,1,36,212,1,38,0,1,100,1,0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,
+0,0,16,0,212,1,47,212,1,51,0,0,7,0,213,1,22,238,1,62,3,0,6,8,0,0,213,1,25,213,1,32,
+2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,
+117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,213,1,25,213,1,25,1,8,8,8,19,0,213,1,30,213,1,
+32,0,1,111,1,0,0,1,8,0,214,1,21,214,1,53,1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,
+0,5,0,214,1,26,214,1,30,1,6,3,27,0,214,1,26,214,1,26,1,6,6,6,18,0,214,1,30,214,1,30,
+0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,214,1,36,214,1,38,0,1,111,1,0,0,1,19,
+1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,214,1,47,214,1,51,0,0,7,0,215,1,22,238,1,62,
+3,0,6,8,0,0,215,1,25,215,1,32,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,
+0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,215,1,25,215,1,
+25,1,8,8,8,19,0,215,1,30,215,1,32,0,1,120,1,0,0,1,8,0,216,1,21,216,1,53,1,6,0,3,
+1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,216,1,26,216,1,30,1,6,3,27,0,216,1,26,216,1,26,
+1,6,6,6,18,0,216,1,30,216,1,30,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,216,1,
+36,216,1,38,0,1,120,1,0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,216,1,47,216,
+1,51,0,0,7,0,217,1,22,238,1,62,3,0,6,8,0,0,217,1,25,217,1,32,2,0,8,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,
+1,254,1,0,2,27,0,217,1,25,217,1,25,1,8,8,8,19,0,217,1,30,217,1,32,0,1,88,1,0,0,1,
+8,0,218,1,21,218,1,52,1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,218,1,26,218,1,
+30,1,6,3,27,0,218,1,26,218,1,26,1,6,6,6,18,0,218,1,30,218,1,30,0,1,49,1,19,1,0,0,
+0,0,0,1,118,1,0,0,19,0,218,1,36,218,1,38,0,1,120,1,0,0,1,19,1,0,0,0,0,0,4,99,
+97,112,115,1,0,0,16,0,218,1,47,218,1,50,0,1,7,0,219,1,22,238,1,62,3,0,6,8,0,0,219,1,
+25,219,1,32,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,219,1,25,219,1,25,1,8,8,8,19,0,219,
+1,30,219,1,32,0,1,101,1,0,0,1,8,0,220,1,21,220,1,53,1,6,0,3,1,19,1,0,0,0,0,0,
+1,105,1,0,0,5,0,220,1,26,220,1,30,1,6,3,27,0,220,1,26,220,1,26,1,6,6,6,18,0,220,1,
+30,220,1,30,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,220,1,36,220,1,38,0,1,101,1,
+0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,220,1,47,220,1,51,0,0,7,0,221,1,
+22,238,1,62,3,0,6,8,0,0,221,1,25,221,1,32,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,
+0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,221,
+1,25,221,1,25,1,8,8,8,19,0,221,1,30,221,1,32,0,1,69,1,0,0,1,8,0,222,1,21,222,1,52,
+1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,222,1,26,222,1,30,1,6,3,27,0,222,1,
+26,222,1,26,1,6,6,6,18,0,222,1,30,222,1,30,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,
+19,0,222,1,36,222,1,38,0,1,101,1,0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,
+222,1,47,222,1,50,0,1,7,0,223,1,22,238,1,62,3,0,6,8,0,0,223,1,25,223,1,32,2,0,8,14,
+1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,
+1,0,0,254,1,254,1,0,2,27,0,223,1,25,223,1,25,1,8,8,8,19,0,223,1,30,223,1,32,0,1,102,
+1,0,0,1,8,0,224,1,21,224,1,53,1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,224,
+1,26,224,1,30,1,6,3,27,0,224,1,26,224,1,26,1,6,6,6,18,0,224,1,30,224,1,30,0,1,49,1,
+19,1,0,0,0,0,0,1,118,1,0,0,19,0,224,1,36,224,1,38,0,1,102,1,0,0,1,19,1,0,0,0,
+0,0,4,99,97,112,115,1,0,0,16,0,224,1,47,224,1,51,0,0,7,0,225,1,22,238,1,62,3,0,6,8,
+0,0,225,1,25,225,1,32,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,
+0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,225,1,25,225,1,25,1,8,8,
+8,19,0,225,1,30,225,1,32,0,1,70,1,0,0,1,8,0,226,1,21,226,1,52,1,6,0,3,1,19,1,0,
+0,0,0,0,1,105,1,0,0,5,0,226,1,26,226,1,30,1,6,3,27,0,226,1,26,226,1,26,1,6,6,6,
+18,0,226,1,30,226,1,30,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,226,1,36,226,1,38,
+0,1,102,1,0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,226,1,47,226,1,50,0,1,
+7,0,227,1,22,238,1,62,3,0,6,8,0,0,227,1,25,227,1,32,2,0,8,14,1,0,0,0,0,1,0,27,
+1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,
+2,27,0,227,1,25,227,1,25,1,8,8,8,19,0,227,1,30,227,1,32,0,1,103,1,0,0,1,8,0,228,1,
+21,228,1,53,1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,228,1,26,228,1,30,1,6,3,
+27,0,228,1,26,228,1,26,1,6,6,6,18,0,228,1,30,228,1,30,0,1,49,1,19,1,0,0,0,0,0,1,
+118,1,0,0,19,0,228,1,36,228,1,38,0,1,103,1,0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,
+0,0,16,0,228,1,47,228,1,51,0,0,7,0,229,1,22,238,1,62,3,0,6,8,0,0,229,1,25,229,1,32,
+2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,
+117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,229,1,25,229,1,25,1,8,8,8,19,0,229,1,30,229,1,
+32,0,1,71,1,0,0,1,8,0,230,1,21,230,1,52,1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,
+0,5,0,230,1,26,230,1,30,1,6,3,27,0,230,1,26,230,1,26,1,6,6,6,18,0,230,1,30,230,1,30,
+0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,230,1,36,230,1,38,0,1,103,1,0,0,1,19,
+1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,230,1,47,230,1,50,0,1,7,0,231,1,22,238,1,62,
+3,0,6,8,0,0,231,1,25,231,1,32,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,
+0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,231,1,25,231,1,
+25,1,8,8,8,19,0,231,1,30,231,1,32,0,1,99,1,0,0,1,8,0,232,1,21,232,1,53,1,6,0,3,
+1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,232,1,26,232,1,30,1,6,3,27,0,232,1,26,232,1,26,
+1,6,6,6,18,0,232,1,30,232,1,30,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,232,1,
+36,232,1,38,0,1,99,1,0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,232,1,47,232,
+1,51,0,0,7,0,233,1,22,238,1,62,3,0,6,8,0,0,233,1,25,233,1,32,2,0,8,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,
+1,254,1,0,2,27,0,233,1,25,233,1,25,1,8,8,8,19,0,233,1,30,233,1,32,0,1,115,1,0,0,1,
+8,0,234,1,21,234,1,53,1,6,0,3,1,19,1,0,0,0,0,0,1,105,1,0,0,5,0,234,1,26,234,1,
+30,1,6,3,27,0,234,1,26,234,1,26,1,6,6,6,18,0,234,1,30,234,1,30,0,1,49,1,19,1,0,0,
+0,0,0,1,118,1,0,0,19,0,234,1,36,234,1,38,0,1,115,1,0,0,1,19,1,0,0,0,0,0,4,99,
+97,112,115,1,0,0,16,0,234,1,47,234,1,51,0,0,7,0,235,1,22,238,1,62,3,0,6,8,0,0,235,1,
+25,235,1,32,2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,235,1,25,235,1,25,1,8,8,8,19,0,235,
+1,30,235,1,32,0,1,37,1,0,0,1,8,0,236,1,21,236,1,53,1,6,0,3,1,19,1,0,0,0,0,0,
+1,105,1,0,0,5,0,236,1,26,236,1,30,1,6,3,27,0,236,1,26,236,1,26,1,6,6,6,18,0,236,1,
+30,236,1,30,0,1,49,1,19,1,0,0,0,0,0,1,118,1,0,0,19,0,236,1,36,236,1,38,0,1,37,1,
+0,0,1,19,1,0,0,0,0,0,4,99,97,112,115,1,0,0,16,0,236,1,47,236,1,51,0,0,10,0,238,1,
+21,238,1,62,1,8,5,0,238,1,27,238,1,62,1,8,3,19,0,238,1,27,238,1,58,0,30,85,110,114,101,99,
+111,103,110,105,115,101,100,32,99,111,110,118,101,114,115,105,111,110,32,116,121,112,101,58,32,1,0,0,27,0,238,1,
+62,238,1,62,1,8,8,8,15,0,242,1,9,152,4,53,9,0,3,17,18,21,22,23,24,25,1,26,11,0,242,1,
+9,152,4,53,7,0,18,21,22,23,24,25,2,3,6,7,0,243,1,13,134,2,17,9,0,3,6,18,21,22,23,24,
+25,5,0,243,1,16,243,1,35,3,0,3,6,8,27,0,243,1,16,243,1,16,1,6,6,6,0,0,243,1,21,243,
+1,35,2,0,3,14,0,243,1,21,243,1,30,1,0,27,0,243,1,21,243,1,23,1,0,0,0,0,19,1,0,0,
+0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,243,1,32,243,1,34,1,3,3,3,0,
+10,0,244,1,17,244,1,46,0,19,0,244,1,23,244,1,46,0,22,84,114,117,110,99,97,116,101,100,32,102,111,114,
+109,97,116,32,99,111,100,101,46,1,0,0,15,0,246,1,17,134,2,17,8,3,6,18,21,22,23,24,25,1,27,0,
+0,246,1,30,246,1,58,3,3,6,18,27,0,246,1,30,246,1,50,1,18,18,18,2,27,0,246,1,52,246,1,54,
+1,3,3,3,27,0,246,1,57,246,1,57,1,6,6,6,0,15,0,247,1,17,134,2,17,7,3,21,22,23,24,25,
+27,1,28,0,0,247,1,32,247,1,60,3,3,21,27,27,0,247,1,32,247,1,47,1,21,21,21,2,27,0,247,1,
+49,247,1,51,1,3,3,3,14,0,247,1,54,247,1,59,1,27,27,0,247,1,54,247,1,57,1,27,27,27,0,19,
+1,0,0,0,0,0,1,105,1,0,0,254,1,254,1,0,0,15,0,248,1,17,134,2,17,7,3,22,23,24,25,27,
+28,1,29,0,0,248,1,28,248,1,63,3,3,22,28,27,0,248,1,28,248,1,48,1,22,22,22,2,27,0,248,1,
+50,248,1,52,1,3,3,3,14,0,248,1,55,248,1,62,1,28,27,0,248,1,55,248,1,60,1,28,28,28,0,19,
+1,0,0,0,0,0,1,105,1,0,0,254,1,254,1,0,0,15,0,249,1,17,134,2,17,7,3,23,24,25,27,28,
+29,1,30,0,0,249,1,30,249,1,59,3,3,23,29,27,0,249,1,30,249,1,48,1,23,23,23,2,27,0,249,1,
+50,249,1,52,1,3,3,3,14,0,249,1,55,249,1,58,1,29,27,0,249,1,55,249,1,56,1,29,29,29,0,19,
+1,0,0,0,0,0,1,105,1,0,0,254,1,254,1,0,0,15,0,250,1,17,134,2,17,7,3,24,25,27,28,29,
+30,1,31,0,0,250,1,33,250,1,70,3,3,24,30,27,0,250,1,33,250,1,57,1,24,24,24,2,27,0,250,1,
+59,250,1,61,1,3,3,3,14,0,250,1,64,250,1,69,1,30,27,0,250,1,64,250,1,67,1,30,30,30,0,19,
+1,0,0,0,0,0,1,105,1,0,0,254,1,254,1,0,0,15,0,251,1,17,134,2,17,7,3,25,27,28,29,30,
+31,1,32,0,0,251,1,31,251,1,59,3,3,25,31,27,0,251,1,31,251,1,45,1,25,25,25,2,27,0,251,1,
+47,251,1,49,1,3,3,3,27,0,251,1,52,251,1,58,1,31,31,31,0,8,0,252,1,17,134,2,17,5,27,28,
+29,30,32,0,2,1,19,1,0,0,0,0,0,1,105,1,0,0,14,0,253,1,24,253,1,30,1,32,27,0,253,1,
+24,253,1,28,1,32,32,32,0,19,1,0,0,0,0,0,1,105,1,0,0,254,1,254,1,0,1,19,1,0,0,0,
+0,0,4,99,111,100,101,1,0,0,8,0,254,1,27,133,2,21,5,27,28,29,30,32,0,6,1,19,1,0,0,0,
+0,0,4,109,107,101,121,1,0,0,14,0,255,1,31,255,1,36,1,27,27,0,255,1,31,255,1,34,1,27,27,27,
+0,19,1,0,0,0,0,0,1,118,1,0,0,254,1,254,1,0,1,19,1,0,0,0,0,0,6,99,102,108,97,103,
+115,1,0,0,14,0,128,2,33,128,2,40,1,28,27,0,128,2,33,128,2,38,1,28,28,28,0,19,1,0,0,0,
+0,0,1,118,1,0,0,254,1,254,1,0,1,19,1,0,0,0,0,0,2,102,119,1,0,0,14,0,129,2,29,129,
+2,32,1,29,27,0,129,2,29,129,2,30,1,29,29,29,0,19,1,0,0,0,0,0,1,118,1,0,0,254,1,254,
+1,0,1,19,1,0,0,0,0,0,4,112,114,101,99,1,0,0,14,0,130,2,31,130,2,36,1,30,27,0,130,2,
+31,130,2,34,1,30,30,30,0,19,1,0,0,0,0,0,1,118,1,0,0,254,1,254,1,0,1,19,1,0,0,0,
+0,0,5,99,116,121,112,101,1,0,0,14,0,131,2,32,131,2,38,1,32,27,0,131,2,32,131,2,36,1,32,32,
+32,0,19,1,0,0,0,0,0,1,118,1,0,0,254,1,254,1,0,1,19,1,0,0,0,0,0,4,99,97,112,115,
+1,0,0,14,0,132,2,31,132,2,40,1,32,27,0,132,2,31,132,2,35,1,32,32,32,0,19,1,0,0,0,0,
+0,4,99,97,112,115,1,0,0,254,1,254,1,0,15,0,137,2,9,152,4,53,4,0,3,17,26,1,33,11,0,137,
+2,9,152,4,53,3,0,26,33,4,3,6,34,35,7,0,138,2,13,146,2,57,7,0,3,6,26,33,34,35,5,0,
+138,2,16,138,2,35,3,0,3,6,8,27,0,138,2,16,138,2,16,1,6,6,6,0,0,138,2,21,138,2,35,2,
+0,3,14,0,138,2,21,138,2,30,1,0,27,0,138,2,21,138,2,23,1,0,0,0,0,19,1,0,0,0,0,0,
+6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,138,2,32,138,2,34,1,3,3,3,0,5,0,139,
+2,17,139,2,27,2,34,35,3,27,0,139,2,17,139,2,19,1,34,34,34,1,0,139,2,23,139,2,27,1,35,1,
+27,0,139,2,24,139,2,26,1,35,35,35,15,0,141,2,17,146,2,57,7,0,3,6,26,33,34,35,1,8,14,0,
+141,2,27,141,2,32,2,3,6,27,0,141,2,27,141,2,29,1,3,3,3,0,27,0,141,2,31,141,2,31,1,6,
+6,6,254,1,254,1,0,7,0,142,2,17,146,2,57,8,0,3,6,8,26,33,34,35,0,0,142,2,20,142,2,27,
+2,0,8,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,
+117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,142,2,20,142,2,20,1,8,8,8,19,0,142,2,25,142,2,
+27,0,1,37,1,0,0,1,15,0,143,2,21,144,2,66,6,3,6,26,33,34,35,1,36,0,0,143,2,31,143,2,
+52,3,3,6,26,27,0,143,2,31,143,2,40,1,26,26,26,2,27,0,143,2,42,143,2,44,1,3,3,3,5,0,
+143,2,47,143,2,51,1,6,3,27,0,143,2,47,143,2,47,1,6,6,6,18,0,143,2,51,143,2,51,0,1,49,
+0,0,0,144,2,21,144,2,66,5,3,33,34,35,36,27,0,144,2,21,144,2,31,1,33,33,33,4,27,0,144,2,
+33,144,2,35,1,3,3,3,14,0,144,2,38,144,2,40,1,36,27,0,144,2,38,144,2,38,1,36,36,36,0,19,
+1,0,0,0,0,0,1,105,1,0,0,254,1,254,1,0,5,0,144,2,43,144,2,61,3,34,35,36,3,27,0,144,
+2,43,144,2,45,1,34,34,34,1,0,144,2,49,144,2,61,2,35,36,2,27,0,144,2,50,144,2,52,1,35,35,
+35,14,0,144,2,55,144,2,60,1,36,27,0,144,2,55,144,2,55,1,36,36,36,0,19,1,0,0,0,0,0,4,
+99,111,100,101,1,0,0,254,1,254,1,0,19,0,144,2,64,144,2,65,0,0,1,0,0,1,0,0,146,2,21,146,
+2,57,6,3,6,8,33,34,35,27,0,146,2,21,146,2,31,1,33,33,33,4,27,0,146,2,33,146,2,35,1,3,
+3,3,5,0,146,2,38,146,2,42,1,6,3,27,0,146,2,38,146,2,38,1,6,6,6,18,0,146,2,42,146,2,
+42,0,1,49,27,0,146,2,45,146,2,47,1,34,34,34,5,0,146,2,50,146,2,56,2,8,35,3,27,0,146,2,
+50,146,2,52,1,35,35,35,27,0,146,2,56,146,2,56,1,8,8,8,1,15,0,148,2,9,152,4,53,4,0,3,
+17,33,1,37,0,0,148,2,23,148,2,49,2,3,33,27,0,148,2,23,148,2,33,1,33,33,33,4,27,0,148,2,
+35,148,2,37,1,3,3,3,18,0,148,2,40,148,2,40,0,1,48,1,0,148,2,43,148,2,44,0,0,19,0,148,
+2,47,148,2,48,0,0,1,0,0,0,15,0,156,2,9,152,4,53,3,0,17,37,1,38,11,0,156,2,9,152,4,
+53,0,2,39,40,15,0,157,2,13,162,2,22,2,39,40,1,14,11,0,157,2,13,162,2,22,2,14,40,2,39,11,
+7,0,158,2,17,161,2,37,4,11,14,39,40,5,0,158,2,20,158,2,25,1,39,10,27,0,158,2,20,158,2,20,
+1,39,39,39,18,0,158,2,25,158,2,25,0,1,48,27,0,159,2,21,159,2,21,1,11,11,11,0,0,161,2,21,
+161,2,37,4,11,14,39,40,27,0,161,2,21,161,2,23,1,14,14,14,2,5,0,161,2,25,161,2,29,1,39,4,
+27,0,161,2,25,161,2,25,1,39,39,39,18,0,161,2,29,161,2,29,0,1,49,5,0,161,2,32,161,2,36,2,
+11,40,3,27,0,161,2,32,161,2,32,1,11,11,11,27,0,161,2,36,161,2,36,1,40,40,40,0,0,0,162,2,
+13,162,2,22,2,14,39,27,0,162,2,13,162,2,15,1,14,14,14,2,27,0,162,2,17,162,2,17,1,39,39,39,
+19,0,162,2,20,162,2,21,0,0,1,0,0,0,15,0,165,2,9,152,4,53,4,0,17,37,38,1,41,11,0,165,
+2,9,152,4,53,2,0,38,3,3,39,40,5,0,166,2,13,166,2,49,5,0,3,38,39,40,3,0,0,166,2,13,
+166,2,43,5,0,3,38,39,40,27,0,166,2,13,166,2,19,1,38,38,38,2,5,0,166,2,21,166,2,39,3,0,
+3,39,4,27,0,166,2,21,166,2,21,1,39,39,39,0,0,166,2,25,166,2,39,2,0,3,14,0,166,2,25,166,
+2,34,1,0,27,0,166,2,25,166,2,27,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,
+0,0,254,1,254,1,0,1,27,0,166,2,36,166,2,38,1,3,3,3,0,27,0,166,2,42,166,2,42,1,40,40,
+40,0,27,0,166,2,47,166,2,49,1,3,3,3,15,0,169,2,9,152,4,53,5,0,17,37,38,41,1,42,11,0,
+169,2,9,152,4,53,2,0,38,3,3,39,40,5,0,170,2,13,170,2,49,5,0,3,38,39,40,3,27,0,170,2,
+13,170,2,15,1,3,3,3,0,0,170,2,19,170,2,49,5,0,3,38,39,40,27,0,170,2,19,170,2,25,1,38,
+38,38,2,5,0,170,2,27,170,2,45,3,0,3,39,4,27,0,170,2,27,170,2,27,1,39,39,39,0,0,170,2,
+31,170,2,45,2,0,3,14,0,170,2,31,170,2,40,1,0,27,0,170,2,31,170,2,33,1,0,0,0,0,19,1,
+0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,170,2,42,170,2,44,1,3,3,
+3,0,27,0,170,2,48,170,2,48,1,40,40,40,0,15,0,173,2,9,152,4,53,5,0,17,37,41,42,1,43,11,
+0,173,2,9,152,4,53,2,0,41,7,44,45,46,47,48,49,50,15,0,174,2,13,185,2,89,9,0,47,48,41,44,
+45,46,49,50,1,51,0,0,174,2,24,174,2,35,2,0,44,14,0,174,2,24,174,2,30,1,0,27,0,174,2,24,
+174,2,26,1,0,0,0,0,19,1,0,0,0,0,0,3,97,98,115,1,0,0,254,1,254,1,0,1,27,0,174,2,
+32,174,2,34,1,44,44,44,0,15,0,175,2,13,185,2,89,10,0,47,48,41,44,45,46,49,50,51,1,14,11,0,
+175,2,13,185,2,89,4,0,14,49,50,1,52,7,0,176,2,17,179,2,59,5,0,14,49,50,52,0,0,176,2,20,
+176,2,25,2,0,52,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,
+6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,176,2,20,176,2,20,1,52,52,52,18,0,176,2,
+25,176,2,25,0,1,48,1,27,0,177,2,21,177,2,31,1,50,50,50,5,0,179,2,21,179,2,59,4,0,14,49,
+52,3,0,0,179,2,21,179,2,45,4,0,14,49,52,27,0,179,2,21,179,2,23,1,14,14,14,1,0,0,179,2,
+25,179,2,44,3,0,49,52,14,0,179,2,25,179,2,33,1,0,27,0,179,2,25,179,2,27,1,0,0,0,0,19,
+1,0,0,0,0,0,5,102,108,111,111,114,1,0,0,254,1,254,1,0,1,5,0,179,2,35,179,2,43,2,49,52,
+1,27,0,179,2,35,179,2,35,1,52,52,52,27,0,179,2,39,179,2,43,1,49,49,49,0,0,0,0,179,2,50,
+179,2,58,3,0,49,52,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,3,109,111,100,1,0,0,254,1,254,1,0,2,27,0,179,2,50,179,2,50,1,52,52,52,27,0,179,2,54,179,
+2,58,1,49,49,49,0,15,0,180,2,13,185,2,89,9,0,14,47,48,41,44,45,46,51,1,53,7,0,180,2,25,
+180,2,78,3,0,14,51,0,0,180,2,28,180,2,45,2,0,51,14,1,0,0,0,0,1,0,27,1,0,0,0,0,
+1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,180,2,
+28,180,2,40,2,0,51,14,0,180,2,28,180,2,36,1,0,27,0,180,2,28,180,2,30,1,0,0,0,0,19,1,
+0,0,0,0,0,5,102,108,111,111,114,1,0,0,254,1,254,1,0,1,27,0,180,2,38,180,2,39,1,51,51,51,
+0,18,0,180,2,45,180,2,45,0,1,48,1,19,0,180,2,52,180,2,54,0,1,48,1,0,0,0,0,180,2,61,
+180,2,78,3,0,14,51,27,0,180,2,61,180,2,63,1,14,14,14,1,0,0,180,2,65,180,2,77,2,0,51,14,
+0,180,2,65,180,2,73,1,0,27,0,180,2,65,180,2,67,1,0,0,0,0,19,1,0,0,0,0,0,5,102,108,
+111,111,114,1,0,0,254,1,254,1,0,1,27,0,180,2,75,180,2,76,1,51,51,51,0,0,15,0,181,2,13,185,
+2,89,8,0,47,48,41,44,45,46,53,1,54,5,0,181,2,25,181,2,31,1,44,9,27,0,181,2,25,181,2,27,
+1,44,44,44,18,0,181,2,31,181,2,31,0,1,48,15,0,182,2,13,185,2,89,8,0,47,48,41,45,46,53,54,
+1,55,5,0,182,2,24,182,2,74,4,47,48,45,54,4,27,0,182,2,24,182,2,32,1,45,45,45,7,0,182,2,
+37,182,2,73,3,47,48,54,5,0,182,2,40,182,2,59,3,47,48,54,17,5,0,182,2,40,182,2,51,2,47,54,
+17,27,0,182,2,40,182,2,42,1,54,54,54,27,0,182,2,47,182,2,51,1,47,47,47,27,0,182,2,56,182,2,
+59,1,48,48,48,18,0,182,2,66,182,2,66,0,1,49,18,0,182,2,73,182,2,73,0,1,48,15,0,183,2,13,
+185,2,89,8,0,47,48,41,46,53,54,55,1,56,0,0,183,2,25,183,2,47,3,0,46,55,14,0,183,2,25,183,
+2,31,1,0,27,0,183,2,25,183,2,27,1,0,0,0,0,19,1,0,0,0,0,0,3,109,97,120,1,0,0,254,
+1,254,1,0,2,27,0,183,2,33,183,2,34,1,55,55,55,27,0,183,2,37,183,2,46,1,46,46,46,0,15,0,
+184,2,13,185,2,89,6,47,48,41,53,54,56,1,57,0,0,184,2,26,184,2,48,3,41,53,56,27,0,184,2,26,
+184,2,33,1,41,41,41,3,27,0,184,2,35,184,2,37,1,53,53,53,27,0,184,2,40,184,2,42,1,56,56,56,
+19,0,184,2,45,184,2,47,0,1,48,1,0,0,0,5,0,185,2,13,185,2,89,4,47,48,54,57,3,7,0,185,
+2,14,185,2,81,3,47,48,54,27,0,185,2,17,185,2,19,1,54,54,54,19,0,185,2,26,185,2,28,0,1,45,
+1,0,0,7,0,185,2,35,185,2,81,2,47,48,27,0,185,2,38,185,2,41,1,48,48,48,19,0,185,2,48,185,
+2,50,0,1,43,1,0,0,7,0,185,2,57,185,2,81,1,47,27,0,185,2,60,185,2,64,1,47,47,47,19,0,
+185,2,71,185,2,73,0,1,32,1,0,0,19,0,185,2,80,185,2,81,0,0,1,0,0,27,0,185,2,86,185,2,
+89,1,57,57,57,15,0,188,2,9,152,4,53,6,0,17,37,41,42,43,1,58,11,0,188,2,9,152,4,53,2,0,
+41,7,44,45,46,47,48,59,60,15,0,189,2,13,205,2,89,9,0,47,48,41,44,45,46,59,60,1,61,5,0,189,
+2,30,191,2,78,1,60,3,1,0,189,2,30,189,2,59,0,10,18,0,189,2,31,189,2,31,0,1,48,18,0,189,
+2,34,189,2,34,0,1,49,18,0,189,2,37,189,2,37,0,1,50,18,0,189,2,40,189,2,40,0,1,51,18,0,
+189,2,43,189,2,43,0,1,52,18,0,189,2,46,189,2,46,0,1,53,18,0,189,2,49,189,2,49,0,1,54,18,
+0,189,2,52,189,2,52,0,1,55,18,0,189,2,55,189,2,55,0,1,56,18,0,189,2,58,189,2,58,0,1,57,
+7,0,190,2,32,191,2,78,1,60,27,0,190,2,35,190,2,42,1,60,60,60,1,0,190,2,49,190,2,78,0,6,
+19,0,190,2,50,190,2,52,0,1,65,1,0,0,19,0,190,2,55,190,2,57,0,1,66,1,0,0,19,0,190,2,
+60,190,2,62,0,1,67,1,0,0,19,0,190,2,65,190,2,67,0,1,68,1,0,0,19,0,190,2,70,190,2,72,
+0,1,69,1,0,0,19,0,190,2,75,190,2,77,0,1,70,1,0,0,1,0,191,2,49,191,2,78,0,6,19,0,
+191,2,50,191,2,52,0,1,97,1,0,0,19,0,191,2,55,191,2,57,0,1,98,1,0,0,19,0,191,2,60,191,
+2,62,0,1,99,1,0,0,19,0,191,2,65,191,2,67,0,1,100,1,0,0,19,0,191,2,70,191,2,72,0,1,
+101,1,0,0,19,0,191,2,75,191,2,77,0,1,102,1,0,0,15,0,192,2,13,205,2,89,10,0,47,48,41,44,
+45,46,59,60,61,1,51,0,0,192,2,24,192,2,35,2,0,44,14,0,192,2,24,192,2,30,1,0,27,0,192,2,
+24,192,2,26,1,0,0,0,0,19,1,0,0,0,0,0,3,97,98,115,1,0,0,254,1,254,1,0,1,27,0,192,
+2,32,192,2,34,1,44,44,44,0,15,0,193,2,13,205,2,89,11,0,47,48,41,44,45,46,51,59,60,61,1,14,
+11,0,193,2,13,205,2,89,3,0,14,61,1,52,7,0,194,2,17,197,2,61,4,0,14,52,61,0,0,194,2,20,
+194,2,25,2,0,52,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,
+6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,194,2,20,194,2,20,1,52,52,52,18,0,194,2,
+25,194,2,25,0,1,48,1,19,0,195,2,21,195,2,22,0,0,1,0,0,5,0,197,2,21,197,2,61,4,0,14,
+52,61,3,0,0,197,2,21,197,2,42,3,0,14,52,27,0,197,2,21,197,2,23,1,14,14,14,1,0,0,197,2,
+25,197,2,41,2,0,52,14,0,197,2,25,197,2,33,1,0,27,0,197,2,25,197,2,27,1,0,0,0,0,19,1,
+0,0,0,0,0,5,102,108,111,111,114,1,0,0,254,1,254,1,0,1,5,0,197,2,35,197,2,40,1,52,1,27,
+0,197,2,35,197,2,35,1,52,52,52,18,0,197,2,39,197,2,40,0,2,49,54,0,0,14,0,197,2,46,197,2,
+61,3,0,52,61,27,0,197,2,46,197,2,53,1,61,61,61,0,0,0,197,2,55,197,2,60,2,0,52,14,1,0,
+0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,0,0,254,1,
+254,1,0,2,27,0,197,2,55,197,2,55,1,52,52,52,18,0,197,2,59,197,2,60,0,2,49,54,0,254,1,254,
+1,0,15,0,198,2,13,205,2,89,11,0,14,47,48,41,44,45,46,51,59,60,1,62,7,0,198,2,25,198,2,78,
+3,0,14,51,0,0,198,2,28,198,2,45,2,0,51,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,
+0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,198,2,28,198,2,
+40,2,0,51,14,0,198,2,28,198,2,36,1,0,27,0,198,2,28,198,2,30,1,0,0,0,0,19,1,0,0,0,
+0,0,5,102,108,111,111,114,1,0,0,254,1,254,1,0,1,27,0,198,2,38,198,2,39,1,51,51,51,0,18,0,
+198,2,45,198,2,45,0,1,48,1,19,0,198,2,52,198,2,54,0,1,48,1,0,0,0,0,198,2,61,198,2,78,
+3,0,14,51,27,0,198,2,61,198,2,63,1,14,14,14,1,0,0,198,2,65,198,2,77,2,0,51,14,0,198,2,
+65,198,2,73,1,0,27,0,198,2,65,198,2,67,1,0,0,0,0,19,1,0,0,0,0,0,5,102,108,111,111,114,
+1,0,0,254,1,254,1,0,1,27,0,198,2,75,198,2,76,1,51,51,51,0,0,15,0,199,2,13,205,2,89,10,
+0,47,48,41,44,45,46,59,60,62,1,54,5,0,199,2,25,199,2,31,1,44,9,27,0,199,2,25,199,2,27,1,
+44,44,44,18,0,199,2,31,199,2,31,0,1,48,15,0,200,2,13,205,2,89,10,0,47,48,41,45,46,54,59,60,
+62,1,55,5,0,200,2,24,201,2,63,5,47,48,45,54,59,4,5,0,200,2,24,200,2,74,4,47,48,45,54,4,
+27,0,200,2,24,200,2,32,1,45,45,45,7,0,200,2,37,200,2,73,3,47,48,54,5,0,200,2,40,200,2,59,
+3,47,48,54,17,5,0,200,2,40,200,2,51,2,47,54,17,27,0,200,2,40,200,2,42,1,54,54,54,27,0,200,
+2,47,200,2,51,1,47,47,47,27,0,200,2,56,200,2,59,1,48,48,48,18,0,200,2,66,200,2,66,0,1,49,
+18,0,200,2,73,200,2,73,0,1,48,7,0,201,2,37,201,2,62,1,59,27,0,201,2,40,201,2,48,1,59,59,
+59,18,0,201,2,55,201,2,55,0,1,50,18,0,201,2,62,201,2,62,0,1,48,15,0,202,2,13,205,2,89,10,
+0,47,48,41,46,54,55,59,60,62,1,56,0,0,202,2,25,202,2,47,3,0,46,55,14,0,202,2,25,202,2,31,
+1,0,27,0,202,2,25,202,2,27,1,0,0,0,0,19,1,0,0,0,0,0,3,109,97,120,1,0,0,254,1,254,
+1,0,2,27,0,202,2,33,202,2,34,1,55,55,55,27,0,202,2,37,202,2,46,1,46,46,46,0,15,0,203,2,
+13,205,2,89,8,47,48,41,54,56,59,60,62,1,63,5,0,203,2,26,204,2,50,5,41,56,59,60,62,3,7,0,
+203,2,27,203,2,85,2,59,60,27,0,203,2,30,203,2,38,1,59,59,59,7,0,203,2,46,203,2,76,1,60,27,
+0,203,2,49,203,2,56,1,60,60,60,19,0,203,2,63,203,2,66,0,2,48,88,1,0,0,19,0,203,2,73,203,
+2,76,0,2,48,120,1,0,0,19,0,203,2,84,203,2,85,0,0,1,0,0,0,0,204,2,28,204,2,50,3,41,
+56,62,27,0,204,2,28,204,2,35,1,41,41,41,3,27,0,204,2,37,204,2,39,1,62,62,62,27,0,204,2,42,
+204,2,44,1,56,56,56,19,0,204,2,47,204,2,49,0,1,48,1,0,0,0,5,0,205,2,13,205,2,89,4,47,
+48,54,63,3,7,0,205,2,14,205,2,81,3,47,48,54,27,0,205,2,17,205,2,19,1,54,54,54,19,0,205,2,
+26,205,2,28,0,1,45,1,0,0,7,0,205,2,35,205,2,81,2,47,48,27,0,205,2,38,205,2,41,1,48,48,
+48,19,0,205,2,48,205,2,50,0,1,43,1,0,0,7,0,205,2,57,205,2,81,1,47,27,0,205,2,60,205,2,
+64,1,47,47,47,19,0,205,2,71,205,2,73,0,1,32,1,0,0,19,0,205,2,80,205,2,81,0,0,1,0,0,
+27,0,205,2,86,205,2,89,1,63,63,63,15,0,207,2,9,152,4,53,7,0,17,37,41,42,43,58,1,64,11,0,
+207,2,9,152,4,53,1,0,1,3,15,0,208,2,13,216,2,41,2,0,3,1,14,11,0,208,2,13,216,2,41,2,
+0,14,2,3,6,7,0,209,2,17,215,2,49,4,0,3,6,14,5,0,209,2,20,209,2,24,1,6,9,27,0,209,
+2,20,209,2,20,1,6,6,6,18,0,209,2,24,209,2,24,0,1,48,19,0,210,2,21,210,2,22,0,0,1,0,
+0,7,0,212,2,21,215,2,49,4,0,3,6,14,0,0,212,2,24,212,2,36,3,0,3,6,14,1,0,0,0,0,
+1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,
+254,1,0,2,14,0,212,2,24,212,2,29,2,3,6,27,0,212,2,24,212,2,26,1,3,3,3,0,27,0,212,2,
+28,212,2,28,1,6,6,6,254,1,254,1,0,19,0,212,2,34,212,2,36,0,1,48,1,0,0,1,0,0,213,2,
+25,213,2,39,3,3,6,14,27,0,213,2,25,213,2,27,1,14,14,14,2,27,0,213,2,29,213,2,31,1,3,3,
+3,5,0,213,2,34,213,2,38,1,6,4,27,0,213,2,34,213,2,34,1,6,6,6,18,0,213,2,38,213,2,38,
+0,1,49,0,0,0,215,2,25,215,2,49,3,0,3,6,14,0,215,2,25,215,2,34,1,0,27,0,215,2,25,215,
+2,27,1,0,0,0,0,19,1,0,0,0,0,0,6,115,117,98,115,116,114,1,0,0,254,1,254,1,0,3,27,0,
+215,2,36,215,2,38,1,3,3,3,18,0,215,2,41,215,2,41,0,1,48,5,0,215,2,44,215,2,48,1,6,3,
+27,0,215,2,44,215,2,44,1,6,6,6,18,0,215,2,48,215,2,48,0,1,49,0,0,0,216,2,13,216,2,41,
+3,0,3,14,27,0,216,2,13,216,2,15,1,14,14,14,2,27,0,216,2,17,216,2,19,1,3,3,3,5,0,216,
+2,22,216,2,40,2,0,3,4,0,0,216,2,22,216,2,36,2,0,3,14,0,216,2,22,216,2,31,1,0,27,0,
+216,2,22,216,2,24,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,
+0,1,27,0,216,2,33,216,2,35,1,3,3,3,0,18,0,216,2,40,216,2,40,0,1,49,0,15,0,219,2,9,
+152,4,53,8,0,17,37,41,42,43,58,64,1,65,11,0,219,2,9,152,4,53,3,0,43,64,7,44,66,47,48,67,
+68,30,15,0,220,2,13,233,2,23,10,0,47,48,30,43,44,64,66,67,68,1,51,0,0,220,2,24,220,2,35,2,
+0,44,14,0,220,2,24,220,2,30,1,0,27,0,220,2,24,220,2,26,1,0,0,0,0,19,1,0,0,0,0,0,
+3,97,98,115,1,0,0,254,1,254,1,0,1,27,0,220,2,32,220,2,34,1,44,44,44,0,15,0,221,2,13,233,
+2,23,11,0,47,48,30,43,44,51,64,66,67,68,1,69,0,0,221,2,27,221,2,39,2,0,51,14,0,221,2,27,
+221,2,35,1,0,27,0,221,2,27,221,2,29,1,0,0,0,0,19,1,0,0,0,0,0,5,102,108,111,111,114,1,
+0,0,254,1,254,1,0,1,27,0,221,2,37,221,2,38,1,51,51,51,0,15,0,222,2,13,233,2,23,12,0,47,
+48,30,43,44,51,64,66,67,68,69,1,70,7,0,222,2,30,222,2,69,3,0,30,67,5,0,222,2,33,222,2,55,
+3,0,30,67,16,0,0,222,2,33,222,2,41,2,0,30,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,
+0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,222,2,33,222,
+2,36,1,30,30,30,18,0,222,2,41,222,2,41,0,1,48,1,26,0,222,2,46,222,2,55,1,67,0,27,0,222,
+2,47,222,2,55,1,67,67,67,18,0,222,2,62,222,2,62,0,1,48,18,0,222,2,69,222,2,69,0,1,49,15,
+0,223,2,13,233,2,23,13,0,47,48,30,43,44,51,64,66,67,68,69,70,1,55,5,0,223,2,24,223,2,49,3,
+30,66,70,4,5,0,223,2,24,223,2,38,2,30,66,4,27,0,223,2,24,223,2,31,1,66,66,66,27,0,223,2,
+35,223,2,38,1,30,30,30,27,0,223,2,42,223,2,49,1,70,70,70,15,0,224,2,13,233,2,23,12,0,47,48,
+30,43,44,51,55,64,67,68,69,1,3,0,0,224,2,25,224,2,80,7,47,48,43,44,51,55,69,27,0,224,2,25,
+224,2,34,1,43,43,43,7,5,0,224,2,36,224,2,51,3,44,51,69,0,5,0,224,2,36,224,2,43,2,44,51,
+1,27,0,224,2,36,224,2,38,1,44,44,44,27,0,224,2,42,224,2,43,1,51,51,51,27,0,224,2,47,224,2,
+51,1,69,69,69,27,0,224,2,54,224,2,55,1,55,55,55,18,0,224,2,58,224,2,58,0,1,48,27,0,224,2,
+61,224,2,65,1,47,47,47,27,0,224,2,68,224,2,71,1,48,48,48,18,0,224,2,74,224,2,75,0,2,49,48,
+19,0,224,2,78,224,2,79,0,0,1,0,0,0,7,0,225,2,13,233,2,23,9,0,3,30,43,51,64,67,68,69,
+0,0,225,2,16,225,2,24,2,0,30,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,
+0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,225,2,16,225,2,19,1,30,30,
+30,18,0,225,2,24,225,2,24,0,1,48,1,5,0,226,2,17,226,2,51,2,3,67,3,27,0,226,2,17,226,2,
+19,1,3,3,3,7,0,226,2,23,226,2,51,1,67,27,0,226,2,26,226,2,34,1,67,67,67,19,0,226,2,41,
+226,2,43,0,1,46,1,0,0,19,0,226,2,50,226,2,51,0,0,1,0,0,15,0,228,2,17,233,2,23,8,0,
+3,30,43,51,64,68,69,1,71,0,0,228,2,30,228,2,78,4,0,30,51,69,14,0,228,2,30,228,2,38,1,0,
+27,0,228,2,30,228,2,32,1,0,0,0,0,19,1,0,0,0,0,0,5,102,108,111,111,114,1,0,0,254,1,254,
+1,0,1,5,0,228,2,40,228,2,77,4,0,30,51,69,3,5,0,228,2,40,228,2,71,4,0,30,51,69,0,5,
+0,228,2,41,228,2,50,2,51,69,4,27,0,228,2,41,228,2,42,1,51,51,51,27,0,228,2,46,228,2,50,1,
+69,69,69,0,0,228,2,55,228,2,71,2,0,30,14,0,228,2,55,228,2,61,1,0,27,0,228,2,55,228,2,57,
+1,0,0,0,0,19,1,0,0,0,0,0,3,112,111,119,1,0,0,254,1,254,1,0,2,18,0,228,2,63,228,2,
+64,0,2,49,48,27,0,228,2,67,228,2,70,1,30,30,30,0,18,0,228,2,75,228,2,77,0,3,48,46,53,0,
+7,0,229,2,17,233,2,23,6,3,30,43,64,68,71,5,0,229,2,20,229,2,39,2,68,71,17,27,0,229,2,20,
+229,2,27,1,68,68,68,5,0,229,2,32,229,2,39,1,71,7,27,0,229,2,32,229,2,35,1,71,71,71,18,0,
+229,2,39,229,2,39,0,1,48,15,0,230,2,21,231,2,93,6,3,30,43,64,68,71,1,72,0,0,230,2,38,230,
+2,84,3,30,43,71,27,0,230,2,38,230,2,47,1,43,43,43,7,27,0,230,2,49,230,2,52,1,71,71,71,27,
+0,230,2,55,230,2,58,1,30,30,30,18,0,230,2,61,230,2,61,0,1,48,16,0,230,2,64,230,2,68,0,0,
+16,0,230,2,71,230,2,75,0,0,18,0,230,2,78,230,2,79,0,2,49,48,19,0,230,2,82,230,2,83,0,0,
+1,0,0,0,5,0,231,2,21,231,2,93,4,3,64,68,72,3,5,0,231,2,21,231,2,29,1,3,3,27,0,231,
+2,21,231,2,23,1,3,3,3,19,0,231,2,27,231,2,29,0,1,46,1,0,0,7,0,231,2,33,231,2,93,3,
+64,68,72,26,0,231,2,36,231,2,44,1,68,0,27,0,231,2,37,231,2,44,1,68,68,68,0,0,231,2,51,231,
+2,79,2,64,72,27,0,231,2,51,231,2,69,1,64,64,64,1,27,0,231,2,71,231,2,78,1,72,72,72,0,27,
+0,231,2,86,231,2,93,1,72,72,72,27,0,233,2,21,233,2,23,1,3,3,3,15,0,236,2,9,152,4,53,8,
+0,17,37,41,42,43,58,65,1,73,11,0,236,2,9,152,4,53,3,0,43,65,8,44,66,47,48,67,68,74,30,15,
+0,237,2,13,242,2,90,11,0,47,48,74,30,43,44,65,66,67,68,1,75,0,0,237,2,30,237,2,75,2,0,44,
+14,0,237,2,30,237,2,38,1,0,27,0,237,2,30,237,2,32,1,0,0,0,0,19,1,0,0,0,0,0,5,102,
+108,111,111,114,1,0,0,254,1,254,1,0,1,5,0,237,2,40,237,2,74,2,0,44,1,0,0,237,2,40,237,2,
+60,2,0,44,14,0,237,2,40,237,2,46,1,0,27,0,237,2,40,237,2,42,1,0,0,0,0,19,1,0,0,0,
+0,0,3,108,111,103,1,0,0,254,1,254,1,0,1,0,0,237,2,48,237,2,59,2,0,44,14,0,237,2,48,237,
+2,54,1,0,27,0,237,2,48,237,2,50,1,0,0,0,0,19,1,0,0,0,0,0,3,97,98,115,1,0,0,254,
+1,254,1,0,1,27,0,237,2,56,237,2,58,1,44,44,44,0,0,0,0,237,2,64,237,2,74,1,0,14,0,237,
+2,64,237,2,70,1,0,27,0,237,2,64,237,2,66,1,0,0,0,0,19,1,0,0,0,0,0,3,108,111,103,1,
+0,0,254,1,254,1,0,1,18,0,237,2,72,237,2,73,0,2,49,48,0,0,15,0,238,2,13,242,2,90,12,0,
+47,48,74,30,43,44,65,66,67,68,75,1,76,5,0,238,2,26,239,2,74,3,74,43,75,3,7,0,238,2,27,238,
+2,51,1,74,27,0,238,2,30,238,2,33,1,74,74,74,19,0,238,2,40,238,2,42,0,1,69,1,0,0,19,0,
+238,2,49,238,2,51,0,1,101,1,0,0,0,0,239,2,28,239,2,74,2,43,75,27,0,239,2,28,239,2,37,1,
+43,43,43,7,27,0,239,2,39,239,2,46,1,75,75,75,18,0,239,2,49,239,2,49,0,1,51,18,0,239,2,52,
+239,2,52,0,1,48,16,0,239,2,55,239,2,59,0,0,16,0,239,2,62,239,2,65,0,1,18,0,239,2,68,239,
+2,69,0,2,49,48,19,0,239,2,72,239,2,73,0,0,1,0,0,0,15,0,240,2,13,242,2,90,11,0,47,48,
+30,44,65,66,67,68,75,76,1,77,5,0,240,2,30,240,2,56,3,0,44,75,1,27,0,240,2,30,240,2,32,1,
+44,44,44,0,0,240,2,36,240,2,56,2,0,75,14,0,240,2,36,240,2,42,1,0,27,0,240,2,36,240,2,38,
+1,0,0,0,0,19,1,0,0,0,0,0,3,112,111,119,1,0,0,254,1,254,1,0,2,18,0,240,2,44,240,2,
+45,0,2,49,48,27,0,240,2,48,240,2,55,1,75,75,75,0,15,0,241,2,13,242,2,90,10,0,47,48,30,65,
+66,67,68,76,77,1,56,5,0,241,2,25,241,2,51,3,0,66,76,4,27,0,241,2,25,241,2,32,1,66,66,66,
+0,0,241,2,36,241,2,51,2,0,76,14,0,241,2,36,241,2,45,1,0,27,0,241,2,36,241,2,38,1,0,0,
+0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,241,2,47,241,2,
+50,1,76,76,76,0,5,0,242,2,13,242,2,90,9,47,48,30,56,65,67,68,76,77,3,0,0,242,2,13,242,2,
+83,8,47,48,30,56,65,67,68,77,27,0,242,2,13,242,2,28,1,65,65,65,7,27,0,242,2,30,242,2,37,1,
+77,77,77,27,0,242,2,40,242,2,42,1,56,56,56,27,0,242,2,45,242,2,49,1,47,47,47,27,0,242,2,52,
+242,2,55,1,48,48,48,27,0,242,2,58,242,2,66,1,67,67,67,27,0,242,2,69,242,2,76,1,68,68,68,27,
+0,242,2,79,242,2,82,1,30,30,30,0,27,0,242,2,87,242,2,90,1,76,76,76,15,0,245,2,9,152,4,53,
+9,0,17,37,41,42,43,58,65,73,1,78,11,0,245,2,9,152,4,53,5,0,43,58,65,73,5,79,80,29,81,6,
+15,0,246,2,13,182,3,51,10,0,6,29,80,43,58,65,73,79,81,1,28,14,0,246,2,28,246,2,38,1,80,27,
+0,246,2,28,246,2,31,1,80,80,80,0,19,1,0,0,0,0,0,6,99,102,108,97,103,115,1,0,0,254,1,254,
+1,0,15,0,247,2,13,182,3,51,11,0,6,28,29,80,43,58,65,73,79,81,1,82,7,0,247,2,28,247,2,75,
+2,0,81,26,0,247,2,31,247,2,50,2,0,81,0,0,0,247,2,31,247,2,50,2,0,81,14,1,0,0,0,0,
+1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,
+254,1,0,2,27,0,247,2,31,247,2,42,1,81,81,81,17,0,247,2,47,247,2,50,0,1,27,0,247,2,57,247,
+2,68,1,81,81,81,18,0,247,2,75,247,2,75,0,1,54,15,0,248,2,13,182,3,51,12,0,6,28,29,80,43,
+58,65,73,79,81,82,1,83,7,0,248,2,27,248,2,74,2,0,81,26,0,248,2,30,248,2,49,2,0,81,0,0,
+0,248,2,30,248,2,49,2,0,81,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,
+0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,248,2,30,248,2,41,1,81,81,81,
+17,0,248,2,46,248,2,49,0,1,27,0,248,2,56,248,2,67,1,81,81,81,18,0,248,2,74,248,2,74,0,1,
+48,15,0,249,2,13,182,3,51,12,0,6,28,29,80,43,58,65,73,79,82,83,1,55,7,0,249,2,24,249,2,68,
+2,28,29,5,0,249,2,27,249,2,53,1,28,16,14,0,249,2,27,249,2,37,1,28,27,0,249,2,27,249,2,32,
+1,28,28,28,0,19,1,0,0,0,0,0,4,122,101,114,111,1,0,0,254,1,254,1,0,26,0,249,2,42,249,2,
+53,1,28,0,14,0,249,2,43,249,2,53,1,28,27,0,249,2,43,249,2,48,1,28,28,28,0,19,1,0,0,0,
+0,0,4,108,101,102,116,1,0,0,254,1,254,1,0,27,0,249,2,60,249,2,61,1,29,29,29,18,0,249,2,68,
+249,2,68,0,1,48,7,0,250,2,13,182,3,51,12,0,6,28,80,43,55,58,65,73,79,82,83,0,0,250,2,16,
+250,2,32,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,
+6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,250,2,16,250,2,25,1,80,27,0,250,2,16,250,
+2,19,1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,121,112,101,1,0,0,254,1,254,1,0,19,0,250,2,
+30,250,2,32,0,1,115,1,0,0,1,0,0,251,2,17,251,2,33,2,0,79,14,0,251,2,17,251,2,28,1,0,
+27,0,251,2,17,251,2,19,1,0,0,0,0,19,1,0,0,0,0,0,8,116,111,83,116,114,105,110,103,1,0,0,
+254,1,254,1,0,1,27,0,251,2,30,251,2,32,1,79,79,79,0,7,0,252,2,18,182,3,51,12,0,6,28,80,
+43,55,58,65,73,79,82,83,0,0,252,2,21,252,2,37,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,
+0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,252,
+2,21,252,2,30,1,80,27,0,252,2,21,252,2,24,1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,121,112,
+101,1,0,0,254,1,254,1,0,19,0,252,2,35,252,2,37,0,1,100,1,0,0,1,7,0,253,2,17,129,3,81,
+7,0,6,28,43,55,79,83,26,0,253,2,20,253,2,44,2,0,79,0,0,0,253,2,20,253,2,44,2,0,79,14,
+1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,
+1,0,0,254,1,254,1,0,2,0,0,253,2,20,253,2,32,2,0,79,14,0,253,2,20,253,2,27,1,0,27,0,
+253,2,20,253,2,22,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,
+27,0,253,2,29,253,2,31,1,79,79,79,0,19,0,253,2,37,253,2,44,0,6,110,117,109,98,101,114,1,0,0,
+1,10,0,254,2,21,255,2,56,3,0,6,79,5,0,254,2,27,255,2,56,3,0,6,79,3,5,0,254,2,27,255,
+2,40,1,6,3,5,0,254,2,27,255,2,29,1,6,3,19,0,254,2,27,254,2,54,0,26,70,111,114,109,97,116,
+32,114,101,113,117,105,114,101,100,32,110,117,109,98,101,114,32,97,116,32,1,0,0,27,0,255,2,29,255,2,29,1,
+6,6,6,19,0,255,2,33,255,2,40,0,6,44,32,103,111,116,32,1,0,0,0,0,255,2,44,255,2,56,2,0,
+79,14,0,255,2,44,255,2,51,1,0,27,0,255,2,44,255,2,46,1,0,0,0,0,19,1,0,0,0,0,0,4,
+116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,255,2,53,255,2,55,1,79,79,79,0,0,0,129,3,21,129,
+3,81,5,28,43,55,79,83,27,0,129,3,21,129,3,30,1,43,43,43,7,27,0,129,3,32,129,3,34,1,79,79,
+79,27,0,129,3,37,129,3,38,1,55,55,55,27,0,129,3,41,129,3,45,1,83,83,83,14,0,129,3,48,129,3,
+59,1,28,27,0,129,3,48,129,3,53,1,28,28,28,0,19,1,0,0,0,0,0,5,98,108,97,110,107,1,0,0,
+254,1,254,1,0,14,0,129,3,62,129,3,72,1,28,27,0,129,3,62,129,3,67,1,28,28,28,0,19,1,0,0,
+0,0,0,4,115,105,103,110,1,0,0,254,1,254,1,0,18,0,129,3,75,129,3,76,0,2,49,48,19,0,129,3,
+79,129,3,80,0,0,1,0,0,0,7,0,130,3,18,182,3,51,12,0,6,28,80,43,55,58,65,73,79,82,83,0,
+0,130,3,21,130,3,37,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,
+0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,130,3,21,130,3,30,1,80,27,0,
+130,3,21,130,3,24,1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,121,112,101,1,0,0,254,1,254,1,0,
+19,0,130,3,35,130,3,37,0,1,111,1,0,0,1,7,0,131,3,17,136,3,89,7,0,6,28,43,55,79,83,26,
+0,131,3,20,131,3,44,2,0,79,0,0,0,131,3,20,131,3,44,2,0,79,14,1,0,0,0,0,1,0,27,1,
+0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,
+0,0,131,3,20,131,3,32,2,0,79,14,0,131,3,20,131,3,27,1,0,27,0,131,3,20,131,3,22,1,0,0,
+0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,131,3,29,131,3,31,1,
+79,79,79,0,19,0,131,3,37,131,3,44,0,6,110,117,109,98,101,114,1,0,0,1,10,0,132,3,21,133,3,56,
+3,0,6,79,5,0,132,3,27,133,3,56,3,0,6,79,3,5,0,132,3,27,133,3,40,1,6,3,5,0,132,3,
+27,133,3,29,1,6,3,19,0,132,3,27,132,3,54,0,26,70,111,114,109,97,116,32,114,101,113,117,105,114,101,100,
+32,110,117,109,98,101,114,32,97,116,32,1,0,0,27,0,133,3,29,133,3,29,1,6,6,6,19,0,133,3,33,133,
+3,40,0,6,44,32,103,111,116,32,1,0,0,0,0,133,3,44,133,3,56,2,0,79,14,0,133,3,44,133,3,51,
+1,0,27,0,133,3,44,133,3,46,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,
+254,1,0,1,27,0,133,3,53,133,3,55,1,79,79,79,0,15,0,135,3,21,136,3,89,5,28,43,55,79,83,1,
+50,7,0,135,3,41,135,3,70,1,28,14,0,135,3,44,135,3,53,1,28,27,0,135,3,44,135,3,49,1,28,28,
+28,0,19,1,0,0,0,0,0,3,97,108,116,1,0,0,254,1,254,1,0,19,0,135,3,60,135,3,62,0,1,48,
+1,0,0,19,0,135,3,69,135,3,70,0,0,1,0,0,0,0,136,3,21,136,3,89,6,28,43,50,55,79,83,27,
+0,136,3,21,136,3,30,1,43,43,43,7,27,0,136,3,32,136,3,34,1,79,79,79,27,0,136,3,37,136,3,38,
+1,55,55,55,27,0,136,3,41,136,3,45,1,83,83,83,14,0,136,3,48,136,3,59,1,28,27,0,136,3,48,136,
+3,53,1,28,28,28,0,19,1,0,0,0,0,0,5,98,108,97,110,107,1,0,0,254,1,254,1,0,14,0,136,3,
+62,136,3,72,1,28,27,0,136,3,62,136,3,67,1,28,28,28,0,19,1,0,0,0,0,0,4,115,105,103,110,1,
+0,0,254,1,254,1,0,18,0,136,3,75,136,3,75,0,1,56,27,0,136,3,78,136,3,88,1,50,50,50,0,7,
+0,137,3,18,182,3,51,11,0,6,28,80,55,58,65,73,79,82,83,0,0,137,3,21,137,3,37,2,0,80,14,1,
+0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,
+0,0,254,1,254,1,0,2,14,0,137,3,21,137,3,30,1,80,27,0,137,3,21,137,3,24,1,80,80,80,0,19,
+1,0,0,0,0,0,5,99,116,121,112,101,1,0,0,254,1,254,1,0,19,0,137,3,35,137,3,37,0,1,120,1,
+0,0,1,7,0,138,3,17,143,3,41,8,0,6,28,80,55,58,79,83,26,0,138,3,20,138,3,44,2,0,79,0,
+0,0,138,3,20,138,3,44,2,0,79,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,
+0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,138,3,20,138,3,32,2,0,79,
+14,0,138,3,20,138,3,27,1,0,27,0,138,3,20,138,3,22,1,0,0,0,0,19,1,0,0,0,0,0,4,116,
+121,112,101,1,0,0,254,1,254,1,0,1,27,0,138,3,29,138,3,31,1,79,79,79,0,19,0,138,3,37,138,3,
+44,0,6,110,117,109,98,101,114,1,0,0,1,10,0,139,3,21,140,3,56,3,0,6,79,5,0,139,3,27,140,3,
+56,3,0,6,79,3,5,0,139,3,27,140,3,40,1,6,3,5,0,139,3,27,140,3,29,1,6,3,19,0,139,3,
+27,139,3,54,0,26,70,111,114,109,97,116,32,114,101,113,117,105,114,101,100,32,110,117,109,98,101,114,32,97,116,32,
+1,0,0,27,0,140,3,29,140,3,29,1,6,6,6,19,0,140,3,33,140,3,40,0,6,44,32,103,111,116,32,1,
+0,0,0,0,140,3,44,140,3,56,2,0,79,14,0,140,3,44,140,3,51,1,0,27,0,140,3,44,140,3,46,1,
+0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,140,3,53,140,3,
+55,1,79,79,79,0,0,0,142,3,21,143,3,41,6,28,80,55,58,79,83,27,0,142,3,21,142,3,30,1,58,58,
+58,7,27,0,142,3,32,142,3,34,1,79,79,79,27,0,142,3,37,142,3,38,1,55,55,55,27,0,142,3,41,142,
+3,45,1,83,83,83,14,0,142,3,48,142,3,59,1,28,27,0,142,3,48,142,3,53,1,28,28,28,0,19,1,0,
+0,0,0,0,5,98,108,97,110,107,1,0,0,254,1,254,1,0,14,0,142,3,62,142,3,72,1,28,27,0,142,3,
+62,142,3,67,1,28,28,28,0,19,1,0,0,0,0,0,4,115,105,103,110,1,0,0,254,1,254,1,0,14,0,142,
+3,75,142,3,84,1,28,27,0,142,3,75,142,3,80,1,28,28,28,0,19,1,0,0,0,0,0,3,97,108,116,1,
+0,0,254,1,254,1,0,14,0,143,3,32,143,3,40,1,80,27,0,143,3,32,143,3,35,1,80,80,80,0,19,1,
+0,0,0,0,0,4,99,97,112,115,1,0,0,254,1,254,1,0,0,7,0,144,3,18,182,3,51,9,0,6,28,80,
+55,65,73,79,82,0,0,144,3,21,144,3,37,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,
+0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,144,3,21,144,
+3,30,1,80,27,0,144,3,21,144,3,24,1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,121,112,101,1,0,
+0,254,1,254,1,0,19,0,144,3,35,144,3,37,0,1,102,1,0,0,1,7,0,145,3,17,150,3,75,7,0,6,
+28,55,65,79,82,26,0,145,3,20,145,3,44,2,0,79,0,0,0,145,3,20,145,3,44,2,0,79,14,1,0,0,
+0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,
+254,1,254,1,0,2,0,0,145,3,20,145,3,32,2,0,79,14,0,145,3,20,145,3,27,1,0,27,0,145,3,20,
+145,3,22,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,145,
+3,29,145,3,31,1,79,79,79,0,19,0,145,3,37,145,3,44,0,6,110,117,109,98,101,114,1,0,0,1,10,0,
+146,3,21,147,3,56,3,0,6,79,5,0,146,3,27,147,3,56,3,0,6,79,3,5,0,146,3,27,147,3,40,1,
+6,3,5,0,146,3,27,147,3,29,1,6,3,19,0,146,3,27,146,3,54,0,26,70,111,114,109,97,116,32,114,101,
+113,117,105,114,101,100,32,110,117,109,98,101,114,32,97,116,32,1,0,0,27,0,147,3,29,147,3,29,1,6,6,6,
+19,0,147,3,33,147,3,40,0,6,44,32,103,111,116,32,1,0,0,0,0,147,3,44,147,3,56,2,0,79,14,0,
+147,3,44,147,3,51,1,0,27,0,147,3,44,147,3,46,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,
+101,1,0,0,254,1,254,1,0,1,27,0,147,3,53,147,3,55,1,79,79,79,0,0,0,149,3,21,150,3,75,5,
+28,55,65,79,82,27,0,149,3,21,149,3,36,1,65,65,65,7,27,0,149,3,38,149,3,40,1,79,79,79,27,0,
+149,3,43,149,3,44,1,55,55,55,14,0,149,3,47,149,3,58,1,28,27,0,149,3,47,149,3,52,1,28,28,28,
+0,19,1,0,0,0,0,0,5,98,108,97,110,107,1,0,0,254,1,254,1,0,14,0,150,3,38,150,3,48,1,28,
+27,0,150,3,38,150,3,43,1,28,28,28,0,19,1,0,0,0,0,0,4,115,105,103,110,1,0,0,254,1,254,1,
+0,14,0,150,3,51,150,3,60,1,28,27,0,150,3,51,150,3,56,1,28,28,28,0,19,1,0,0,0,0,0,3,
+97,108,116,1,0,0,254,1,254,1,0,16,0,150,3,63,150,3,66,0,1,27,0,150,3,69,150,3,74,1,82,82,
+82,0,7,0,151,3,18,182,3,51,9,0,6,28,80,55,65,73,79,82,0,0,151,3,21,151,3,37,2,0,80,14,
+1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,
+1,0,0,254,1,254,1,0,2,14,0,151,3,21,151,3,30,1,80,27,0,151,3,21,151,3,24,1,80,80,80,0,
+19,1,0,0,0,0,0,5,99,116,121,112,101,1,0,0,254,1,254,1,0,19,0,151,3,35,151,3,37,0,1,101,
+1,0,0,1,7,0,152,3,17,157,3,86,8,0,6,28,80,55,73,79,82,26,0,152,3,20,152,3,44,2,0,79,
+0,0,0,152,3,20,152,3,44,2,0,79,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,
+1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,152,3,20,152,3,32,2,0,
+79,14,0,152,3,20,152,3,27,1,0,27,0,152,3,20,152,3,22,1,0,0,0,0,19,1,0,0,0,0,0,4,
+116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,152,3,29,152,3,31,1,79,79,79,0,19,0,152,3,37,152,
+3,44,0,6,110,117,109,98,101,114,1,0,0,1,10,0,153,3,21,154,3,56,3,0,6,79,5,0,153,3,27,154,
+3,56,3,0,6,79,3,5,0,153,3,27,154,3,40,1,6,3,5,0,153,3,27,154,3,29,1,6,3,19,0,153,
+3,27,153,3,54,0,26,70,111,114,109,97,116,32,114,101,113,117,105,114,101,100,32,110,117,109,98,101,114,32,97,116,
+32,1,0,0,27,0,154,3,29,154,3,29,1,6,6,6,19,0,154,3,33,154,3,40,0,6,44,32,103,111,116,32,
+1,0,0,0,0,154,3,44,154,3,56,2,0,79,14,0,154,3,44,154,3,51,1,0,27,0,154,3,44,154,3,46,
+1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,154,3,53,154,
+3,55,1,79,79,79,0,0,0,156,3,21,157,3,86,6,28,80,55,73,79,82,27,0,156,3,21,156,3,36,1,73,
+73,73,8,27,0,156,3,38,156,3,40,1,79,79,79,27,0,156,3,43,156,3,44,1,55,55,55,14,0,156,3,47,
+156,3,58,1,28,27,0,156,3,47,156,3,52,1,28,28,28,0,19,1,0,0,0,0,0,5,98,108,97,110,107,1,
+0,0,254,1,254,1,0,14,0,157,3,38,157,3,48,1,28,27,0,157,3,38,157,3,43,1,28,28,28,0,19,1,
+0,0,0,0,0,4,115,105,103,110,1,0,0,254,1,254,1,0,14,0,157,3,51,157,3,60,1,28,27,0,157,3,
+51,157,3,56,1,28,28,28,0,19,1,0,0,0,0,0,3,97,108,116,1,0,0,254,1,254,1,0,16,0,157,3,
+63,157,3,66,0,1,14,0,157,3,69,157,3,77,1,80,27,0,157,3,69,157,3,72,1,80,80,80,0,19,1,0,
+0,0,0,0,4,99,97,112,115,1,0,0,254,1,254,1,0,27,0,157,3,80,157,3,85,1,82,82,82,0,7,0,
+158,3,18,182,3,51,9,0,6,28,80,55,65,73,79,82,0,0,158,3,21,158,3,37,2,0,80,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,
+1,254,1,0,2,14,0,158,3,21,158,3,30,1,80,27,0,158,3,21,158,3,24,1,80,80,80,0,19,1,0,0,
+0,0,0,5,99,116,121,112,101,1,0,0,254,1,254,1,0,19,0,158,3,35,158,3,37,0,1,103,1,0,0,1,
+7,0,159,3,17,170,3,79,9,0,6,28,80,55,65,73,79,82,26,0,159,3,20,159,3,44,2,0,79,0,0,0,
+159,3,20,159,3,44,2,0,79,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,
+0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,159,3,20,159,3,32,2,0,79,14,0,
+159,3,20,159,3,27,1,0,27,0,159,3,20,159,3,22,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,
+101,1,0,0,254,1,254,1,0,1,27,0,159,3,29,159,3,31,1,79,79,79,0,19,0,159,3,37,159,3,44,0,
+6,110,117,109,98,101,114,1,0,0,1,10,0,160,3,21,161,3,56,3,0,6,79,5,0,160,3,27,161,3,56,3,
+0,6,79,3,5,0,160,3,27,161,3,40,1,6,3,5,0,160,3,27,161,3,29,1,6,3,19,0,160,3,27,160,
+3,54,0,26,70,111,114,109,97,116,32,114,101,113,117,105,114,101,100,32,110,117,109,98,101,114,32,97,116,32,1,0,
+0,27,0,161,3,29,161,3,29,1,6,6,6,19,0,161,3,33,161,3,40,0,6,44,32,103,111,116,32,1,0,0,
+0,0,161,3,44,161,3,56,2,0,79,14,0,161,3,44,161,3,51,1,0,27,0,161,3,44,161,3,46,1,0,0,
+0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,161,3,53,161,3,55,1,
+79,79,79,0,15,0,163,3,21,170,3,79,8,0,28,80,55,65,73,79,82,1,75,0,0,163,3,38,163,3,81,2,
+0,79,14,0,163,3,38,163,3,46,1,0,27,0,163,3,38,163,3,40,1,0,0,0,0,19,1,0,0,0,0,0,
+5,102,108,111,111,114,1,0,0,254,1,254,1,0,1,5,0,163,3,48,163,3,80,2,0,79,1,0,0,163,3,48,
+163,3,68,2,0,79,14,0,163,3,48,163,3,54,1,0,27,0,163,3,48,163,3,50,1,0,0,0,0,19,1,0,
+0,0,0,0,3,108,111,103,1,0,0,254,1,254,1,0,1,0,0,163,3,56,163,3,67,2,0,79,14,0,163,3,
+56,163,3,62,1,0,27,0,163,3,56,163,3,58,1,0,0,0,0,19,1,0,0,0,0,0,3,97,98,115,1,0,
+0,254,1,254,1,0,1,27,0,163,3,64,163,3,66,1,79,79,79,0,0,0,0,163,3,70,163,3,80,1,0,14,
+0,163,3,70,163,3,76,1,0,27,0,163,3,70,163,3,72,1,0,0,0,0,19,1,0,0,0,0,0,3,108,111,
+103,1,0,0,254,1,254,1,0,1,18,0,163,3,78,163,3,79,0,2,49,48,0,0,7,0,164,3,21,170,3,79,
+9,0,28,80,55,65,73,75,79,82,5,0,164,3,24,164,3,58,2,75,82,17,5,0,164,3,24,164,3,36,1,75,
+9,27,0,164,3,24,164,3,31,1,75,75,75,26,0,164,3,35,164,3,36,0,3,18,0,164,3,36,164,3,36,0,
+1,52,5,0,164,3,41,164,3,58,2,75,82,8,27,0,164,3,41,164,3,48,1,75,75,75,27,0,164,3,53,164,
+3,58,1,82,82,82,0,0,165,3,25,166,3,75,6,28,80,55,73,79,82,27,0,165,3,25,165,3,40,1,73,73,
+73,8,27,0,165,3,42,165,3,44,1,79,79,79,27,0,165,3,47,165,3,48,1,55,55,55,14,0,165,3,51,165,
+3,62,1,28,27,0,165,3,51,165,3,56,1,28,28,28,0,19,1,0,0,0,0,0,5,98,108,97,110,107,1,0,
+0,254,1,254,1,0,14,0,165,3,65,165,3,75,1,28,27,0,165,3,65,165,3,70,1,28,28,28,0,19,1,0,
+0,0,0,0,4,115,105,103,110,1,0,0,254,1,254,1,0,14,0,165,3,78,165,3,87,1,28,27,0,165,3,78,
+165,3,83,1,28,28,28,0,19,1,0,0,0,0,0,3,97,108,116,1,0,0,254,1,254,1,0,14,0,166,3,42,
+166,3,51,1,28,27,0,166,3,42,166,3,47,1,28,28,28,0,19,1,0,0,0,0,0,3,97,108,116,1,0,0,
+254,1,254,1,0,14,0,166,3,54,166,3,62,1,80,27,0,166,3,54,166,3,57,1,80,80,80,0,19,1,0,0,
+0,0,0,4,99,97,112,115,1,0,0,254,1,254,1,0,5,0,166,3,65,166,3,74,1,82,4,27,0,166,3,65,
+166,3,70,1,82,82,82,18,0,166,3,74,166,3,74,0,1,49,0,15,0,168,3,25,170,3,79,7,0,28,55,65,
+75,79,82,1,84,0,0,168,3,50,168,3,71,2,0,75,14,0,168,3,50,168,3,56,1,0,27,0,168,3,50,168,
+3,52,1,0,0,0,0,19,1,0,0,0,0,0,3,109,97,120,1,0,0,254,1,254,1,0,2,18,0,168,3,58,
+168,3,58,0,1,49,5,0,168,3,61,168,3,70,1,75,3,27,0,168,3,61,168,3,68,1,75,75,75,18,0,168,
+3,70,168,3,70,0,1,49,0,0,0,169,3,25,170,3,79,6,28,55,65,79,82,84,27,0,169,3,25,169,3,40,
+1,65,65,65,7,27,0,169,3,42,169,3,44,1,79,79,79,27,0,169,3,47,169,3,48,1,55,55,55,14,0,169,
+3,51,169,3,62,1,28,27,0,169,3,51,169,3,56,1,28,28,28,0,19,1,0,0,0,0,0,5,98,108,97,110,
+107,1,0,0,254,1,254,1,0,14,0,169,3,65,169,3,75,1,28,27,0,169,3,65,169,3,70,1,28,28,28,0,
+19,1,0,0,0,0,0,4,115,105,103,110,1,0,0,254,1,254,1,0,14,0,169,3,78,169,3,87,1,28,27,0,
+169,3,78,169,3,83,1,28,28,28,0,19,1,0,0,0,0,0,3,97,108,116,1,0,0,254,1,254,1,0,14,0,
+170,3,42,170,3,51,1,28,27,0,170,3,42,170,3,47,1,28,28,28,0,19,1,0,0,0,0,0,3,97,108,116,
+1,0,0,254,1,254,1,0,5,0,170,3,54,170,3,78,2,82,84,4,27,0,170,3,54,170,3,59,1,82,82,82,
+27,0,170,3,63,170,3,78,1,84,84,84,0,7,0,171,3,18,182,3,51,3,0,80,79,0,0,171,3,21,171,3,
+37,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,
+113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,171,3,21,171,3,30,1,80,27,0,171,3,21,171,3,24,
+1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,121,112,101,1,0,0,254,1,254,1,0,19,0,171,3,35,171,
+3,37,0,1,99,1,0,0,1,7,0,172,3,17,180,3,78,2,0,79,0,0,172,3,20,172,3,44,2,0,79,14,
+1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,
+1,0,0,254,1,254,1,0,2,0,0,172,3,20,172,3,32,2,0,79,14,0,172,3,20,172,3,27,1,0,27,0,
+172,3,20,172,3,22,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,
+27,0,172,3,29,172,3,31,1,79,79,79,0,19,0,172,3,37,172,3,44,0,6,110,117,109,98,101,114,1,0,0,
+1,0,0,173,3,21,173,3,33,2,0,79,14,0,173,3,21,173,3,28,1,0,27,0,173,3,21,173,3,23,1,0,
+0,0,0,19,1,0,0,0,0,0,4,99,104,97,114,1,0,0,254,1,254,1,0,1,27,0,173,3,30,173,3,32,
+1,79,79,79,0,7,0,174,3,22,180,3,78,2,0,79,0,0,174,3,25,174,3,49,2,0,79,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,
+1,254,1,0,2,0,0,174,3,25,174,3,37,2,0,79,14,0,174,3,25,174,3,32,1,0,27,0,174,3,25,174,
+3,27,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,174,3,
+34,174,3,36,1,79,79,79,0,19,0,174,3,42,174,3,49,0,6,115,116,114,105,110,103,1,0,0,1,7,0,175,
+3,21,178,3,82,2,0,79,0,0,175,3,24,175,3,43,2,0,79,14,1,0,0,0,0,1,0,27,1,0,0,0,
+0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,175,
+3,24,175,3,38,2,0,79,14,0,175,3,24,175,3,33,1,0,27,0,175,3,24,175,3,26,1,0,0,0,0,19,
+1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,175,3,35,175,3,37,1,79,
+79,79,0,18,0,175,3,43,175,3,43,0,1,49,1,27,0,176,3,25,176,3,27,1,79,79,79,10,0,178,3,25,
+178,3,82,2,0,79,5,0,178,3,31,178,3,82,2,0,79,3,19,0,178,3,31,178,3,64,0,32,37,99,32,101,
+120,112,101,99,116,101,100,32,49,45,115,105,122,101,100,32,115,116,114,105,110,103,32,103,111,116,58,32,1,0,0,0,
+0,178,3,68,178,3,82,2,0,79,14,0,178,3,68,178,3,77,1,0,27,0,178,3,68,178,3,70,1,0,0,0,
+0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,178,3,79,178,3,81,
+1,79,79,79,0,10,0,180,3,21,180,3,78,2,0,79,5,0,180,3,27,180,3,78,2,0,79,3,19,0,180,3,
+27,180,3,62,0,34,37,99,32,101,120,112,101,99,116,101,100,32,110,117,109,98,101,114,32,47,32,115,116,114,105,110,
+103,44,32,103,111,116,58,32,1,0,0,0,0,180,3,66,180,3,78,2,0,79,14,0,180,3,66,180,3,73,1,0,
+27,0,180,3,66,180,3,68,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,
+0,1,27,0,180,3,75,180,3,77,1,79,79,79,0,10,0,182,3,17,182,3,51,1,80,5,0,182,3,23,182,3,
+51,1,80,3,19,0,182,3,23,182,3,38,0,14,85,110,107,110,111,119,110,32,99,111,100,101,58,32,1,0,0,14,
+0,182,3,42,182,3,51,1,80,27,0,182,3,42,182,3,45,1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,
+121,112,101,1,0,0,254,1,254,1,0,15,0,185,3,9,152,4,53,6,0,17,37,41,42,78,1,85,11,0,185,3,
+9,152,4,53,5,0,41,42,78,85,5,37,9,6,20,11,7,0,186,3,13,232,3,77,10,0,6,9,11,20,37,41,
+42,78,85,5,0,186,3,16,186,3,37,3,0,6,37,8,27,0,186,3,16,186,3,16,1,6,6,6,0,0,186,3,
+21,186,3,37,2,0,37,14,0,186,3,21,186,3,30,1,0,27,0,186,3,21,186,3,23,1,0,0,0,0,19,1,
+0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,186,3,32,186,3,36,1,37,37,
+37,0,7,0,187,3,17,190,3,21,4,0,9,11,20,5,0,187,3,20,187,3,38,3,0,9,20,9,27,0,187,3,
+20,187,3,20,1,20,20,20,0,0,187,3,24,187,3,38,2,0,9,14,0,187,3,24,187,3,33,1,0,27,0,187,
+3,24,187,3,26,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,
+1,27,0,187,3,35,187,3,37,1,9,9,9,0,10,0,188,3,21,188,3,94,3,0,9,20,5,0,188,3,27,188,
+3,93,3,0,9,20,3,5,0,188,3,27,188,3,89,2,0,9,3,5,0,188,3,27,188,3,73,2,0,9,3,19,
+0,188,3,27,188,3,55,0,27,84,111,111,32,109,97,110,121,32,118,97,108,117,101,115,32,116,111,32,102,111,114,109,
+97,116,58,32,1,0,0,0,0,188,3,59,188,3,73,2,0,9,14,0,188,3,59,188,3,68,1,0,27,0,188,3,
+59,188,3,61,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,
+27,0,188,3,70,188,3,72,1,9,9,9,0,19,0,188,3,77,188,3,89,0,11,44,32,101,120,112,101,99,116,101,
+100,32,1,0,0,27,0,188,3,93,188,3,93,1,20,20,20,27,0,190,3,21,190,3,21,1,11,11,11,15,0,192,
+3,17,232,3,77,10,0,6,9,11,20,37,41,42,78,85,1,80,14,0,192,3,30,192,3,37,2,6,37,27,0,192,
+3,30,192,3,34,1,37,37,37,0,27,0,192,3,36,192,3,36,1,6,6,6,254,1,254,1,0,7,0,193,3,17,
+232,3,77,11,0,6,9,11,20,80,37,41,42,78,85,0,0,193,3,20,193,3,45,2,0,80,14,1,0,0,0,0,
+1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,
+254,1,0,2,0,0,193,3,20,193,3,33,2,0,80,14,0,193,3,20,193,3,27,1,0,27,0,193,3,20,193,3,
+22,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,193,3,29,
+193,3,32,1,80,80,80,0,19,0,193,3,38,193,3,45,0,6,115,116,114,105,110,103,1,0,0,1,0,0,194,3,
+21,194,3,68,7,6,9,11,20,80,37,85,27,0,194,3,21,194,3,36,1,85,85,85,5,27,0,194,3,38,194,3,
+42,1,37,37,37,27,0,194,3,45,194,3,47,1,9,9,9,5,0,194,3,50,194,3,54,1,6,3,27,0,194,3,
+50,194,3,50,1,6,6,6,18,0,194,3,54,194,3,54,0,1,49,27,0,194,3,57,194,3,57,1,20,20,20,5,
+0,194,3,60,194,3,67,2,11,80,3,27,0,194,3,60,194,3,60,1,11,11,11,27,0,194,3,64,194,3,67,1,
+80,80,80,1,15,0,196,3,21,232,3,77,11,0,6,9,11,20,80,37,41,42,78,85,1,86,7,0,196,3,33,205,
+3,21,4,0,9,20,80,0,0,196,3,36,196,3,49,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,
+1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,196,3,
+36,196,3,42,1,80,27,0,196,3,36,196,3,39,1,80,80,80,0,19,1,0,0,0,0,0,2,102,119,1,0,0,
+254,1,254,1,0,19,0,196,3,47,196,3,49,0,1,42,1,0,0,1,8,0,196,3,56,202,3,21,3,0,9,20,
+0,2,1,19,1,0,0,0,0,0,1,106,1,0,0,5,0,197,3,28,197,3,32,1,20,3,27,0,197,3,28,197,
+3,28,1,20,20,20,18,0,197,3,32,197,3,32,0,1,49,1,19,1,0,0,0,0,0,2,102,119,1,0,0,7,
+0,198,3,29,201,3,38,3,0,9,20,5,0,198,3,32,198,3,51,3,0,9,20,8,27,0,198,3,32,198,3,32,
+1,20,20,20,0,0,198,3,37,198,3,51,2,0,9,14,0,198,3,37,198,3,46,1,0,27,0,198,3,37,198,3,
+39,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,198,
+3,48,198,3,50,1,9,9,9,0,10,0,199,3,33,199,3,87,2,0,9,5,0,199,3,39,199,3,87,2,0,9,
+3,19,0,199,3,39,199,3,69,0,29,78,111,116,32,101,110,111,117,103,104,32,118,97,108,117,101,115,32,116,111,32,
+102,111,114,109,97,116,58,32,1,0,0,0,0,199,3,73,199,3,87,2,0,9,14,0,199,3,73,199,3,82,1,0,
+27,0,199,3,73,199,3,75,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,
+254,1,0,1,27,0,199,3,84,199,3,86,1,9,9,9,0,14,0,201,3,33,201,3,38,2,9,20,27,0,201,3,
+33,201,3,35,1,9,9,9,0,27,0,201,3,37,201,3,37,1,20,20,20,254,1,254,1,0,8,0,202,3,28,205,
+3,21,2,20,80,0,2,1,19,1,0,0,0,0,0,1,106,1,0,0,27,0,203,3,28,203,3,28,1,20,20,20,
+1,19,1,0,0,0,0,0,2,102,119,1,0,0,14,0,204,3,29,204,3,35,1,80,27,0,204,3,29,204,3,32,
+1,80,80,80,0,19,1,0,0,0,0,0,2,102,119,1,0,0,254,1,254,1,0,15,0,206,3,21,232,3,77,11,
+0,6,9,11,80,37,41,42,78,85,86,1,87,7,0,206,3,34,215,3,21,4,0,9,80,86,0,0,206,3,37,206,
+3,52,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,
+101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,206,3,37,206,3,45,1,80,27,0,206,3,37,206,3,
+40,1,80,80,80,0,19,1,0,0,0,0,0,4,112,114,101,99,1,0,0,254,1,254,1,0,19,0,206,3,50,206,
+3,52,0,1,42,1,0,0,1,8,0,206,3,59,212,3,21,3,0,9,86,0,2,1,19,1,0,0,0,0,0,1,
+106,1,0,0,5,0,207,3,28,207,3,36,1,86,3,14,0,207,3,28,207,3,32,1,86,27,0,207,3,28,207,3,
+30,1,86,86,86,0,19,1,0,0,0,0,0,1,106,1,0,0,254,1,254,1,0,18,0,207,3,36,207,3,36,0,
+1,49,1,19,1,0,0,0,0,0,4,112,114,101,99,1,0,0,7,0,208,3,31,211,3,42,3,0,9,86,5,0,
+208,3,34,208,3,57,3,0,9,86,8,14,0,208,3,34,208,3,38,1,86,27,0,208,3,34,208,3,36,1,86,86,
+86,0,19,1,0,0,0,0,0,1,106,1,0,0,254,1,254,1,0,0,0,208,3,43,208,3,57,2,0,9,14,0,
+208,3,43,208,3,52,1,0,27,0,208,3,43,208,3,45,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,
+103,116,104,1,0,0,254,1,254,1,0,1,27,0,208,3,54,208,3,56,1,9,9,9,0,10,0,209,3,33,209,3,
+87,2,0,9,5,0,209,3,39,209,3,87,2,0,9,3,19,0,209,3,39,209,3,69,0,29,78,111,116,32,101,110,
+111,117,103,104,32,118,97,108,117,101,115,32,116,111,32,102,111,114,109,97,116,58,32,1,0,0,0,0,209,3,73,209,
+3,87,2,0,9,14,0,209,3,73,209,3,82,1,0,27,0,209,3,73,209,3,75,1,0,0,0,0,19,1,0,0,
+0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,209,3,84,209,3,86,1,9,9,9,0,
+14,0,211,3,33,211,3,42,2,9,86,27,0,211,3,33,211,3,35,1,9,9,9,0,14,0,211,3,37,211,3,41,
+1,86,27,0,211,3,37,211,3,39,1,86,86,86,0,19,1,0,0,0,0,0,1,106,1,0,0,254,1,254,1,0,
+254,1,254,1,0,8,0,212,3,28,215,3,21,2,80,86,0,2,1,19,1,0,0,0,0,0,1,106,1,0,0,14,
+0,213,3,28,213,3,32,1,86,27,0,213,3,28,213,3,30,1,86,86,86,0,19,1,0,0,0,0,0,1,106,1,
+0,0,254,1,254,1,0,1,19,1,0,0,0,0,0,4,112,114,101,99,1,0,0,14,0,214,3,31,214,3,39,1,
+80,27,0,214,3,31,214,3,34,1,80,80,80,0,19,1,0,0,0,0,0,4,112,114,101,99,1,0,0,254,1,254,
+1,0,15,0,216,3,21,232,3,77,12,0,6,9,11,80,37,41,42,78,85,86,87,1,88,14,0,216,3,32,216,3,
+37,1,87,27,0,216,3,32,216,3,35,1,87,87,87,0,19,1,0,0,0,0,0,1,106,1,0,0,254,1,254,1,
+0,15,0,217,3,21,232,3,77,13,0,6,9,11,80,37,41,42,78,85,86,87,88,1,79,7,0,218,3,25,221,3,
+87,3,0,9,88,5,0,218,3,28,218,3,47,3,0,9,88,9,27,0,218,3,28,218,3,29,1,88,88,88,0,0,
+218,3,33,218,3,47,2,0,9,14,0,218,3,33,218,3,42,1,0,27,0,218,3,33,218,3,35,1,0,0,0,0,
+19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,218,3,44,218,3,46,1,
+9,9,9,0,14,0,219,3,29,219,3,35,2,9,88,27,0,219,3,29,219,3,31,1,9,9,9,0,27,0,219,3,
+33,219,3,34,1,88,88,88,254,1,254,1,0,10,0,221,3,29,221,3,87,2,0,9,5,0,221,3,35,221,3,87,
+2,0,9,3,19,0,221,3,35,221,3,69,0,33,78,111,116,32,101,110,111,117,103,104,32,118,97,108,117,101,115,32,
+116,111,32,102,111,114,109,97,116,44,32,103,111,116,32,1,0,0,0,0,221,3,73,221,3,87,2,0,9,14,0,221,
+3,73,221,3,82,1,0,27,0,221,3,73,221,3,75,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,
+116,104,1,0,0,254,1,254,1,0,1,27,0,221,3,84,221,3,86,1,9,9,9,0,15,0,222,3,21,232,3,77,
+14,0,6,9,11,80,37,41,42,78,79,85,86,87,88,1,40,7,0,223,3,25,226,3,73,7,0,80,78,79,86,87,
+88,0,0,223,3,28,223,3,44,2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,
+1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,223,3,28,223,3,37,1,80,
+27,0,223,3,28,223,3,31,1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,121,112,101,1,0,0,254,1,254,
+1,0,19,0,223,3,42,223,3,44,0,1,37,1,0,0,1,19,0,224,3,29,224,3,31,0,1,37,1,0,0,0,
+0,226,3,29,226,3,73,6,80,78,79,86,87,88,27,0,226,3,29,226,3,39,1,78,78,78,5,27,0,226,3,41,
+226,3,43,1,79,79,79,27,0,226,3,46,226,3,49,1,80,80,80,14,0,226,3,52,226,3,57,1,86,27,0,226,
+3,52,226,3,54,1,86,86,86,0,19,1,0,0,0,0,0,2,102,119,1,0,0,254,1,254,1,0,14,0,226,3,
+60,226,3,68,1,87,27,0,226,3,60,226,3,63,1,87,87,87,0,19,1,0,0,0,0,0,4,112,114,101,99,1,
+0,0,254,1,254,1,0,27,0,226,3,71,226,3,72,1,88,88,88,0,15,0,227,3,21,232,3,77,11,6,9,11,
+80,37,40,41,42,85,86,88,1,89,7,0,228,3,25,231,3,52,5,80,40,41,42,86,14,0,228,3,28,228,3,43,
+1,80,14,0,228,3,28,228,3,38,1,80,27,0,228,3,28,228,3,31,1,80,80,80,0,19,1,0,0,0,0,0,
+6,99,102,108,97,103,115,1,0,0,254,1,254,1,0,0,19,1,0,0,0,0,0,4,108,101,102,116,1,0,0,254,
+1,254,1,0,0,0,229,3,29,229,3,53,3,40,42,86,27,0,229,3,29,229,3,37,1,42,42,42,3,27,0,229,
+3,39,229,3,39,1,40,40,40,14,0,229,3,42,229,3,47,1,86,27,0,229,3,42,229,3,44,1,86,86,86,0,
+19,1,0,0,0,0,0,2,102,119,1,0,0,254,1,254,1,0,19,0,229,3,50,229,3,52,0,1,32,1,0,0,
+0,0,0,231,3,29,231,3,52,3,40,41,86,27,0,231,3,29,231,3,36,1,41,41,41,3,27,0,231,3,38,231,
+3,38,1,40,40,40,14,0,231,3,41,231,3,46,1,86,27,0,231,3,41,231,3,43,1,86,86,86,0,19,1,0,
+0,0,0,0,2,102,119,1,0,0,254,1,254,1,0,19,0,231,3,49,231,3,51,0,1,32,1,0,0,0,0,0,
+232,3,21,232,3,77,7,6,9,11,37,85,88,89,27,0,232,3,21,232,3,36,1,85,85,85,5,27,0,232,3,38,
+232,3,42,1,37,37,37,27,0,232,3,45,232,3,47,1,9,9,9,5,0,232,3,50,232,3,54,1,6,3,27,0,
+232,3,50,232,3,50,1,6,6,6,18,0,232,3,54,232,3,54,0,1,49,5,0,232,3,57,232,3,62,1,88,3,
+27,0,232,3,57,232,3,58,1,88,88,88,18,0,232,3,62,232,3,62,0,1,49,5,0,232,3,65,232,3,76,2,
+11,89,3,27,0,232,3,65,232,3,65,1,11,11,11,27,0,232,3,69,232,3,76,1,89,89,89,1,15,0,235,3,
+9,152,4,53,7,0,17,37,41,42,78,85,1,90,11,0,235,3,9,152,4,53,5,0,41,42,78,90,4,37,91,6,
+11,7,0,236,3,13,145,4,69,9,0,6,11,37,41,42,78,90,91,5,0,236,3,16,236,3,37,3,0,6,37,8,
+27,0,236,3,16,236,3,16,1,6,6,6,0,0,236,3,21,236,3,37,2,0,37,14,0,236,3,21,236,3,30,1,
+0,27,0,236,3,21,236,3,23,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,
+1,254,1,0,1,27,0,236,3,32,236,3,36,1,37,37,37,0,27,0,237,3,17,237,3,17,1,11,11,11,15,0,
+239,3,17,145,4,69,9,0,6,11,37,41,42,78,90,91,1,80,14,0,239,3,30,239,3,37,2,6,37,27,0,239,
+3,30,239,3,34,1,37,37,37,0,27,0,239,3,36,239,3,36,1,6,6,6,254,1,254,1,0,7,0,240,3,17,
+145,4,69,10,0,6,11,80,37,41,42,78,90,91,0,0,240,3,20,240,3,45,2,0,80,14,1,0,0,0,0,1,
+0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,
+1,0,2,0,0,240,3,20,240,3,33,2,0,80,14,0,240,3,20,240,3,27,1,0,27,0,240,3,20,240,3,22,
+1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,240,3,29,240,
+3,32,1,80,80,80,0,19,0,240,3,38,240,3,45,0,6,115,116,114,105,110,103,1,0,0,1,0,0,241,3,21,
+241,3,65,6,6,11,80,37,90,91,27,0,241,3,21,241,3,36,1,90,90,90,4,27,0,241,3,38,241,3,42,1,
+37,37,37,27,0,241,3,45,241,3,47,1,91,91,91,5,0,241,3,50,241,3,54,1,6,3,27,0,241,3,50,241,
+3,50,1,6,6,6,18,0,241,3,54,241,3,54,0,1,49,5,0,241,3,57,241,3,64,2,11,80,3,27,0,241,
+3,57,241,3,57,1,11,11,11,27,0,241,3,61,241,3,64,1,80,80,80,1,15,0,243,3,21,145,4,69,10,0,
+6,11,80,37,41,42,78,90,91,1,92,7,0,244,3,25,247,3,37,2,0,80,0,0,244,3,28,244,3,44,2,0,
+80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,
+108,115,1,0,0,254,1,254,1,0,2,14,0,244,3,28,244,3,36,1,80,27,0,244,3,28,244,3,31,1,80,80,
+80,0,19,1,0,0,0,0,0,4,109,107,101,121,1,0,0,254,1,254,1,0,17,0,244,3,41,244,3,44,0,1,
+10,0,245,3,29,245,3,58,0,19,0,245,3,35,245,3,58,0,22,77,97,112,112,105,110,103,32,107,101,121,115,32,
+114,101,113,117,105,114,101,100,46,1,0,0,14,0,247,3,29,247,3,37,1,80,27,0,247,3,29,247,3,32,1,80,
+80,80,0,19,1,0,0,0,0,0,4,109,107,101,121,1,0,0,254,1,254,1,0,15,0,248,3,21,145,4,69,11,
+0,6,11,80,37,41,42,78,90,91,92,1,29,7,0,249,3,25,252,3,35,2,0,80,0,0,249,3,28,249,3,41,
+2,0,80,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,
+117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,249,3,28,249,3,34,1,80,27,0,249,3,28,249,3,31,1,
+80,80,80,0,19,1,0,0,0,0,0,2,102,119,1,0,0,254,1,254,1,0,19,0,249,3,39,249,3,41,0,1,
+42,1,0,0,1,10,0,250,3,29,250,3,73,0,19,0,250,3,35,250,3,73,0,37,67,97,110,110,111,116,32,117,
+115,101,32,42,32,102,105,101,108,100,32,119,105,100,116,104,32,119,105,116,104,32,111,98,106,101,99,116,46,1,0,0,
+14,0,252,3,29,252,3,35,1,80,27,0,252,3,29,252,3,32,1,80,80,80,0,19,1,0,0,0,0,0,2,102,
+119,1,0,0,254,1,254,1,0,15,0,253,3,21,145,4,69,12,0,6,11,29,80,37,41,42,78,90,91,92,1,30,
+7,0,254,3,25,129,4,37,2,0,80,0,0,254,3,28,254,3,43,2,0,80,14,1,0,0,0,0,1,0,27,1,
+0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,
+14,0,254,3,28,254,3,36,1,80,27,0,254,3,28,254,3,31,1,80,80,80,0,19,1,0,0,0,0,0,4,112,
+114,101,99,1,0,0,254,1,254,1,0,19,0,254,3,41,254,3,43,0,1,42,1,0,0,1,10,0,255,3,29,255,
+3,71,0,19,0,255,3,35,255,3,71,0,35,67,97,110,110,111,116,32,117,115,101,32,42,32,112,114,101,99,105,115,
+105,111,110,32,119,105,116,104,32,111,98,106,101,99,116,46,1,0,0,14,0,129,4,29,129,4,37,1,80,27,0,129,
+4,29,129,4,32,1,80,80,80,0,19,1,0,0,0,0,0,4,112,114,101,99,1,0,0,254,1,254,1,0,15,0,
+130,4,21,145,4,69,13,0,6,11,29,30,80,37,41,42,78,90,91,92,1,79,7,0,131,4,25,134,4,55,3,0,
+91,92,0,0,131,4,28,131,4,51,3,0,91,92,14,0,131,4,28,131,4,43,1,0,27,0,131,4,28,131,4,30,
+1,0,0,0,0,19,1,0,0,0,0,0,12,111,98,106,101,99,116,72,97,115,65,108,108,1,0,0,254,1,254,1,
+0,2,27,0,131,4,45,131,4,47,1,91,91,91,27,0,131,4,50,131,4,50,1,92,92,92,0,14,0,132,4,29,
+132,4,34,2,91,92,27,0,132,4,29,132,4,31,1,91,91,91,0,27,0,132,4,33,132,4,33,1,92,92,92,254,
+1,254,1,0,10,0,134,4,29,134,4,55,1,92,5,0,134,4,35,134,4,55,1,92,3,19,0,134,4,35,134,4,
+51,0,15,78,111,32,115,117,99,104,32,102,105,101,108,100,58,32,1,0,0,27,0,134,4,55,134,4,55,1,92,92,
+92,15,0,135,4,21,145,4,69,14,0,6,11,29,30,80,37,41,42,78,79,90,91,92,1,40,7,0,136,4,25,139,
+4,63,7,0,29,30,80,78,79,92,0,0,136,4,28,136,4,44,2,0,80,14,1,0,0,0,0,1,0,27,1,0,
+0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,
+0,136,4,28,136,4,37,1,80,27,0,136,4,28,136,4,31,1,80,80,80,0,19,1,0,0,0,0,0,5,99,116,
+121,112,101,1,0,0,254,1,254,1,0,19,0,136,4,42,136,4,44,0,1,37,1,0,0,1,19,0,137,4,29,137,
+4,31,0,1,37,1,0,0,0,0,139,4,29,139,4,63,6,29,30,80,78,79,92,27,0,139,4,29,139,4,39,1,
+78,78,78,5,27,0,139,4,41,139,4,43,1,79,79,79,27,0,139,4,46,139,4,49,1,80,80,80,27,0,139,4,
+52,139,4,53,1,29,29,29,27,0,139,4,56,139,4,59,1,30,30,30,27,0,139,4,62,139,4,62,1,92,92,92,
+0,15,0,140,4,21,145,4,69,10,6,11,29,80,37,40,41,42,90,91,1,89,7,0,141,4,25,144,4,48,5,29,
+80,40,41,42,14,0,141,4,28,141,4,43,1,80,14,0,141,4,28,141,4,38,1,80,27,0,141,4,28,141,4,31,
+1,80,80,80,0,19,1,0,0,0,0,0,6,99,102,108,97,103,115,1,0,0,254,1,254,1,0,0,19,1,0,0,
+0,0,0,4,108,101,102,116,1,0,0,254,1,254,1,0,0,0,142,4,29,142,4,49,3,29,40,42,27,0,142,4,
+29,142,4,37,1,42,42,42,3,27,0,142,4,39,142,4,39,1,40,40,40,27,0,142,4,42,142,4,43,1,29,29,
+29,19,0,142,4,46,142,4,48,0,1,32,1,0,0,0,0,0,144,4,29,144,4,48,3,29,40,41,27,0,144,4,
+29,144,4,36,1,41,41,41,3,27,0,144,4,38,144,4,38,1,40,40,40,27,0,144,4,41,144,4,42,1,29,29,
+29,19,0,144,4,45,144,4,47,0,1,32,1,0,0,0,0,0,145,4,21,145,4,69,6,6,11,37,89,90,91,27,
+0,145,4,21,145,4,36,1,90,90,90,4,27,0,145,4,38,145,4,42,1,37,37,37,27,0,145,4,45,145,4,47,
+1,91,91,91,5,0,145,4,50,145,4,54,1,6,3,27,0,145,4,50,145,4,50,1,6,6,6,18,0,145,4,54,
+145,4,54,0,1,49,5,0,145,4,57,145,4,68,2,11,89,3,27,0,145,4,57,145,4,57,1,11,11,11,27,0,
+145,4,61,145,4,68,1,89,89,89,1,7,0,147,4,9,152,4,53,5,0,17,37,85,90,0,0,147,4,12,147,4,
+36,2,0,17,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,
+113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,147,4,12,147,4,25,2,0,17,14,0,147,4,12,147,4,
+19,1,0,27,0,147,4,12,147,4,14,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,
+1,254,1,0,1,27,0,147,4,21,147,4,24,1,17,17,17,0,19,0,147,4,30,147,4,36,0,5,97,114,114,97,
+121,1,0,0,1,0,0,148,4,13,148,4,51,3,17,37,85,27,0,148,4,13,148,4,28,1,85,85,85,5,27,0,
+148,4,30,148,4,34,1,37,37,37,27,0,148,4,37,148,4,40,1,17,17,17,18,0,148,4,43,148,4,43,0,1,
+48,18,0,148,4,46,148,4,46,0,1,48,19,0,148,4,49,148,4,50,0,0,1,0,0,0,7,0,149,4,14,152,
+4,53,5,0,17,37,85,90,0,0,149,4,17,149,4,42,2,0,17,14,1,0,0,0,0,1,0,27,1,0,0,0,
+0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,149,
+4,17,149,4,30,2,0,17,14,0,149,4,17,149,4,24,1,0,27,0,149,4,17,149,4,19,1,0,0,0,0,19,
+1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,149,4,26,149,4,29,1,17,17,17,
+0,19,0,149,4,35,149,4,42,0,6,111,98,106,101,99,116,1,0,0,1,0,0,150,4,13,150,4,48,3,17,37,
+90,27,0,150,4,13,150,4,28,1,90,90,90,4,27,0,150,4,30,150,4,34,1,37,37,37,27,0,150,4,37,150,
+4,40,1,17,17,17,18,0,150,4,43,150,4,43,0,1,48,19,0,150,4,46,150,4,47,0,0,1,0,0,0,0,
+0,152,4,13,152,4,53,3,17,37,85,27,0,152,4,13,152,4,28,1,85,85,85,5,27,0,152,4,30,152,4,34,
+1,37,37,37,1,0,152,4,37,152,4,42,1,17,1,27,0,152,4,38,152,4,41,1,17,17,17,18,0,152,4,45,
+152,4,45,0,1,48,18,0,152,4,48,152,4,48,0,1,48,19,0,152,4,51,152,4,52,0,0,1,0,0,0,0,
+19,1,0,0,0,0,0,5,102,111,108,100,114,1,0,0,15,0,155,4,9,160,4,49,0,2,0,255,1,1,1,255,
+1,2,11,0,155,4,9,160,4,49,1,0,3,12,9,93,15,0,155,4,9,160,4,49,4,0,9,12,93,1,14,11,
+0,155,4,9,160,4,49,1,14,4,12,9,16,94,7,0,156,4,13,159,4,64,5,9,12,14,16,94,5,0,156,4,
+16,156,4,22,1,94,9,27,0,156,4,16,156,4,18,1,94,94,94,18,0,156,4,22,156,4,22,0,1,48,27,0,
+157,4,17,157,4,23,1,16,16,16,0,0,159,4,17,159,4,64,5,9,12,14,16,94,27,0,159,4,17,159,4,19,
+1,14,14,14,4,27,0,159,4,21,159,4,24,1,12,12,12,27,0,159,4,27,159,4,29,1,9,9,9,0,0,159,
+4,32,159,4,54,4,9,12,16,94,27,0,159,4,32,159,4,35,1,12,12,12,2,14,0,159,4,37,159,4,44,2,
+9,94,27,0,159,4,37,159,4,39,1,9,9,9,0,27,0,159,4,41,159,4,43,1,94,94,94,254,1,254,1,0,
+27,0,159,4,47,159,4,53,1,16,16,16,0,5,0,159,4,57,159,4,63,1,94,4,27,0,159,4,57,159,4,59,
+1,94,94,94,18,0,159,4,63,159,4,63,0,1,49,1,0,0,160,4,9,160,4,49,5,0,9,12,14,93,27,0,
+160,4,9,160,4,11,1,14,14,14,4,27,0,160,4,13,160,4,16,1,12,12,12,27,0,160,4,19,160,4,21,1,
+9,9,9,27,0,160,4,24,160,4,27,1,93,93,93,5,0,160,4,30,160,4,48,2,0,9,4,0,0,160,4,30,
+160,4,44,2,0,9,14,0,160,4,30,160,4,39,1,0,27,0,160,4,30,160,4,32,1,0,0,0,0,19,1,0,
+0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,160,4,41,160,4,43,1,9,9,9,
+0,18,0,160,4,48,160,4,48,0,1,49,0,0,19,1,0,0,0,0,0,5,102,111,108,100,108,1,0,0,15,0,
+163,4,9,168,4,31,0,2,0,255,1,1,1,255,1,2,11,0,163,4,9,168,4,31,1,0,3,12,9,93,15,0,
+163,4,9,168,4,31,4,0,9,12,93,1,14,11,0,163,4,9,168,4,31,2,0,14,4,12,9,16,94,7,0,164,
+4,13,167,4,64,6,0,9,12,14,16,94,5,0,164,4,16,164,4,37,3,0,9,94,8,27,0,164,4,16,164,4,
+18,1,94,94,94,0,0,164,4,23,164,4,37,2,0,9,14,0,164,4,23,164,4,32,1,0,27,0,164,4,23,164,
+4,25,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,
+164,4,34,164,4,36,1,9,9,9,0,27,0,165,4,17,165,4,23,1,16,16,16,0,0,167,4,17,167,4,64,5,
+9,12,14,16,94,27,0,167,4,17,167,4,19,1,14,14,14,4,27,0,167,4,21,167,4,24,1,12,12,12,27,0,
+167,4,27,167,4,29,1,9,9,9,0,0,167,4,32,167,4,54,4,9,12,16,94,27,0,167,4,32,167,4,35,1,
+12,12,12,2,27,0,167,4,37,167,4,43,1,16,16,16,14,0,167,4,46,167,4,53,2,9,94,27,0,167,4,46,
+167,4,48,1,9,9,9,0,27,0,167,4,50,167,4,52,1,94,94,94,254,1,254,1,0,0,5,0,167,4,57,167,
+4,63,1,94,3,27,0,167,4,57,167,4,59,1,94,94,94,18,0,167,4,63,167,4,63,0,1,49,1,0,0,168,
+4,9,168,4,31,4,9,12,14,93,27,0,168,4,9,168,4,11,1,14,14,14,4,27,0,168,4,13,168,4,16,1,
+12,12,12,27,0,168,4,19,168,4,21,1,9,9,9,27,0,168,4,24,168,4,27,1,93,93,93,18,0,168,4,30,
+168,4,30,0,1,48,0,0,19,1,0,0,0,0,0,9,102,105,108,116,101,114,77,97,112,1,0,0,15,0,172,4,
+9,179,4,59,0,2,0,255,1,1,1,255,1,2,11,0,172,4,9,179,4,59,1,0,3,95,96,9,7,0,172,4,
+9,179,4,59,4,0,9,95,96,26,0,172,4,12,172,4,46,2,0,95,0,0,0,172,4,12,172,4,46,2,0,95,
+14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,
+115,1,0,0,254,1,254,1,0,2,0,0,172,4,12,172,4,32,2,0,95,14,0,172,4,12,172,4,19,1,0,27,
+0,172,4,12,172,4,14,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,
+1,27,0,172,4,21,172,4,31,1,95,95,95,0,19,0,172,4,37,172,4,46,0,8,102,117,110,99,116,105,111,110,
+1,0,0,1,10,0,173,4,13,173,4,93,2,0,95,5,0,173,4,19,173,4,92,2,0,95,3,19,0,173,4,19,
+173,4,68,0,48,115,116,100,46,102,105,108,116,101,114,77,97,112,32,102,105,114,115,116,32,112,97,114,97,109,32,109,
+117,115,116,32,98,101,32,102,117,110,99,116,105,111,110,44,32,103,111,116,32,1,0,0,0,0,173,4,72,173,4,92,
+2,0,95,14,0,173,4,72,173,4,79,1,0,27,0,173,4,72,173,4,74,1,0,0,0,0,19,1,0,0,0,0,
+0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,173,4,81,173,4,91,1,95,95,95,0,7,0,174,4,
+14,179,4,59,4,0,9,95,96,26,0,174,4,17,174,4,48,2,0,96,0,0,0,174,4,17,174,4,48,2,0,96,
+14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,
+115,1,0,0,254,1,254,1,0,2,0,0,174,4,17,174,4,34,2,0,96,14,0,174,4,17,174,4,24,1,0,27,
+0,174,4,17,174,4,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,
+1,27,0,174,4,26,174,4,33,1,96,96,96,0,19,0,174,4,39,174,4,48,0,8,102,117,110,99,116,105,111,110,
+1,0,0,1,10,0,175,4,13,175,4,91,2,0,96,5,0,175,4,19,175,4,90,2,0,96,3,19,0,175,4,19,
+175,4,69,0,49,115,116,100,46,102,105,108,116,101,114,77,97,112,32,115,101,99,111,110,100,32,112,97,114,97,109,32,
+109,117,115,116,32,98,101,32,102,117,110,99,116,105,111,110,44,32,103,111,116,32,1,0,0,0,0,175,4,73,175,4,
+90,2,0,96,14,0,175,4,73,175,4,80,1,0,27,0,175,4,73,175,4,75,1,0,0,0,0,19,1,0,0,0,
+0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,175,4,82,175,4,89,1,96,96,96,0,7,0,176,
+4,14,179,4,59,4,0,9,95,96,26,0,176,4,17,176,4,40,2,0,9,0,0,0,176,4,17,176,4,40,2,0,
+9,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,
+108,115,1,0,0,254,1,254,1,0,2,0,0,176,4,17,176,4,29,2,0,9,14,0,176,4,17,176,4,24,1,0,
+27,0,176,4,17,176,4,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,
+0,1,27,0,176,4,26,176,4,28,1,9,9,9,0,19,0,176,4,34,176,4,40,0,5,97,114,114,97,121,1,0,
+0,1,10,0,177,4,13,177,4,82,2,0,9,5,0,177,4,19,177,4,81,2,0,9,3,19,0,177,4,19,177,4,
+65,0,45,115,116,100,46,102,105,108,116,101,114,77,97,112,32,116,104,105,114,100,32,112,97,114,97,109,32,109,117,115,
+116,32,98,101,32,97,114,114,97,121,44,32,103,111,116,32,1,0,0,0,0,177,4,69,177,4,81,2,0,9,14,0,
+177,4,69,177,4,76,1,0,27,0,177,4,69,177,4,71,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,
+101,1,0,0,254,1,254,1,0,1,27,0,177,4,78,177,4,80,1,9,9,9,0,0,0,179,4,13,179,4,59,4,
+0,9,95,96,14,0,179,4,13,179,4,19,1,0,27,0,179,4,13,179,4,15,1,0,0,0,0,19,1,0,0,0,
+0,0,3,109,97,112,1,0,0,254,1,254,1,0,2,27,0,179,4,21,179,4,28,1,96,96,96,0,0,179,4,31,
+179,4,58,3,0,9,95,14,0,179,4,31,179,4,40,1,0,27,0,179,4,31,179,4,33,1,0,0,0,0,19,1,
+0,0,0,0,0,6,102,105,108,116,101,114,1,0,0,254,1,254,1,0,2,27,0,179,4,42,179,4,52,1,95,95,
+95,27,0,179,4,55,179,4,57,1,9,9,9,0,0,0,19,1,0,0,0,0,0,11,97,115,115,101,114,116,69,113,
+117,97,108,1,0,0,15,0,182,4,9,185,4,55,0,2,0,255,1,1,1,255,1,2,11,0,182,4,9,185,4,55,
+1,0,2,2,7,7,0,182,4,9,185,4,55,3,0,2,7,0,0,182,4,12,182,4,17,3,0,2,7,14,1,0,
+0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,
+0,254,1,254,1,0,2,27,0,182,4,12,182,4,12,1,2,2,2,27,0,182,4,17,182,4,17,1,7,7,7,1,
+16,0,183,4,13,183,4,16,0,1,10,0,185,4,13,185,4,55,2,2,7,5,0,185,4,19,185,4,55,2,2,7,
+3,5,0,185,4,19,185,4,51,1,2,3,5,0,185,4,19,185,4,42,1,2,3,19,0,185,4,19,185,4,38,0,
+18,65,115,115,101,114,116,105,111,110,32,102,97,105,108,101,100,46,32,1,0,0,27,0,185,4,42,185,4,42,1,2,
+2,2,19,0,185,4,46,185,4,51,0,4,32,33,61,32,1,0,0,27,0,185,4,55,185,4,55,1,7,7,7,0,
+19,1,0,0,0,0,0,3,97,98,115,1,0,0,15,0,188,4,9,191,4,35,0,2,0,255,1,1,1,255,1,2,
+11,0,188,4,9,191,4,35,1,0,1,52,7,0,188,4,9,191,4,35,2,0,52,26,0,188,4,12,188,4,34,2,
+0,52,0,0,0,188,4,12,188,4,34,2,0,52,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,
+0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,188,4,12,188,4,22,
+2,0,52,14,0,188,4,12,188,4,19,1,0,27,0,188,4,12,188,4,14,1,0,0,0,0,19,1,0,0,0,0,
+0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,188,4,21,188,4,21,1,52,52,52,0,19,0,188,4,
+27,188,4,34,0,6,110,117,109,98,101,114,1,0,0,1,10,0,189,4,13,189,4,63,2,0,52,5,0,189,4,19,
+189,4,63,2,0,52,3,19,0,189,4,19,189,4,49,0,29,115,116,100,46,97,98,115,32,101,120,112,101,99,116,101,
+100,32,110,117,109,98,101,114,44,32,103,111,116,32,1,0,0,0,0,189,4,53,189,4,63,2,0,52,14,0,189,4,
+53,189,4,60,1,0,27,0,189,4,53,189,4,55,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,
+0,0,254,1,254,1,0,1,27,0,189,4,62,189,4,62,1,52,52,52,0,7,0,191,4,13,191,4,35,1,52,5,
+0,191,4,16,191,4,20,1,52,7,27,0,191,4,16,191,4,16,1,52,52,52,18,0,191,4,20,191,4,20,0,1,
+48,27,0,191,4,27,191,4,27,1,52,52,52,26,0,191,4,34,191,4,35,1,52,3,27,0,191,4,35,191,4,35,
+1,52,52,52,0,19,1,0,0,0,0,0,3,109,97,120,1,0,0,15,0,194,4,9,199,4,34,0,2,0,255,1,
+1,1,255,1,2,11,0,194,4,9,199,4,34,1,0,2,2,7,7,0,194,4,9,199,4,34,3,0,2,7,26,0,
+194,4,12,194,4,34,2,0,2,0,0,0,194,4,12,194,4,34,2,0,2,14,1,0,0,0,0,1,0,27,1,0,
+0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,
+0,194,4,12,194,4,22,2,0,2,14,0,194,4,12,194,4,19,1,0,27,0,194,4,12,194,4,14,1,0,0,0,
+0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,194,4,21,194,4,21,1,2,
+2,2,0,19,0,194,4,27,194,4,34,0,6,110,117,109,98,101,114,1,0,0,1,10,0,195,4,13,195,4,75,2,
+0,2,5,0,195,4,19,195,4,75,2,0,2,3,19,0,195,4,19,195,4,61,0,41,115,116,100,46,109,97,120,32,
+102,105,114,115,116,32,112,97,114,97,109,32,101,120,112,101,99,116,101,100,32,110,117,109,98,101,114,44,32,103,111,116,
+32,1,0,0,0,0,195,4,65,195,4,75,2,0,2,14,0,195,4,65,195,4,72,1,0,27,0,195,4,65,195,4,
+67,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,195,4,74,
+195,4,74,1,2,2,2,0,7,0,196,4,14,199,4,34,3,0,2,7,26,0,196,4,17,196,4,39,2,0,7,0,
+0,0,196,4,17,196,4,39,2,0,7,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,
+0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,196,4,17,196,4,27,2,0,7,
+14,0,196,4,17,196,4,24,1,0,27,0,196,4,17,196,4,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,
+121,112,101,1,0,0,254,1,254,1,0,1,27,0,196,4,26,196,4,26,1,7,7,7,0,19,0,196,4,32,196,4,
+39,0,6,110,117,109,98,101,114,1,0,0,1,10,0,197,4,13,197,4,76,2,0,7,5,0,197,4,19,197,4,76,
+2,0,7,3,19,0,197,4,19,197,4,62,0,42,115,116,100,46,109,97,120,32,115,101,99,111,110,100,32,112,97,114,
+97,109,32,101,120,112,101,99,116,101,100,32,110,117,109,98,101,114,44,32,103,111,116,32,1,0,0,0,0,197,4,66,
+197,4,76,2,0,7,14,0,197,4,66,197,4,73,1,0,27,0,197,4,66,197,4,68,1,0,0,0,0,19,1,0,
+0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,197,4,75,197,4,75,1,7,7,7,0,7,
+0,199,4,13,199,4,34,2,2,7,5,0,199,4,16,199,4,20,2,2,7,7,27,0,199,4,16,199,4,16,1,2,
+2,2,27,0,199,4,20,199,4,20,1,7,7,7,27,0,199,4,27,199,4,27,1,2,2,2,27,0,199,4,34,199,
+4,34,1,7,7,7,0,19,1,0,0,0,0,0,3,109,105,110,1,0,0,15,0,202,4,9,207,4,34,0,2,0,
+255,1,1,1,255,1,2,11,0,202,4,9,207,4,34,1,0,2,2,7,7,0,202,4,9,207,4,34,3,0,2,7,
+26,0,202,4,12,202,4,34,2,0,2,0,0,0,202,4,12,202,4,34,2,0,2,14,1,0,0,0,0,1,0,27,
+1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,
+2,0,0,202,4,12,202,4,22,2,0,2,14,0,202,4,12,202,4,19,1,0,27,0,202,4,12,202,4,14,1,0,
+0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,202,4,21,202,4,21,
+1,2,2,2,0,19,0,202,4,27,202,4,34,0,6,110,117,109,98,101,114,1,0,0,1,10,0,203,4,13,203,4,
+75,2,0,2,5,0,203,4,19,203,4,75,2,0,2,3,19,0,203,4,19,203,4,61,0,41,115,116,100,46,109,97,
+120,32,102,105,114,115,116,32,112,97,114,97,109,32,101,120,112,101,99,116,101,100,32,110,117,109,98,101,114,44,32,103,
+111,116,32,1,0,0,0,0,203,4,65,203,4,75,2,0,2,14,0,203,4,65,203,4,72,1,0,27,0,203,4,65,
+203,4,67,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,203,
+4,74,203,4,74,1,2,2,2,0,7,0,204,4,14,207,4,34,3,0,2,7,26,0,204,4,17,204,4,39,2,0,
+7,0,0,0,204,4,17,204,4,39,2,0,7,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,
+19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,204,4,17,204,4,27,2,
+0,7,14,0,204,4,17,204,4,24,1,0,27,0,204,4,17,204,4,19,1,0,0,0,0,19,1,0,0,0,0,0,
+4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,204,4,26,204,4,26,1,7,7,7,0,19,0,204,4,32,
+204,4,39,0,6,110,117,109,98,101,114,1,0,0,1,10,0,205,4,13,205,4,76,2,0,7,5,0,205,4,19,205,
+4,76,2,0,7,3,19,0,205,4,19,205,4,62,0,42,115,116,100,46,109,97,120,32,115,101,99,111,110,100,32,112,
+97,114,97,109,32,101,120,112,101,99,116,101,100,32,110,117,109,98,101,114,44,32,103,111,116,32,1,0,0,0,0,205,
+4,66,205,4,76,2,0,7,14,0,205,4,66,205,4,73,1,0,27,0,205,4,66,205,4,68,1,0,0,0,0,19,
+1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,205,4,75,205,4,75,1,7,7,7,
+0,7,0,207,4,13,207,4,34,2,2,7,5,0,207,4,16,207,4,20,2,2,7,9,27,0,207,4,16,207,4,16,
+1,2,2,2,27,0,207,4,20,207,4,20,1,7,7,7,27,0,207,4,27,207,4,27,1,2,2,2,27,0,207,4,
+34,207,4,34,1,7,7,7,0,19,1,0,0,0,0,0,13,102,108,97,116,116,101,110,65,114,114,97,121,115,1,0,
+0,15,0,210,4,9,210,4,48,0,2,0,255,1,1,1,255,1,2,11,0,210,4,9,210,4,48,1,0,1,97,0,
+0,210,4,9,210,4,48,2,0,97,14,0,210,4,9,210,4,17,1,0,27,0,210,4,9,210,4,11,1,0,0,0,
+0,19,1,0,0,0,0,0,5,102,111,108,100,108,1,0,0,254,1,254,1,0,3,11,0,210,4,19,210,4,37,0,
+2,2,7,5,0,210,4,33,210,4,37,2,2,7,3,27,0,210,4,33,210,4,33,1,2,2,2,27,0,210,4,37,
+210,4,37,1,7,7,7,27,0,210,4,40,210,4,43,1,97,97,97,1,0,210,4,46,210,4,47,0,0,0,0,19,
+1,0,0,0,0,0,11,109,97,110,105,102,101,115,116,73,110,105,1,0,0,15,0,213,4,9,218,4,74,0,2,0,
+255,1,1,1,255,1,2,11,0,213,4,9,218,4,74,1,0,1,98,15,0,213,4,9,218,4,74,2,0,98,4,99,
+11,0,213,4,9,218,4,74,1,0,1,100,15,0,213,4,34,213,4,93,2,0,100,2,101,0,0,213,4,70,213,4,
+91,2,0,100,14,0,213,4,70,213,4,85,1,0,27,0,213,4,70,213,4,72,1,0,0,0,0,19,1,0,0,0,
+0,0,12,111,98,106,101,99,116,70,105,101,108,100,115,1,0,0,254,1,254,1,0,1,27,0,213,4,87,213,4,90,
+1,100,100,100,0,102,11,0,213,4,34,213,4,93,4,0,100,101,102,2,103,104,7,0,213,4,34,213,4,93,6,0,
+100,104,101,103,102,5,1,0,0,0,0,3,0,101,103,8,27,1,0,0,0,0,1,103,103,103,0,1,0,0,0,0,
+2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,
+110,103,116,104,1,0,0,254,1,254,1,0,1,27,1,0,0,0,0,1,101,101,101,1,27,1,0,0,0,0,1,104,
+104,104,15,0,213,4,34,213,4,93,6,0,100,104,101,103,102,1,105,14,1,0,0,0,0,2,101,103,27,1,0,0,
+0,0,1,101,101,101,0,27,1,0,0,0,0,1,103,103,103,254,1,254,1,0,0,0,213,4,36,213,4,59,6,0,
+100,105,104,103,102,27,1,0,0,0,0,1,102,102,102,2,5,1,0,0,0,0,1,103,3,27,1,0,0,0,0,1,
+103,103,103,18,1,0,0,0,0,0,3,49,46,48,5,1,0,0,0,0,4,0,100,105,104,3,27,1,0,0,0,0,
+1,104,104,104,1,0,213,4,36,213,4,59,3,0,100,105,1,0,0,213,4,36,213,4,59,3,0,100,105,14,1,0,
+0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,0,0,254,1,
+254,1,0,2,19,0,213,4,36,213,4,44,0,7,37,115,32,61,32,37,115,1,0,0,1,0,213,4,48,213,4,59,
+2,100,105,2,27,0,213,4,49,213,4,49,1,105,105,105,14,0,213,4,52,213,4,58,2,100,105,27,0,213,4,52,
+213,4,55,1,100,100,100,0,27,0,213,4,57,213,4,57,1,105,105,105,254,1,254,1,0,0,1,7,0,213,4,34,
+213,4,93,3,0,101,102,0,0,213,4,34,213,4,93,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,
+1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,1,0,0,
+0,0,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,4,
+116,121,112,101,1,0,0,254,1,254,1,0,1,27,1,0,0,0,0,1,101,101,101,1,19,1,0,0,0,0,0,5,
+97,114,114,97,121,1,0,0,1,0,1,0,0,0,0,1,102,27,1,0,0,0,0,1,102,102,102,2,18,1,0,0,
+0,0,0,3,48,46,48,1,1,0,0,0,0,0,0,1,10,0,213,4,34,213,4,93,0,19,0,213,4,34,213,4,
+93,0,46,73,110,32,99,111,109,112,114,101,104,101,110,115,105,111,110,44,32,99,97,110,32,111,110,108,121,32,105,116,
+101,114,97,116,101,32,111,118,101,114,32,97,114,114,97,121,46,1,0,0,106,11,0,213,4,9,218,4,74,2,0,99,
+2,107,108,5,0,214,4,45,214,4,84,4,0,99,107,108,3,1,0,214,4,45,214,4,64,2,0,107,1,0,0,214,
+4,47,214,4,62,2,0,107,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,
+0,0,3,109,111,100,1,0,0,254,1,254,1,0,2,19,0,214,4,47,214,4,52,0,4,91,37,115,93,1,0,0,
+1,0,214,4,56,214,4,62,1,107,1,27,0,214,4,57,214,4,61,1,107,107,107,0,0,0,214,4,68,214,4,84,
+2,99,108,27,0,214,4,68,214,4,77,1,99,99,99,1,27,0,214,4,79,214,4,83,1,108,108,108,0,109,7,0,
+215,4,27,215,4,89,3,0,98,99,0,0,215,4,30,215,4,55,2,0,98,14,0,215,4,30,215,4,42,1,0,27,
+0,215,4,30,215,4,32,1,0,0,0,0,19,1,0,0,0,0,0,9,111,98,106,101,99,116,72,97,115,1,0,0,
+254,1,254,1,0,2,27,0,215,4,44,215,4,46,1,98,98,98,19,0,215,4,49,215,4,54,0,4,109,97,105,110,
+1,0,0,0,0,0,215,4,62,215,4,81,2,98,99,27,0,215,4,62,215,4,71,1,99,99,99,1,14,0,215,4,
+73,215,4,80,1,98,27,0,215,4,73,215,4,75,1,98,98,98,0,19,1,0,0,0,0,0,4,109,97,105,110,1,
+0,0,254,1,254,1,0,0,1,0,215,4,88,215,4,89,0,0,110,15,0,216,4,30,217,4,70,3,0,98,106,2,
+101,0,0,217,4,40,217,4,69,2,0,98,14,0,217,4,40,217,4,55,1,0,27,0,217,4,40,217,4,42,1,0,
+0,0,0,19,1,0,0,0,0,0,12,111,98,106,101,99,116,70,105,101,108,100,115,1,0,0,254,1,254,1,0,1,
+14,0,217,4,57,217,4,68,1,98,27,0,217,4,57,217,4,59,1,98,98,98,0,19,1,0,0,0,0,0,8,115,
+101,99,116,105,111,110,115,1,0,0,254,1,254,1,0,0,102,11,0,216,4,30,217,4,70,5,0,98,106,101,102,2,
+103,104,7,0,216,4,30,217,4,70,7,0,98,106,104,101,103,102,5,1,0,0,0,0,3,0,101,103,8,27,1,0,
+0,0,0,1,103,103,103,0,1,0,0,0,0,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,
+0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,1,0,0,0,0,
+1,101,101,101,1,27,1,0,0,0,0,1,104,104,104,15,0,216,4,30,217,4,70,6,98,106,104,101,103,102,1,105,
+14,1,0,0,0,0,2,101,103,27,1,0,0,0,0,1,101,101,101,0,27,1,0,0,0,0,1,103,103,103,254,1,
+254,1,0,0,0,216,4,31,216,4,63,6,98,105,106,104,103,102,27,1,0,0,0,0,1,102,102,102,2,5,1,0,
+0,0,0,1,103,3,27,1,0,0,0,0,1,103,103,103,18,1,0,0,0,0,0,3,49,46,48,5,1,0,0,0,
+0,4,98,105,106,104,3,27,1,0,0,0,0,1,104,104,104,1,0,216,4,31,216,4,63,3,98,105,106,1,0,0,
+216,4,31,216,4,63,3,98,105,106,27,0,216,4,31,216,4,43,1,106,106,106,2,27,0,216,4,45,216,4,45,1,
+105,105,105,14,0,216,4,48,216,4,62,2,98,105,14,0,216,4,48,216,4,59,1,98,27,0,216,4,48,216,4,50,
+1,98,98,98,0,19,1,0,0,0,0,0,8,115,101,99,116,105,111,110,115,1,0,0,254,1,254,1,0,0,27,0,
+216,4,61,216,4,61,1,105,105,105,254,1,254,1,0,0,1,7,0,216,4,30,217,4,70,3,0,101,102,0,0,216,
+4,30,217,4,70,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,
+0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,1,0,0,0,0,2,0,101,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,
+1,0,1,27,1,0,0,0,0,1,101,101,101,1,19,1,0,0,0,0,0,5,97,114,114,97,121,1,0,0,1,0,
+1,0,0,0,0,1,102,27,1,0,0,0,0,1,102,102,102,2,18,1,0,0,0,0,0,3,48,46,48,1,1,0,
+0,0,0,0,0,1,10,0,216,4,30,217,4,70,0,19,0,216,4,30,217,4,70,0,46,73,110,32,99,111,109,112,
+114,101,104,101,110,115,105,111,110,44,32,99,97,110,32,111,110,108,121,32,105,116,101,114,97,116,101,32,111,118,101,114,
+32,97,114,114,97,121,46,1,0,0,0,0,218,4,9,218,4,74,3,0,109,110,14,0,218,4,9,218,4,16,1,0,
+27,0,218,4,9,218,4,11,1,0,0,0,0,19,1,0,0,0,0,0,4,106,111,105,110,1,0,0,254,1,254,1,
+0,2,19,0,218,4,18,218,4,21,0,1,10,1,0,0,5,0,218,4,24,218,4,73,3,0,109,110,3,5,0,218,
+4,24,218,4,66,3,0,109,110,3,27,0,218,4,24,218,4,32,1,109,109,109,0,0,218,4,36,218,4,66,2,0,
+110,14,0,218,4,36,218,4,52,1,0,27,0,218,4,36,218,4,38,1,0,0,0,0,19,1,0,0,0,0,0,13,
+102,108,97,116,116,101,110,65,114,114,97,121,115,1,0,0,254,1,254,1,0,1,27,0,218,4,54,218,4,65,1,110,
+110,110,0,1,0,218,4,70,218,4,73,0,1,19,0,218,4,71,218,4,72,0,0,1,0,0,0,0,19,1,0,0,
+0,0,0,18,101,115,99,97,112,101,83,116,114,105,110,103,80,121,116,104,111,110,1,0,0,15,0,221,4,9,221,4,
+33,0,2,0,255,1,1,1,255,1,2,11,0,221,4,9,221,4,33,1,0,1,3,0,0,221,4,9,221,4,33,2,
+0,3,14,0,221,4,9,221,4,28,1,0,27,0,221,4,9,221,4,11,1,0,0,0,0,19,1,0,0,0,0,0,
+16,101,115,99,97,112,101,83,116,114,105,110,103,74,115,111,110,1,0,0,254,1,254,1,0,1,27,0,221,4,30,221,
+4,32,1,3,3,3,0,0,19,1,0,0,0,0,0,16,101,115,99,97,112,101,83,116,114,105,110,103,66,97,115,104,
+1,0,0,15,0,224,4,9,230,4,81,0,2,0,255,1,1,1,255,1,2,11,0,224,4,9,230,4,81,1,0,1,
+111,15,0,224,4,9,230,4,81,2,0,111,1,3,0,0,224,4,21,224,4,38,2,0,111,14,0,224,4,21,224,4,
+32,1,0,27,0,224,4,21,224,4,23,1,0,0,0,0,19,1,0,0,0,0,0,8,116,111,83,116,114,105,110,103,
+1,0,0,254,1,254,1,0,1,27,0,224,4,34,224,4,37,1,111,111,111,0,15,0,225,4,9,230,4,81,2,0,
+3,1,112,11,0,225,4,9,230,4,81,1,0,1,113,7,0,226,4,13,229,4,18,2,0,113,0,0,226,4,16,226,
+4,24,2,0,113,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,
+101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,226,4,16,226,4,17,1,113,113,113,19,0,226,4,22,
+226,4,24,0,1,39,1,0,0,1,19,0,227,4,17,227,4,25,0,5,39,34,39,34,39,1,0,0,27,0,229,4,
+17,229,4,18,1,113,113,113,0,0,230,4,9,230,4,81,3,0,3,112,14,1,0,0,0,0,1,0,27,1,0,0,
+0,0,1,0,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,0,0,254,1,254,1,0,2,19,0,230,4,9,
+230,4,14,0,4,39,37,115,39,1,0,0,0,0,230,4,18,230,4,81,3,0,3,112,14,0,230,4,18,230,4,26,
+1,0,27,0,230,4,18,230,4,20,1,0,0,0,0,19,1,0,0,0,0,0,5,102,111,108,100,108,1,0,0,254,
+1,254,1,0,3,11,0,230,4,28,230,4,54,1,112,2,2,7,5,0,230,4,43,230,4,54,3,2,7,112,3,27,
+0,230,4,43,230,4,43,1,2,2,2,0,0,230,4,47,230,4,54,2,7,112,27,0,230,4,47,230,4,51,1,112,
+112,112,1,27,0,230,4,53,230,4,53,1,7,7,7,0,0,0,230,4,57,230,4,76,2,0,3,14,0,230,4,57,
+230,4,71,1,0,27,0,230,4,57,230,4,59,1,0,0,0,0,19,1,0,0,0,0,0,11,115,116,114,105,110,103,
+67,104,97,114,115,1,0,0,254,1,254,1,0,1,27,0,230,4,73,230,4,75,1,3,3,3,0,19,0,230,4,79,
+230,4,80,0,0,1,0,0,0,0,0,19,1,0,0,0,0,0,19,101,115,99,97,112,101,83,116,114,105,110,103,68,
+111,108,108,97,114,115,1,0,0,15,0,233,4,9,239,4,72,0,2,0,255,1,1,1,255,1,2,11,0,233,4,9,
+239,4,72,1,0,1,111,15,0,233,4,9,239,4,72,2,0,111,1,3,0,0,233,4,21,233,4,38,2,0,111,14,
+0,233,4,21,233,4,32,1,0,27,0,233,4,21,233,4,23,1,0,0,0,0,19,1,0,0,0,0,0,8,116,111,
+83,116,114,105,110,103,1,0,0,254,1,254,1,0,1,27,0,233,4,34,233,4,37,1,111,111,111,0,15,0,234,4,
+9,239,4,72,2,0,3,1,112,11,0,234,4,9,239,4,72,1,0,1,113,7,0,235,4,13,238,4,18,2,0,113,
+0,0,235,4,16,235,4,24,2,0,113,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,
+0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,235,4,16,235,4,17,1,113,113,
+113,19,0,235,4,22,235,4,24,0,1,36,1,0,0,1,19,0,236,4,17,236,4,20,0,2,36,36,1,0,0,27,
+0,238,4,17,238,4,18,1,113,113,113,0,0,239,4,9,239,4,72,3,0,3,112,14,0,239,4,9,239,4,17,1,
+0,27,0,239,4,9,239,4,11,1,0,0,0,0,19,1,0,0,0,0,0,5,102,111,108,100,108,1,0,0,254,1,
+254,1,0,3,11,0,239,4,19,239,4,45,1,112,2,2,7,5,0,239,4,34,239,4,45,3,2,7,112,3,27,0,
+239,4,34,239,4,34,1,2,2,2,0,0,239,4,38,239,4,45,2,7,112,27,0,239,4,38,239,4,42,1,112,112,
+112,1,27,0,239,4,44,239,4,44,1,7,7,7,0,0,0,239,4,48,239,4,67,2,0,3,14,0,239,4,48,239,
+4,62,1,0,27,0,239,4,48,239,4,50,1,0,0,0,0,19,1,0,0,0,0,0,11,115,116,114,105,110,103,67,
+104,97,114,115,1,0,0,254,1,254,1,0,1,27,0,239,4,64,239,4,66,1,3,3,3,0,19,0,239,4,70,239,
+4,71,0,0,1,0,0,0,0,19,1,0,0,0,0,0,14,109,97,110,105,102,101,115,116,80,121,116,104,111,110,1,
+0,0,15,0,242,4,9,131,5,18,0,2,0,255,1,1,1,255,1,2,11,0,242,4,9,131,5,18,1,0,1,114,
+7,0,242,4,9,131,5,18,2,0,114,0,0,242,4,12,242,4,34,2,0,114,14,1,0,0,0,0,1,0,27,1,
+0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,
+0,0,242,4,12,242,4,22,2,0,114,14,0,242,4,12,242,4,19,1,0,27,0,242,4,12,242,4,14,1,0,0,
+0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,242,4,21,242,4,21,1,
+114,114,114,0,19,0,242,4,27,242,4,34,0,6,111,98,106,101,99,116,1,0,0,1,15,0,243,4,13,245,4,45,
+2,0,114,1,115,15,0,243,4,28,244,4,57,2,0,114,2,101,0,0,244,4,38,244,4,56,2,0,114,14,0,244,
+4,38,244,4,53,1,0,27,0,244,4,38,244,4,40,1,0,0,0,0,19,1,0,0,0,0,0,12,111,98,106,101,
+99,116,70,105,101,108,100,115,1,0,0,254,1,254,1,0,1,27,0,244,4,55,244,4,55,1,114,114,114,0,102,11,
+0,243,4,28,244,4,57,4,0,114,101,102,2,103,104,7,0,243,4,28,244,4,57,6,0,114,104,101,103,102,5,1,
+0,0,0,0,3,0,101,103,8,27,1,0,0,0,0,1,103,103,103,0,1,0,0,0,0,2,0,101,14,1,0,0,
+0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,
+254,1,254,1,0,1,27,1,0,0,0,0,1,101,101,101,1,27,1,0,0,0,0,1,104,104,104,15,0,243,4,28,
+244,4,57,6,0,114,104,101,103,102,1,105,14,1,0,0,0,0,2,101,103,27,1,0,0,0,0,1,101,101,101,0,
+27,1,0,0,0,0,1,103,103,103,254,1,254,1,0,0,0,243,4,29,243,4,92,6,0,105,114,104,103,102,27,1,
+0,0,0,0,1,102,102,102,2,5,1,0,0,0,0,1,103,3,27,1,0,0,0,0,1,103,103,103,18,1,0,0,
+0,0,0,3,49,46,48,5,1,0,0,0,0,4,0,105,114,104,3,27,1,0,0,0,0,1,104,104,104,1,0,243,
+4,29,243,4,92,3,0,105,114,1,0,0,243,4,29,243,4,92,3,0,105,114,14,1,0,0,0,0,1,0,27,1,
+0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,0,0,254,1,254,1,0,2,19,0,243,
+4,29,243,4,36,0,6,37,115,58,32,37,115,1,0,0,1,0,243,4,40,243,4,92,3,0,105,114,2,0,0,243,
+4,41,243,4,65,2,0,105,14,0,243,4,41,243,4,62,1,0,27,0,243,4,41,243,4,43,1,0,0,0,0,19,
+1,0,0,0,0,0,18,101,115,99,97,112,101,83,116,114,105,110,103,80,121,116,104,111,110,1,0,0,254,1,254,1,
+0,1,27,0,243,4,64,243,4,64,1,105,105,105,0,0,0,243,4,68,243,4,91,3,0,105,114,14,0,243,4,68,
+243,4,85,1,0,27,0,243,4,68,243,4,70,1,0,0,0,0,19,1,0,0,0,0,0,14,109,97,110,105,102,101,
+115,116,80,121,116,104,111,110,1,0,0,254,1,254,1,0,1,14,0,243,4,87,243,4,90,2,105,114,27,0,243,4,
+87,243,4,87,1,114,114,114,0,27,0,243,4,89,243,4,89,1,105,105,105,254,1,254,1,0,0,0,1,7,0,243,
+4,28,244,4,57,3,0,101,102,0,0,243,4,28,244,4,57,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,
+0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,1,
+0,0,0,0,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,1,0,0,0,0,1,101,101,101,1,19,1,0,0,0,0,
+0,5,97,114,114,97,121,1,0,0,1,0,1,0,0,0,0,1,102,27,1,0,0,0,0,1,102,102,102,2,18,1,
+0,0,0,0,0,3,48,46,48,1,1,0,0,0,0,0,0,1,10,0,243,4,28,244,4,57,0,19,0,243,4,28,
+244,4,57,0,46,73,110,32,99,111,109,112,114,101,104,101,110,115,105,111,110,44,32,99,97,110,32,111,110,108,121,32,
+105,116,101,114,97,116,101,32,111,118,101,114,32,97,114,114,97,121,46,1,0,0,0,0,245,4,13,245,4,45,2,0,
+115,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,
+0,0,254,1,254,1,0,2,19,0,245,4,13,245,4,18,0,4,123,37,115,125,1,0,0,1,0,245,4,22,245,4,
+45,2,0,115,1,0,0,245,4,23,245,4,44,2,0,115,14,0,245,4,23,245,4,30,1,0,27,0,245,4,23,245,
+4,25,1,0,0,0,0,19,1,0,0,0,0,0,4,106,111,105,110,1,0,0,254,1,254,1,0,2,19,0,245,4,
+32,245,4,35,0,2,44,32,1,0,0,27,0,245,4,38,245,4,43,1,115,115,115,0,0,7,0,246,4,14,131,5,
+18,2,0,114,0,0,246,4,17,246,4,38,2,0,114,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,
+0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,246,4,17,246,4,
+27,2,0,114,14,0,246,4,17,246,4,24,1,0,27,0,246,4,17,246,4,19,1,0,0,0,0,19,1,0,0,0,
+0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,246,4,26,246,4,26,1,114,114,114,0,19,0,246,
+4,32,246,4,38,0,5,97,114,114,97,121,1,0,0,1,0,0,247,4,13,247,4,75,2,0,114,14,1,0,0,0,
+0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,0,0,254,1,254,1,
+0,2,19,0,247,4,13,247,4,18,0,4,91,37,115,93,1,0,0,1,0,247,4,22,247,4,75,2,0,114,1,0,
+0,247,4,23,247,4,74,2,0,114,14,0,247,4,23,247,4,30,1,0,27,0,247,4,23,247,4,25,1,0,0,0,
+0,19,1,0,0,0,0,0,4,106,111,105,110,1,0,0,254,1,254,1,0,2,19,0,247,4,32,247,4,35,0,2,
+44,32,1,0,0,15,0,247,4,38,247,4,73,2,0,114,2,101,27,0,247,4,72,247,4,72,1,114,114,114,102,11,
+0,247,4,38,247,4,73,3,0,101,102,2,103,104,7,0,247,4,38,247,4,73,5,0,104,101,103,102,5,1,0,0,
+0,0,3,0,101,103,8,27,1,0,0,0,0,1,103,103,103,0,1,0,0,0,0,2,0,101,14,1,0,0,0,0,
+1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,
+254,1,0,1,27,1,0,0,0,0,1,101,101,101,1,27,1,0,0,0,0,1,104,104,104,15,0,247,4,38,247,4,
+73,5,0,104,101,103,102,1,116,14,1,0,0,0,0,2,101,103,27,1,0,0,0,0,1,101,101,101,0,27,1,0,
+0,0,0,1,103,103,103,254,1,254,1,0,0,0,247,4,39,247,4,60,5,0,116,104,103,102,27,1,0,0,0,0,
+1,102,102,102,2,5,1,0,0,0,0,1,103,3,27,1,0,0,0,0,1,103,103,103,18,1,0,0,0,0,0,3,
+49,46,48,5,1,0,0,0,0,3,0,116,104,3,27,1,0,0,0,0,1,104,104,104,1,0,247,4,39,247,4,60,
+2,0,116,1,0,0,247,4,39,247,4,60,2,0,116,14,0,247,4,39,247,4,56,1,0,27,0,247,4,39,247,4,
+41,1,0,0,0,0,19,1,0,0,0,0,0,14,109,97,110,105,102,101,115,116,80,121,116,104,111,110,1,0,0,254,
+1,254,1,0,1,27,0,247,4,58,247,4,59,1,116,116,116,0,1,7,0,247,4,38,247,4,73,3,0,101,102,0,
+0,247,4,38,247,4,73,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,
+0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,1,0,0,0,0,2,0,101,14,1,0,
+0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,
+1,254,1,0,1,27,1,0,0,0,0,1,101,101,101,1,19,1,0,0,0,0,0,5,97,114,114,97,121,1,0,0,
+1,0,1,0,0,0,0,1,102,27,1,0,0,0,0,1,102,102,102,2,18,1,0,0,0,0,0,3,48,46,48,1,
+1,0,0,0,0,0,0,1,10,0,247,4,38,247,4,73,0,19,0,247,4,38,247,4,73,0,46,73,110,32,99,111,
+109,112,114,101,104,101,110,115,105,111,110,44,32,99,97,110,32,111,110,108,121,32,105,116,101,114,97,116,101,32,111,118,
+101,114,32,97,114,114,97,121,46,1,0,0,0,0,7,0,248,4,14,131,5,18,2,0,114,0,0,248,4,17,248,4,
+39,2,0,114,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,
+113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,248,4,17,248,4,27,2,0,114,14,0,248,4,17,248,4,
+24,1,0,27,0,248,4,17,248,4,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,
+1,254,1,0,1,27,0,248,4,26,248,4,26,1,114,114,114,0,19,0,248,4,32,248,4,39,0,6,115,116,114,105,
+110,103,1,0,0,1,0,0,249,4,13,249,4,46,2,0,114,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,
+0,0,0,0,19,1,0,0,0,0,0,3,109,111,100,1,0,0,254,1,254,1,0,2,19,0,249,4,13,249,4,16,
+0,2,37,115,1,0,0,1,0,249,4,20,249,4,46,2,0,114,1,0,0,249,4,21,249,4,45,2,0,114,14,0,
+249,4,21,249,4,42,1,0,27,0,249,4,21,249,4,23,1,0,0,0,0,19,1,0,0,0,0,0,18,101,115,99,
+97,112,101,83,116,114,105,110,103,80,121,116,104,111,110,1,0,0,254,1,254,1,0,1,27,0,249,4,44,249,4,44,
+1,114,114,114,0,0,7,0,250,4,14,131,5,18,2,0,114,0,0,250,4,17,250,4,41,2,0,114,14,1,0,0,
+0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,
+254,1,254,1,0,2,0,0,250,4,17,250,4,27,2,0,114,14,0,250,4,17,250,4,24,1,0,27,0,250,4,17,
+250,4,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,250,
+4,26,250,4,26,1,114,114,114,0,19,0,250,4,32,250,4,41,0,8,102,117,110,99,116,105,111,110,1,0,0,1,
+10,0,251,4,13,251,4,44,0,19,0,251,4,19,251,4,44,0,24,99,97,110,110,111,116,32,109,97,110,105,102,101,
+115,116,32,102,117,110,99,116,105,111,110,1,0,0,7,0,252,4,14,131,5,18,2,0,114,0,0,252,4,17,252,4,
+39,2,0,114,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,
+113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,252,4,17,252,4,27,2,0,114,14,0,252,4,17,252,4,
+24,1,0,27,0,252,4,17,252,4,19,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,
+1,254,1,0,1,27,0,252,4,26,252,4,26,1,114,114,114,0,19,0,252,4,32,252,4,39,0,6,110,117,109,98,
+101,114,1,0,0,1,0,0,253,4,13,253,4,27,2,0,114,14,0,253,4,13,253,4,24,1,0,27,0,253,4,13,
+253,4,15,1,0,0,0,0,19,1,0,0,0,0,0,8,116,111,83,116,114,105,110,103,1,0,0,254,1,254,1,0,
+1,27,0,253,4,26,253,4,26,1,114,114,114,0,7,0,254,4,14,131,5,18,2,0,114,0,0,254,4,17,254,4,
+25,2,0,114,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,
+113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,254,4,17,254,4,17,1,114,114,114,16,0,254,4,22,254,
+4,25,0,1,1,19,0,255,4,13,255,4,18,0,4,84,114,117,101,1,0,0,7,0,128,5,14,131,5,18,2,0,
+114,0,0,128,5,17,128,5,26,2,0,114,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,
+1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,128,5,17,128,5,17,1,114,
+114,114,16,0,128,5,22,128,5,26,0,0,1,19,0,129,5,13,129,5,19,0,5,70,97,108,115,101,1,0,0,7,
+0,130,5,14,131,5,18,2,0,114,0,0,130,5,17,130,5,25,2,0,114,14,1,0,0,0,0,1,0,27,1,0,
+0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,
+0,130,5,17,130,5,17,1,114,114,114,17,0,130,5,22,130,5,25,0,1,19,0,131,5,13,131,5,18,0,4,78,
+111,110,101,1,0,0,17,1,0,0,0,0,0,0,19,1,0,0,0,0,0,18,109,97,110,105,102,101,115,116,80,121,
+116,104,111,110,86,97,114,115,1,0,0,15,0,134,5,9,135,5,35,0,2,0,255,1,1,1,255,1,2,11,0,134,
+5,9,135,5,35,1,0,1,117,15,0,134,5,9,135,5,35,2,0,117,1,118,15,0,134,5,22,134,5,99,2,0,
+117,2,101,0,0,134,5,77,134,5,98,2,0,117,14,0,134,5,77,134,5,92,1,0,27,0,134,5,77,134,5,79,
+1,0,0,0,0,19,1,0,0,0,0,0,12,111,98,106,101,99,116,70,105,101,108,100,115,1,0,0,254,1,254,1,
+0,1,27,0,134,5,94,134,5,97,1,117,117,117,0,102,11,0,134,5,22,134,5,99,4,0,117,101,102,2,103,104,
+7,0,134,5,22,134,5,99,6,0,117,104,101,103,102,5,1,0,0,0,0,3,0,101,103,8,27,1,0,0,0,0,
+1,103,103,103,0,1,0,0,0,0,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,
+19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,1,0,0,0,0,1,101,101,
+101,1,27,1,0,0,0,0,1,104,104,104,15,0,134,5,22,134,5,99,6,0,117,104,101,103,102,1,105,14,1,0,
+0,0,0,2,101,103,27,1,0,0,0,0,1,101,101,101,0,27,1,0,0,0,0,1,103,103,103,254,1,254,1,0,
+0,0,134,5,23,134,5,66,6,0,105,117,104,103,102,27,1,0,0,0,0,1,102,102,102,2,5,1,0,0,0,0,
+1,103,3,27,1,0,0,0,0,1,103,103,103,18,1,0,0,0,0,0,3,49,46,48,5,1,0,0,0,0,4,0,
+105,117,104,3,27,1,0,0,0,0,1,104,104,104,1,0,134,5,23,134,5,66,3,0,105,117,1,0,0,134,5,23,
+134,5,66,3,0,105,117,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,3,109,111,100,1,0,0,254,1,254,1,0,2,19,0,134,5,23,134,5,31,0,7,37,115,32,61,32,37,115,1,
+0,0,1,0,134,5,35,134,5,66,3,0,105,117,2,27,0,134,5,36,134,5,36,1,105,105,105,0,0,134,5,39,
+134,5,65,3,0,105,117,14,0,134,5,39,134,5,56,1,0,27,0,134,5,39,134,5,41,1,0,0,0,0,19,1,
+0,0,0,0,0,14,109,97,110,105,102,101,115,116,80,121,116,104,111,110,1,0,0,254,1,254,1,0,1,14,0,134,
+5,58,134,5,64,2,105,117,27,0,134,5,58,134,5,61,1,117,117,117,0,27,0,134,5,63,134,5,63,1,105,105,
+105,254,1,254,1,0,0,0,1,7,0,134,5,22,134,5,99,3,0,101,102,0,0,134,5,22,134,5,99,2,0,101,
+14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,
+115,1,0,0,254,1,254,1,0,2,0,1,0,0,0,0,2,0,101,14,1,0,0,0,0,1,0,27,1,0,0,0,
+0,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,1,0,0,0,
+0,1,101,101,101,1,19,1,0,0,0,0,0,5,97,114,114,97,121,1,0,0,1,0,1,0,0,0,0,1,102,27,
+1,0,0,0,0,1,102,102,102,2,18,1,0,0,0,0,0,3,48,46,48,1,1,0,0,0,0,0,0,1,10,0,
+134,5,22,134,5,99,0,19,0,134,5,22,134,5,99,0,46,73,110,32,99,111,109,112,114,101,104,101,110,115,105,111,
+110,44,32,99,97,110,32,111,110,108,121,32,105,116,101,114,97,116,101,32,111,118,101,114,32,97,114,114,97,121,46,1,
+0,0,0,0,135,5,9,135,5,35,2,0,118,14,0,135,5,9,135,5,16,1,0,27,0,135,5,9,135,5,11,1,
+0,0,0,0,19,1,0,0,0,0,0,4,106,111,105,110,1,0,0,254,1,254,1,0,2,19,0,135,5,18,135,5,
+21,0,1,10,1,0,0,5,0,135,5,24,135,5,34,1,118,3,27,0,135,5,24,135,5,27,1,118,118,118,1,0,
+135,5,31,135,5,34,0,1,19,0,135,5,32,135,5,33,0,0,1,0,0,0,0,19,1,0,0,0,0,0,4,115,
+111,114,116,1,0,0,15,0,139,5,9,147,5,54,0,2,0,255,1,1,1,255,1,2,11,0,139,5,9,147,5,54,
+1,0,1,9,15,0,139,5,9,147,5,54,2,0,9,1,119,0,0,139,5,19,139,5,33,2,0,9,14,0,139,5,
+19,139,5,28,1,0,27,0,139,5,19,139,5,21,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,
+104,1,0,0,254,1,254,1,0,1,27,0,139,5,30,139,5,32,1,9,9,9,0,7,0,140,5,9,147,5,54,3,
+0,9,119,0,0,140,5,12,140,5,31,2,0,9,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,
+0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,140,5,12,140,5,26,
+2,0,9,14,0,140,5,12,140,5,21,1,0,27,0,140,5,12,140,5,14,1,0,0,0,0,19,1,0,0,0,0,
+0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,140,5,23,140,5,25,1,9,9,9,0,18,0,
+140,5,31,140,5,31,0,1,48,1,1,0,141,5,13,141,5,14,0,0,15,0,143,5,13,147,5,54,3,0,9,119,
+1,120,14,0,143,5,27,143,5,32,1,9,27,0,143,5,27,143,5,29,1,9,9,9,0,18,0,143,5,31,143,5,
+31,0,1,48,254,1,254,1,0,15,0,144,5,13,147,5,54,4,0,9,119,120,1,121,0,0,144,5,26,144,5,69,
+3,0,9,119,14,0,144,5,26,144,5,38,1,0,27,0,144,5,26,144,5,28,1,0,0,0,0,19,1,0,0,0,
+0,0,9,109,97,107,101,65,114,114,97,121,1,0,0,254,1,254,1,0,2,5,0,144,5,40,144,5,44,1,119,4,
+27,0,144,5,40,144,5,40,1,119,119,119,18,0,144,5,44,144,5,44,0,1,49,11,0,144,5,47,144,5,68,1,
+9,1,6,14,0,144,5,59,144,5,68,2,6,9,27,0,144,5,59,144,5,61,1,9,9,9,0,5,0,144,5,63,
+144,5,67,1,6,3,27,0,144,5,63,144,5,63,1,6,6,6,18,0,144,5,67,144,5,67,0,1,49,254,1,254,
+1,0,0,15,0,145,5,13,147,5,54,3,0,120,121,1,122,0,0,145,5,26,145,5,65,3,0,120,121,14,0,145,
+5,26,145,5,35,1,0,27,0,145,5,26,145,5,28,1,0,0,0,0,19,1,0,0,0,0,0,6,102,105,108,116,
+101,114,1,0,0,254,1,254,1,0,2,11,0,145,5,37,145,5,58,1,120,1,10,5,0,145,5,49,145,5,58,2,
+10,120,10,27,0,145,5,49,145,5,49,1,10,10,10,27,0,145,5,54,145,5,58,1,120,120,120,27,0,145,5,61,
+145,5,64,1,121,121,121,0,15,0,146,5,13,147,5,54,4,0,122,120,121,1,123,0,0,146,5,27,146,5,65,3,
+0,120,121,14,0,146,5,27,146,5,36,1,0,27,0,146,5,27,146,5,29,1,0,0,0,0,19,1,0,0,0,0,
+0,6,102,105,108,116,101,114,1,0,0,254,1,254,1,0,2,11,0,146,5,38,146,5,58,1,120,1,10,5,0,146,
+5,50,146,5,58,2,10,120,7,27,0,146,5,50,146,5,50,1,10,10,10,27,0,146,5,54,146,5,58,1,120,120,
+120,27,0,146,5,61,146,5,64,1,121,121,121,0,5,0,147,5,13,147,5,54,4,0,122,120,123,3,5,0,147,5,
+13,147,5,36,3,0,122,120,3,0,0,147,5,13,147,5,26,2,0,122,14,0,147,5,13,147,5,20,1,0,27,0,
+147,5,13,147,5,15,1,0,0,0,0,19,1,0,0,0,0,0,4,115,111,114,116,1,0,0,254,1,254,1,0,1,
+27,0,147,5,22,147,5,25,1,122,122,122,0,1,0,147,5,30,147,5,36,1,120,1,27,0,147,5,31,147,5,35,
+1,120,120,120,0,0,147,5,40,147,5,54,2,0,123,14,0,147,5,40,147,5,47,1,0,27,0,147,5,40,147,5,
+42,1,0,0,0,0,19,1,0,0,0,0,0,4,115,111,114,116,1,0,0,254,1,254,1,0,1,27,0,147,5,49,
+147,5,53,1,123,123,123,0,0,19,1,0,0,0,0,0,4,117,110,105,113,1,0,0,15,0,150,5,9,157,5,30,
+0,2,0,255,1,1,1,255,1,2,11,0,150,5,9,157,5,30,1,0,1,9,15,0,150,5,9,157,5,30,2,0,
+9,1,92,11,0,150,5,9,157,5,30,1,0,2,2,7,7,0,151,5,13,156,5,23,3,0,2,7,0,0,151,5,
+16,151,5,33,2,0,2,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,
+0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,0,0,151,5,16,151,5,28,2,0,2,14,0,151,5,
+16,151,5,25,1,0,27,0,151,5,16,151,5,18,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,
+104,1,0,0,254,1,254,1,0,1,27,0,151,5,27,151,5,27,1,2,2,2,0,18,0,151,5,33,151,5,33,0,
+1,48,1,1,0,152,5,17,152,5,19,1,7,1,27,0,152,5,18,152,5,18,1,7,7,7,7,0,153,5,18,156,
+5,23,3,0,2,7,0,0,153,5,21,153,5,45,3,0,2,7,14,1,0,0,0,0,1,0,27,1,0,0,0,0,
+1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,153,5,
+21,153,5,40,2,0,2,27,0,153,5,21,153,5,21,1,2,2,2,0,5,0,153,5,23,153,5,39,2,0,2,4,
+0,0,153,5,23,153,5,35,2,0,2,14,0,153,5,23,153,5,32,1,0,27,0,153,5,23,153,5,25,1,0,0,
+0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,153,5,34,153,5,
+34,1,2,2,2,0,18,0,153,5,39,153,5,39,0,1,49,254,1,254,1,0,27,0,153,5,45,153,5,45,1,7,
+7,7,1,27,0,154,5,17,154,5,17,1,2,2,2,5,0,156,5,17,156,5,23,2,2,7,3,27,0,156,5,17,
+156,5,17,1,2,2,2,1,0,156,5,21,156,5,23,1,7,1,27,0,156,5,22,156,5,22,1,7,7,7,0,0,
+157,5,9,157,5,30,3,0,9,92,14,0,157,5,9,157,5,17,1,0,27,0,157,5,9,157,5,11,1,0,0,0,
+0,19,1,0,0,0,0,0,5,102,111,108,100,108,1,0,0,254,1,254,1,0,3,27,0,157,5,19,157,5,19,1,
+92,92,92,27,0,157,5,23,157,5,25,1,9,9,9,1,0,157,5,28,157,5,29,0,0,0,0,19,1,0,0,0,
+0,0,3,115,101,116,1,0,0,15,0,160,5,9,160,5,31,0,2,0,255,1,1,1,255,1,2,11,0,160,5,9,
+160,5,31,1,0,1,9,0,0,160,5,9,160,5,31,2,0,9,14,0,160,5,9,160,5,16,1,0,27,0,160,5,
+9,160,5,11,1,0,0,0,0,19,1,0,0,0,0,0,4,117,110,105,113,1,0,0,254,1,254,1,0,1,0,0,
+160,5,18,160,5,30,2,0,9,14,0,160,5,18,160,5,25,1,0,27,0,160,5,18,160,5,20,1,0,0,0,0,
+19,1,0,0,0,0,0,4,115,111,114,116,1,0,0,254,1,254,1,0,1,27,0,160,5,27,160,5,29,1,9,9,
+9,0,0,0,19,1,0,0,0,0,0,9,115,101,116,77,101,109,98,101,114,1,0,0,15,0,164,5,9,164,5,46,
+0,2,0,255,1,1,1,255,1,2,11,0,164,5,9,164,5,46,1,0,2,10,9,5,0,164,5,9,164,5,46,3,
+0,9,10,7,0,0,164,5,9,164,5,42,3,0,9,10,14,0,164,5,9,164,5,18,1,0,27,0,164,5,9,164,
+5,11,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,0,0,
+164,5,20,164,5,41,3,0,9,10,14,0,164,5,20,164,5,31,1,0,27,0,164,5,20,164,5,22,1,0,0,0,
+0,19,1,0,0,0,0,0,8,115,101,116,73,110,116,101,114,1,0,0,254,1,254,1,0,2,1,0,164,5,33,164,
+5,35,1,10,1,27,0,164,5,34,164,5,34,1,10,10,10,27,0,164,5,38,164,5,40,1,9,9,9,0,0,18,
+0,164,5,46,164,5,46,0,1,48,0,19,1,0,0,0,0,0,8,115,101,116,85,110,105,111,110,1,0,0,15,0,
+167,5,9,167,5,22,0,2,0,255,1,1,1,255,1,2,11,0,167,5,9,167,5,22,1,0,2,2,7,0,0,167,
+5,9,167,5,22,3,0,2,7,14,0,167,5,9,167,5,15,1,0,27,0,167,5,9,167,5,11,1,0,0,0,0,
+19,1,0,0,0,0,0,3,115,101,116,1,0,0,254,1,254,1,0,1,5,0,167,5,17,167,5,21,2,2,7,3,
+27,0,167,5,17,167,5,17,1,2,2,2,27,0,167,5,21,167,5,21,1,7,7,7,0,0,19,1,0,0,0,0,
+0,8,115,101,116,73,110,116,101,114,1,0,0,15,0,170,5,9,180,5,27,0,2,0,255,1,1,1,255,1,2,11,
+0,170,5,9,180,5,27,1,0,2,2,7,15,0,170,5,9,180,5,27,3,0,2,7,1,14,11,0,170,5,9,180,
+5,27,2,0,14,5,2,7,6,20,124,7,0,171,5,13,179,5,44,7,0,2,6,7,14,20,124,5,0,171,5,16,
+171,5,55,5,0,2,6,7,20,17,5,0,171,5,16,171,5,33,3,0,2,6,8,27,0,171,5,16,171,5,16,1,
+6,6,6,0,0,171,5,21,171,5,33,2,0,2,14,0,171,5,21,171,5,30,1,0,27,0,171,5,21,171,5,23,
+1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,171,5,
+32,171,5,32,1,2,2,2,0,5,0,171,5,38,171,5,55,3,0,7,20,8,27,0,171,5,38,171,5,38,1,20,
+20,20,0,0,171,5,43,171,5,55,2,0,7,14,0,171,5,43,171,5,52,1,0,27,0,171,5,43,171,5,45,1,
+0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,171,5,54,
+171,5,54,1,7,7,7,0,27,0,172,5,17,172,5,19,1,124,124,124,7,0,174,5,17,179,5,44,7,0,2,6,
+7,14,20,124,0,0,174,5,20,174,5,31,5,0,2,6,7,20,14,1,0,0,0,0,1,0,27,1,0,0,0,0,
+1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,174,5,
+20,174,5,23,2,2,6,27,0,174,5,20,174,5,20,1,2,2,2,0,27,0,174,5,22,174,5,22,1,6,6,6,
+254,1,254,1,0,14,0,174,5,28,174,5,31,2,7,20,27,0,174,5,28,174,5,28,1,7,7,7,0,27,0,174,
+5,30,174,5,30,1,20,20,20,254,1,254,1,0,1,0,0,175,5,21,175,5,57,6,2,6,7,14,20,124,27,0,
+175,5,21,175,5,23,1,14,14,14,5,27,0,175,5,25,175,5,25,1,2,2,2,27,0,175,5,28,175,5,28,1,
+7,7,7,5,0,175,5,31,175,5,35,1,6,3,27,0,175,5,31,175,5,31,1,6,6,6,18,0,175,5,35,175,
+5,35,0,1,49,5,0,175,5,38,175,5,42,1,20,3,27,0,175,5,38,175,5,38,1,20,20,20,18,0,175,5,
+42,175,5,42,0,1,49,5,0,175,5,45,175,5,56,3,2,6,124,3,27,0,175,5,45,175,5,47,1,124,124,124,
+1,0,175,5,51,175,5,56,2,2,6,1,14,0,175,5,52,175,5,55,2,2,6,27,0,175,5,52,175,5,52,1,
+2,2,2,0,27,0,175,5,54,175,5,54,1,6,6,6,254,1,254,1,0,1,7,0,176,5,22,179,5,44,6,2,
+6,7,14,20,124,5,0,176,5,25,176,5,35,4,2,6,7,20,9,14,0,176,5,25,176,5,28,2,2,6,27,0,
+176,5,25,176,5,25,1,2,2,2,0,27,0,176,5,27,176,5,27,1,6,6,6,254,1,254,1,0,14,0,176,5,
+32,176,5,35,2,7,20,27,0,176,5,32,176,5,32,1,7,7,7,0,27,0,176,5,34,176,5,34,1,20,20,20,
+254,1,254,1,0,0,0,177,5,21,177,5,44,6,2,6,7,14,20,124,27,0,177,5,21,177,5,23,1,14,14,14,
+5,27,0,177,5,25,177,5,25,1,2,2,2,27,0,177,5,28,177,5,28,1,7,7,7,5,0,177,5,31,177,5,
+35,1,6,3,27,0,177,5,31,177,5,31,1,6,6,6,18,0,177,5,35,177,5,35,0,1,49,27,0,177,5,38,
+177,5,38,1,20,20,20,27,0,177,5,41,177,5,43,1,124,124,124,1,0,0,179,5,21,179,5,44,6,2,6,7,
+14,20,124,27,0,179,5,21,179,5,23,1,14,14,14,5,27,0,179,5,25,179,5,25,1,2,2,2,27,0,179,5,
+28,179,5,28,1,7,7,7,27,0,179,5,31,179,5,31,1,6,6,6,5,0,179,5,34,179,5,38,1,20,3,27,
+0,179,5,34,179,5,34,1,20,20,20,18,0,179,5,38,179,5,38,0,1,49,27,0,179,5,41,179,5,43,1,124,
+124,124,1,0,0,180,5,9,180,5,27,3,2,7,14,27,0,180,5,9,180,5,11,1,14,14,14,5,27,0,180,5,
+13,180,5,13,1,2,2,2,27,0,180,5,16,180,5,16,1,7,7,7,18,0,180,5,19,180,5,19,0,1,48,18,
+0,180,5,22,180,5,22,0,1,48,1,0,180,5,25,180,5,26,0,0,1,0,19,1,0,0,0,0,0,7,115,101,
+116,68,105,102,102,1,0,0,15,0,183,5,9,195,5,27,0,2,0,255,1,1,1,255,1,2,11,0,183,5,9,195,
+5,27,1,0,2,2,7,15,0,183,5,9,195,5,27,3,0,2,7,1,14,11,0,183,5,9,195,5,27,2,0,14,
+5,2,7,6,20,124,7,0,184,5,13,194,5,44,7,0,2,6,7,14,20,124,5,0,184,5,16,184,5,33,3,0,
+2,6,8,27,0,184,5,16,184,5,16,1,6,6,6,0,0,184,5,21,184,5,33,2,0,2,14,0,184,5,21,184,
+5,30,1,0,27,0,184,5,21,184,5,23,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,
+0,0,254,1,254,1,0,1,27,0,184,5,32,184,5,32,1,2,2,2,0,27,0,185,5,17,185,5,19,1,124,124,
+124,7,0,186,5,18,194,5,44,7,0,2,6,7,14,20,124,5,0,186,5,21,186,5,38,3,0,7,20,8,27,0,
+186,5,21,186,5,21,1,20,20,20,0,0,186,5,26,186,5,38,2,0,7,14,0,186,5,26,186,5,35,1,0,27,
+0,186,5,26,186,5,28,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,
+1,0,1,27,0,186,5,37,186,5,37,1,7,7,7,0,0,0,187,5,17,187,5,49,6,2,6,7,14,20,124,27,
+0,187,5,17,187,5,19,1,14,14,14,5,27,0,187,5,21,187,5,21,1,2,2,2,27,0,187,5,24,187,5,24,
+1,7,7,7,5,0,187,5,27,187,5,31,1,6,3,27,0,187,5,27,187,5,27,1,6,6,6,18,0,187,5,31,
+187,5,31,0,1,49,27,0,187,5,34,187,5,34,1,20,20,20,5,0,187,5,37,187,5,48,3,2,6,124,3,27,
+0,187,5,37,187,5,39,1,124,124,124,1,0,187,5,43,187,5,48,2,2,6,1,14,0,187,5,44,187,5,47,2,
+2,6,27,0,187,5,44,187,5,44,1,2,2,2,0,27,0,187,5,46,187,5,46,1,6,6,6,254,1,254,1,0,
+1,7,0,189,5,17,194,5,44,7,0,2,6,7,14,20,124,0,0,189,5,20,189,5,31,5,0,2,6,7,20,14,
+1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,
+1,0,0,254,1,254,1,0,2,14,0,189,5,20,189,5,23,2,2,6,27,0,189,5,20,189,5,20,1,2,2,2,
+0,27,0,189,5,22,189,5,22,1,6,6,6,254,1,254,1,0,14,0,189,5,28,189,5,31,2,7,20,27,0,189,
+5,28,189,5,28,1,7,7,7,0,27,0,189,5,30,189,5,30,1,20,20,20,254,1,254,1,0,1,0,0,190,5,
+21,190,5,48,6,2,6,7,14,20,124,27,0,190,5,21,190,5,23,1,14,14,14,5,27,0,190,5,25,190,5,25,
+1,2,2,2,27,0,190,5,28,190,5,28,1,7,7,7,5,0,190,5,31,190,5,35,1,6,3,27,0,190,5,31,
+190,5,31,1,6,6,6,18,0,190,5,35,190,5,35,0,1,49,5,0,190,5,38,190,5,42,1,20,3,27,0,190,
+5,38,190,5,38,1,20,20,20,18,0,190,5,42,190,5,42,0,1,49,27,0,190,5,45,190,5,47,1,124,124,124,
+1,7,0,191,5,22,194,5,44,6,2,6,7,14,20,124,5,0,191,5,25,191,5,35,4,2,6,7,20,9,14,0,
+191,5,25,191,5,28,2,2,6,27,0,191,5,25,191,5,25,1,2,2,2,0,27,0,191,5,27,191,5,27,1,6,
+6,6,254,1,254,1,0,14,0,191,5,32,191,5,35,2,7,20,27,0,191,5,32,191,5,32,1,7,7,7,0,27,
+0,191,5,34,191,5,34,1,20,20,20,254,1,254,1,0,0,0,192,5,21,192,5,53,6,2,6,7,14,20,124,27,
+0,192,5,21,192,5,23,1,14,14,14,5,27,0,192,5,25,192,5,25,1,2,2,2,27,0,192,5,28,192,5,28,
+1,7,7,7,5,0,192,5,31,192,5,35,1,6,3,27,0,192,5,31,192,5,31,1,6,6,6,18,0,192,5,35,
+192,5,35,0,1,49,27,0,192,5,38,192,5,38,1,20,20,20,5,0,192,5,41,192,5,52,3,2,6,124,3,27,
+0,192,5,41,192,5,43,1,124,124,124,1,0,192,5,47,192,5,52,2,2,6,1,14,0,192,5,48,192,5,51,2,
+2,6,27,0,192,5,48,192,5,48,1,2,2,2,0,27,0,192,5,50,192,5,50,1,6,6,6,254,1,254,1,0,
+1,0,0,194,5,21,194,5,44,6,2,6,7,14,20,124,27,0,194,5,21,194,5,23,1,14,14,14,5,27,0,194,
+5,25,194,5,25,1,2,2,2,27,0,194,5,28,194,5,28,1,7,7,7,27,0,194,5,31,194,5,31,1,6,6,
+6,5,0,194,5,34,194,5,38,1,20,3,27,0,194,5,34,194,5,34,1,20,20,20,18,0,194,5,38,194,5,38,
+0,1,49,27,0,194,5,41,194,5,43,1,124,124,124,1,0,0,195,5,9,195,5,27,3,2,7,14,27,0,195,5,
+9,195,5,11,1,14,14,14,5,27,0,195,5,13,195,5,13,1,2,2,2,27,0,195,5,16,195,5,16,1,7,7,
+7,18,0,195,5,19,195,5,19,0,1,48,18,0,195,5,22,195,5,22,0,1,48,1,0,195,5,25,195,5,26,0,
+0,1,0,19,1,0,0,0,0,0,12,111,98,106,101,99,116,70,105,101,108,100,115,1,0,0,15,0,198,5,9,198,
+5,36,0,2,0,255,1,1,1,255,1,2,11,0,198,5,9,198,5,36,1,0,1,114,0,0,198,5,9,198,5,36,
+2,0,114,14,0,198,5,9,198,5,26,1,0,27,0,198,5,9,198,5,11,1,0,0,0,0,19,1,0,0,0,0,
+0,14,111,98,106,101,99,116,70,105,101,108,100,115,69,120,1,0,0,254,1,254,1,0,2,27,0,198,5,28,198,5,
+28,1,114,114,114,16,0,198,5,31,198,5,35,0,0,0,0,19,1,0,0,0,0,0,15,111,98,106,101,99,116,70,
+105,101,108,100,115,65,108,108,1,0,0,15,0,201,5,9,201,5,35,0,2,0,255,1,1,1,255,1,2,11,0,201,
+5,9,201,5,35,1,0,1,114,0,0,201,5,9,201,5,35,2,0,114,14,0,201,5,9,201,5,26,1,0,27,0,
+201,5,9,201,5,11,1,0,0,0,0,19,1,0,0,0,0,0,14,111,98,106,101,99,116,70,105,101,108,100,115,69,
+120,1,0,0,254,1,254,1,0,2,27,0,201,5,28,201,5,28,1,114,114,114,16,0,201,5,31,201,5,34,0,1,
+0,0,19,1,0,0,0,0,0,9,111,98,106,101,99,116,72,97,115,1,0,0,15,0,204,5,9,204,5,36,0,2,
+0,255,1,1,1,255,1,2,11,0,204,5,9,204,5,36,1,0,2,114,92,0,0,204,5,9,204,5,36,3,0,92,
+114,14,0,204,5,9,204,5,23,1,0,27,0,204,5,9,204,5,11,1,0,0,0,0,19,1,0,0,0,0,0,11,
+111,98,106,101,99,116,72,97,115,69,120,1,0,0,254,1,254,1,0,3,27,0,204,5,25,204,5,25,1,114,114,114,
+27,0,204,5,28,204,5,28,1,92,92,92,16,0,204,5,31,204,5,35,0,0,0,0,19,1,0,0,0,0,0,12,
+111,98,106,101,99,116,72,97,115,65,108,108,1,0,0,15,0,207,5,9,207,5,35,0,2,0,255,1,1,1,255,1,
+2,11,0,207,5,9,207,5,35,1,0,2,114,92,0,0,207,5,9,207,5,35,3,0,92,114,14,0,207,5,9,207,
+5,23,1,0,27,0,207,5,9,207,5,11,1,0,0,0,0,19,1,0,0,0,0,0,11,111,98,106,101,99,116,72,
+97,115,69,120,1,0,0,254,1,254,1,0,3,27,0,207,5,25,207,5,25,1,114,114,114,27,0,207,5,28,207,5,
+28,1,92,92,92,16,0,207,5,31,207,5,34,0,1,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,
+0,0,15,0,210,5,9,243,5,41,0,2,0,255,1,1,1,255,1,2,11,0,210,5,9,243,5,41,1,0,2,2,
+7,15,0,210,5,9,243,5,41,3,0,2,7,1,125,0,0,210,5,20,210,5,30,2,0,2,14,0,210,5,20,210,
+5,27,1,0,27,0,210,5,20,210,5,22,1,0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,
+254,1,254,1,0,1,27,0,210,5,29,210,5,29,1,2,2,2,0,15,0,211,5,9,243,5,41,4,0,2,7,125,
+1,126,0,0,211,5,20,211,5,30,2,0,7,14,0,211,5,20,211,5,27,1,0,27,0,211,5,20,211,5,22,1,
+0,0,0,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,254,1,254,1,0,1,27,0,211,5,29,211,5,
+29,1,7,7,7,0,7,0,212,5,9,243,5,41,5,0,2,7,125,126,26,0,212,5,12,212,5,39,3,0,125,126,
+0,0,0,212,5,13,212,5,39,3,0,125,126,14,0,212,5,13,212,5,31,1,0,27,0,212,5,13,212,5,15,1,
+0,0,0,0,19,1,0,0,0,0,0,15,112,114,105,109,105,116,105,118,101,69,113,117,97,108,115,1,0,0,254,1,
+254,1,0,2,27,0,212,5,33,212,5,34,1,125,125,125,27,0,212,5,37,212,5,38,1,126,126,126,0,16,0,213,
+5,13,213,5,17,0,0,7,0,215,5,13,243,5,41,4,0,2,7,125,0,0,215,5,16,215,5,47,2,0,125,14,
+0,215,5,16,215,5,34,1,0,27,0,215,5,16,215,5,18,1,0,0,0,0,19,1,0,0,0,0,0,15,112,114,
+105,109,105,116,105,118,101,69,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,215,5,36,215,5,37,1,125,
+125,125,19,0,215,5,40,215,5,46,0,5,97,114,114,97,121,1,0,0,0,15,0,216,5,17,227,5,32,3,0,2,
+7,1,127,0,0,216,5,28,216,5,40,2,0,2,14,0,216,5,28,216,5,37,1,0,27,0,216,5,28,216,5,30,
+1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,216,5,
+39,216,5,39,1,2,2,2,0,7,0,217,5,17,227,5,32,4,0,2,7,127,26,0,217,5,20,217,5,58,3,0,
+7,127,0,0,0,217,5,21,217,5,58,3,0,7,127,14,0,217,5,21,217,5,39,1,0,27,0,217,5,21,217,5,
+23,1,0,0,0,0,19,1,0,0,0,0,0,15,112,114,105,109,105,116,105,118,101,69,113,117,97,108,115,1,0,0,
+254,1,254,1,0,2,27,0,217,5,41,217,5,42,1,127,127,127,0,0,217,5,45,217,5,57,2,0,7,14,0,217,
+5,45,217,5,54,1,0,27,0,217,5,45,217,5,47,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,
+116,104,1,0,0,254,1,254,1,0,1,27,0,217,5,56,217,5,56,1,7,7,7,0,0,16,0,218,5,21,218,5,
+25,0,0,15,0,220,5,21,227,5,32,4,0,2,7,127,1,14,11,0,220,5,21,227,5,32,3,0,14,127,3,2,
+7,6,7,0,221,5,25,226,5,44,6,0,2,6,7,14,127,5,0,221,5,28,221,5,34,2,6,127,8,27,0,221,
+5,28,221,5,28,1,6,6,6,27,0,221,5,33,221,5,34,1,127,127,127,16,0,222,5,29,222,5,32,0,1,7,
+0,223,5,30,226,5,44,5,0,2,6,7,14,26,0,223,5,33,223,5,44,4,0,2,6,7,0,0,0,223,5,33,
+223,5,44,4,0,2,6,7,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,
+0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,14,0,223,5,33,223,5,36,2,2,6,27,0,223,
+5,33,223,5,33,1,2,2,2,0,27,0,223,5,35,223,5,35,1,6,6,6,254,1,254,1,0,14,0,223,5,41,
+223,5,44,2,6,7,27,0,223,5,41,223,5,41,1,7,7,7,0,27,0,223,5,43,223,5,43,1,6,6,6,254,
+1,254,1,0,1,16,0,224,5,29,224,5,33,0,0,0,0,226,5,29,226,5,44,4,2,6,7,14,27,0,226,5,
+29,226,5,31,1,14,14,14,3,27,0,226,5,33,226,5,33,1,2,2,2,27,0,226,5,36,226,5,36,1,7,7,
+7,5,0,226,5,39,226,5,43,1,6,3,27,0,226,5,39,226,5,39,1,6,6,6,18,0,226,5,43,226,5,43,
+0,1,49,1,0,0,227,5,21,227,5,32,3,2,7,14,27,0,227,5,21,227,5,23,1,14,14,14,3,27,0,227,
+5,25,227,5,25,1,2,2,2,27,0,227,5,28,227,5,28,1,7,7,7,18,0,227,5,31,227,5,31,0,1,48,
+0,7,0,228,5,18,243,5,41,4,0,2,7,125,0,0,228,5,21,228,5,53,2,0,125,14,0,228,5,21,228,5,
+39,1,0,27,0,228,5,21,228,5,23,1,0,0,0,0,19,1,0,0,0,0,0,15,112,114,105,109,105,116,105,118,
+101,69,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,228,5,41,228,5,42,1,125,125,125,19,0,228,5,
+45,228,5,52,0,6,111,98,106,101,99,116,1,0,0,0,15,0,229,5,17,241,5,32,3,0,2,7,1,115,0,0,
+229,5,32,229,5,50,2,0,2,14,0,229,5,32,229,5,47,1,0,27,0,229,5,32,229,5,34,1,0,0,0,0,
+19,1,0,0,0,0,0,12,111,98,106,101,99,116,70,105,101,108,100,115,1,0,0,254,1,254,1,0,1,27,0,229,
+5,49,229,5,49,1,2,2,2,0,15,0,230,5,17,241,5,32,4,0,2,7,115,1,128,1,0,0,230,5,33,230,
+5,50,2,0,115,14,0,230,5,33,230,5,42,1,0,27,0,230,5,33,230,5,35,1,0,0,0,0,19,1,0,0,
+0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,230,5,44,230,5,49,1,115,115,115,0,
+7,0,231,5,17,241,5,32,5,0,2,7,115,128,1,26,0,231,5,20,231,5,48,3,0,7,115,0,0,0,231,5,
+20,231,5,48,3,0,7,115,14,1,0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,
+0,0,6,101,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,231,5,20,231,5,25,1,115,115,115,0,0,
+231,5,30,231,5,48,2,0,7,14,0,231,5,30,231,5,45,1,0,27,0,231,5,30,231,5,32,1,0,0,0,0,
+19,1,0,0,0,0,0,12,111,98,106,101,99,116,70,105,101,108,100,115,1,0,0,254,1,254,1,0,1,27,0,231,
+5,47,231,5,47,1,7,7,7,0,1,16,0,232,5,21,232,5,25,0,0,15,0,234,5,21,241,5,32,5,0,2,
+7,115,128,1,1,14,11,0,234,5,21,241,5,32,4,0,14,115,128,1,3,2,7,6,7,0,235,5,25,240,5,44,
+7,0,2,6,7,14,115,128,1,5,0,235,5,28,235,5,39,2,6,128,1,8,27,0,235,5,28,235,5,28,1,6,
+6,6,27,0,235,5,33,235,5,39,1,128,1,128,1,128,1,16,0,236,5,29,236,5,32,0,1,7,0,237,5,30,
+240,5,44,6,0,2,6,7,14,115,15,0,237,5,33,237,5,65,5,0,2,6,7,115,1,92,14,0,237,5,43,237,
+5,51,2,6,115,27,0,237,5,43,237,5,48,1,115,115,115,0,27,0,237,5,50,237,5,50,1,6,6,6,254,1,
+254,1,0,26,0,237,5,54,237,5,65,4,0,2,7,92,0,0,0,237,5,54,237,5,65,4,0,2,7,92,14,1,
+0,0,0,0,1,0,27,1,0,0,0,0,1,0,0,0,0,19,1,0,0,0,0,0,6,101,113,117,97,108,115,1,
+0,0,254,1,254,1,0,2,14,0,237,5,54,237,5,57,2,2,92,27,0,237,5,54,237,5,54,1,2,2,2,0,
+27,0,237,5,56,237,5,56,1,92,92,92,254,1,254,1,0,14,0,237,5,62,237,5,65,2,7,92,27,0,237,5,
+62,237,5,62,1,7,7,7,0,27,0,237,5,64,237,5,64,1,92,92,92,254,1,254,1,0,1,16,0,238,5,29,
+238,5,33,0,0,0,0,240,5,29,240,5,44,4,2,6,7,14,27,0,240,5,29,240,5,31,1,14,14,14,3,27,
+0,240,5,33,240,5,33,1,2,2,2,27,0,240,5,36,240,5,36,1,7,7,7,5,0,240,5,39,240,5,43,1,
+6,3,27,0,240,5,39,240,5,39,1,6,6,6,18,0,240,5,43,240,5,43,0,1,49,1,0,0,241,5,21,241,
+5,32,3,2,7,14,27,0,241,5,21,241,5,23,1,14,14,14,3,27,0,241,5,25,241,5,25,1,2,2,2,27,
+0,241,5,28,241,5,28,1,7,7,7,18,0,241,5,31,241,5,31,0,1,48,0,0,0,243,5,17,243,5,41,3,
+0,2,7,14,0,243,5,17,243,5,35,1,0,27,0,243,5,17,243,5,19,1,0,0,0,0,19,1,0,0,0,0,
+0,15,112,114,105,109,105,116,105,118,101,69,113,117,97,108,115,1,0,0,254,1,254,1,0,2,27,0,243,5,37,243,
+5,37,1,2,2,2,27,0,243,5,40,243,5,40,1,7,7,7,0,0,19,1,0,0,0,0,0,11,114,101,115,111,
+108,118,101,80,97,116,104,1,0,0,15,0,247,5,9,248,5,80,0,2,0,255,1,1,1,255,1,2,11,0,247,5,
+9,248,5,80,1,0,2,92,36,15,0,247,5,9,248,5,80,3,0,36,92,1,9,0,0,247,5,21,247,5,37,2,
+0,92,14,0,247,5,21,247,5,29,1,0,27,0,247,5,21,247,5,23,1,0,0,0,0,19,1,0,0,0,0,0,
+5,115,112,108,105,116,1,0,0,254,1,254,1,0,2,27,0,247,5,31,247,5,31,1,92,92,92,19,0,247,5,34,
+247,5,36,0,1,47,1,0,0,0,0,0,248,5,9,248,5,80,3,0,9,36,14,0,248,5,9,248,5,16,1,0,
+27,0,248,5,9,248,5,11,1,0,0,0,0,19,1,0,0,0,0,0,4,106,111,105,110,1,0,0,254,1,254,1,
+0,2,19,0,248,5,18,248,5,20,0,1,47,1,0,0,5,0,248,5,23,248,5,79,3,0,9,36,3,0,0,248,
+5,23,248,5,73,2,0,9,14,0,248,5,23,248,5,35,1,0,27,0,248,5,23,248,5,25,1,0,0,0,0,19,
+1,0,0,0,0,0,9,109,97,107,101,65,114,114,97,121,1,0,0,254,1,254,1,0,2,5,0,248,5,37,248,5,
+53,2,0,9,4,0,0,248,5,37,248,5,51,2,0,9,14,0,248,5,37,248,5,46,1,0,27,0,248,5,37,248,
+5,39,1,0,0,0,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,254,1,254,1,0,1,27,0,
+248,5,48,248,5,50,1,9,9,9,0,18,0,248,5,53,248,5,53,0,1,49,11,0,248,5,56,248,5,72,1,9,
+1,6,14,0,248,5,67,248,5,72,2,6,9,27,0,248,5,67,248,5,69,1,9,9,9,0,27,0,248,5,71,248,
+5,71,1,6,6,6,254,1,254,1,0,0,1,0,248,5,77,248,5,79,1,36,1,27,0,248,5,78,248,5,78,1,
+36,36,36,0,0,19,1,0,0,0,0,0,9,109,97,107,101,65,114,114,97,121,1,0,0,6,1,0,0,0,0,0,
+0,2,129,1,12,0,19,1,0,0,0,0,0,3,112,111,119,1,0,0,6,1,0,0,0,0,0,1,2,10,52,0,
+19,1,0,0,0,0,0,5,102,108,111,111,114,1,0,0,6,1,0,0,0,0,0,2,1,10,0,19,1,0,0,0,
+0,0,4,99,101,105,108,1,0,0,6,1,0,0,0,0,0,3,1,10,0,19,1,0,0,0,0,0,4,115,113,114,
+116,1,0,0,6,1,0,0,0,0,0,4,1,10,0,19,1,0,0,0,0,0,3,115,105,110,1,0,0,6,1,0,
+0,0,0,0,5,1,10,0,19,1,0,0,0,0,0,3,99,111,115,1,0,0,6,1,0,0,0,0,0,6,1,10,
+0,19,1,0,0,0,0,0,3,116,97,110,1,0,0,6,1,0,0,0,0,0,7,1,10,0,19,1,0,0,0,0,
+0,4,97,115,105,110,1,0,0,6,1,0,0,0,0,0,8,1,10,0,19,1,0,0,0,0,0,4,97,99,111,115,
+1,0,0,6,1,0,0,0,0,0,9,1,10,0,19,1,0,0,0,0,0,4,97,116,97,110,1,0,0,6,1,0,
+0,0,0,0,10,1,10,0,19,1,0,0,0,0,0,4,116,121,112,101,1,0,0,6,1,0,0,0,0,0,11,1,
+10,0,19,1,0,0,0,0,0,6,102,105,108,116,101,114,1,0,0,6,1,0,0,0,0,0,12,2,12,9,0,19,
+1,0,0,0,0,0,11,111,98,106,101,99,116,72,97,115,69,120,1,0,0,6,1,0,0,0,0,0,13,3,91,92,
+130,1,0,19,1,0,0,0,0,0,6,108,101,110,103,116,104,1,0,0,6,1,0,0,0,0,0,14,1,10,0,19,
+1,0,0,0,0,0,14,111,98,106,101,99,116,70,105,101,108,100,115,69,120,1,0,0,6,1,0,0,0,0,0,15,
+2,91,130,1,0,19,1,0,0,0,0,0,9,99,111,100,101,112,111,105,110,116,1,0,0,6,1,0,0,0,0,0,
+16,1,3,0,19,1,0,0,0,0,0,4,99,104,97,114,1,0,0,6,1,0,0,0,0,0,17,1,52,0,19,1,
+0,0,0,0,0,3,108,111,103,1,0,0,6,1,0,0,0,0,0,18,1,52,0,19,1,0,0,0,0,0,3,101,
+120,112,1,0,0,6,1,0,0,0,0,0,19,1,52,0,19,1,0,0,0,0,0,8,109,97,110,116,105,115,115,97,
+1,0,0,6,1,0,0,0,0,0,20,1,52,0,19,1,0,0,0,0,0,8,101,120,112,111,110,101,110,116,1,0,
+0,6,1,0,0,0,0,0,21,1,52,0,19,1,0,0,0,0,0,6,109,111,100,117,108,111,1,0,0,6,1,0,
+0,0,0,0,22,2,2,7,0,19,1,0,0,0,0,0,6,101,120,116,86,97,114,1,0,0,6,1,0,0,0,0,
+0,23,1,10,0,19,1,0,0,0,0,0,15,112,114,105,109,105,116,105,118,101,69,113,117,97,108,115,1,0,0,6,
+1,0,0,0,0,0,24,2,2,7,0,19,1,0,0,0,0,0,6,110,97,116,105,118,101,1,0,0,6,1,0,0,
+0,0,0,25,1,131,1,0,19,1,0,0,0,0,0,3,109,100,53,1,0,0,6,1,0,0,0,0,0,26,1,40,
+0,19,1,0,0,0,0,0,6,115,104,97,50,53,54,1,0,0,6,1,0,0,0,0,0,27,1,40,0,19,1,0,
+0,0,0,0,6,98,97,115,101,54,52,1,0,0,6,1,0,0,0,0,0,28,1,132,1,0,19,1,0,0,0,0,
+0,17,98,97,115,101,54,52,68,101,99,111,100,101,66,121,116,101,115,1,0,0,6,1,0,0,0,0,0,29,1,3,
+0,19,1,0,0,0,0,0,12,98,97,115,101,54,52,68,101,99,111,100,101,1,0,0,6,1,0,0,0,0,0,30,
+1,3,0,19,1,0,0,0,0,0,16,101,115,99,97,112,101,83,116,114,105,110,103,74,115,111,110,1,0,0,6,1,
+0,0,0,0,0,31,1,111,0,19,1,0,0,0,0,0,14,109,97,110,105,102,101,115,116,74,115,111,110,69,120,1,
+0,0,6,1,0,0,0,0,0,32,2,133,1,134,1,0,19,1,0,0,0,0,0,10,109,101,114,103,101,80,97,116,
+99,104,1,0,0,6,1,0,0,0,0,0,33,2,135,1,136,1,0,19,1,0,0,0,0,0,10,115,112,108,105,116,
+76,105,109,105,116,1,0,0,6,1,0,0,0,0,0,34,3,3,8,137,1,0,19,1,0,0,0,0,0,10,102,105,
+110,100,83,117,98,115,116,114,1,0,0,6,1,0,0,0,0,0,35,2,138,1,3,0,19,1,0,0,0,0,0,10,
+115,116,114,82,101,112,108,97,99,101,1,0,0,6,1,0,0,0,0,0,36,3,3,4,139,1,0,19,1,0,0,0,
+0,0,5,115,108,105,99,101,1,0,0,6,1,0,0,0,0,0,37,4,140,1,141,1,142,1,143,1,0,19,1,0,
+0,0,0,0,5,114,97,110,103,101,1,0,0,6,1,0,0,0,0,0,38,2,4,139,1,
@@ -0,0 +1,82 @@
+/*
+Copyright 2016 Google Inc. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/** Build tool that desugars and analyses std.jsonnet, and writes the serialized AST to stdout as
+ * a comma-separated list of bytes, for embedding in the interpreter (see VmSession).
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include "ast_cache.h"
+#include "desugarer.h"
+#include "lexer.h"
+#include "parser.h"
+#include "static_analysis.h"
+
+static constexpr char STD_CODE[] = {
+    #include "std.jsonnet.h"
+};
+
+static const Fodder EF;  // Empty fodder.
+
+static const LocationRange E;  // Empty.
+
+/** Parse and desugar std.jsonnet, and add the builtin functions to it. */
+static DesugaredObject *desugar_stdlib(Allocator *alloc)
+{
+    Tokens tokens = jsonnet_lex("std.jsonnet", STD_CODE, false);
+    AST *std_ast = jsonnet_parse(alloc, tokens);
+    jsonnet_desugar_std(alloc, std_ast);
+    auto *std_obj = dynamic_cast<DesugaredObject*>(std_ast);
+    if (std_obj == nullptr) {
+        std::cerr << "INTERNAL ERROR: std.jsonnet not an object." << std::endl;
+        std::abort();
+    }
+
+    // Bind 'std' builtins that are implemented natively.
+    DesugaredObject::Fields &fields = std_obj->fields;
+    for (unsigned long c=0 ; c <= BUILTIN_MAX ; ++c) {
+        const auto &decl = jsonnet_builtin_decl(c);
+        Identifiers params;
+        for (const auto &p : decl.params)
+            params.push_back(alloc->makeIdentifier(p));
+        fields.emplace_back(
+            ObjectField::HIDDEN,
+            alloc->make<LiteralString>(E, EF, decl.name, LiteralString::DOUBLE, "", ""),
+            alloc->make<BuiltinFunction>(E, c, params));
+    }
+    return std_obj;
+}
+
+int main(void)
+{
+    try {
+        Allocator alloc;
+        DesugaredObject *std_obj = desugar_stdlib(&alloc);
+        jsonnet_static_analysis(std_obj);
+        std::string data = jsonnet_ast_serialize(std_obj);
+        for (size_t i = 0 ; i < data.length() ; ++i) {
+            std::cout << unsigned((unsigned char)data[i]) << ",";
+            if (i % 32 == 31) std::cout << "\n";
+        }
+        std::cout << std::endl;
+    } catch (const StaticError &e) {
+        std::cerr << "STATIC ERROR in std.jsonnet: " << e << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -14,53 +14,70 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#include <cerrno>
+
 #include <iomanip>
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "string_utils.h"
 #include "static_error.h"
 
-String jsonnet_string_unparse(const String &str, bool single)
+String jsonnet_string_unparse(const String &str, bool single, bool ascii)
 {
-    StringStream ss;
-    ss << (single ? U'\'' : U'\"');
-	ss << jsonnet_string_escape(str, single);
-    ss << (single ? U'\'' : U'\"');
-	return ss.str();
+    String r;
+    r.reserve(str.length() + 2);
+    r += single ? U'\'' : U'\"';
+    r += jsonnet_string_escape(str, single, ascii);
+    r += single ? U'\'' : U'\"';
+    return r;
 }
 
-String jsonnet_string_escape(const String &str, bool single)
+/** Whether c cannot be written verbatim into a string literal delimited by quote. */
+static inline bool needs_escape(char32_t c, char32_t quote, bool ascii)
 {
-    StringStream ss;
-    for (std::size_t i=0 ; i<str.length() ; ++i) {
-        char32_t c = str[i];
+    return c < 0x20 || (ascii ? c > 0x7e : c >= 0x7f && c <= 0x9f) || c == quote || c == U'\\';
+}
+
+String jsonnet_string_escape(const String &str, bool single, bool ascii)
+{
+    const char32_t quote = single ? U'\'' : U'\"';
+    String r;
+    r.reserve(str.length());
+    std::size_t i = 0;
+    while (i < str.length()) {
+        // Copy the run of characters that need no escaping in one go, most strings are
+        // entirely such a run.
+        std::size_t j = i;
+        while (j < str.length() && !needs_escape(str[j], quote, ascii)) ++j;
+        r.append(str, i, j - i);
+        if (j == str.length()) break;
+        char32_t c = str[j];
         switch (c) {
-            case U'\"': ss << (single ? U"\"" : U"\\\""); break;
-            case U'\'': ss << (single ? U"\\\'" : U"\'"); break;
-            case U'\\': ss << U"\\\\"; break;
-            case U'\b': ss << U"\\b"; break;
-            case U'\f': ss << U"\\f"; break;
-            case U'\n': ss << U"\\n"; break;
-            case U'\r': ss << U"\\r"; break;
-            case U'\t': ss << U"\\t"; break;
-            case U'\0': ss << U"\\u0000"; break;
+            case U'\"': r += U"\\\""; break;
+            case U'\'': r += U"\\\'"; break;
+            case U'\\': r += U"\\\\"; break;
+            case U'\b': r += U"\\b"; break;
+            case U'\f': r += U"\\f"; break;
+            case U'\n': r += U"\\n"; break;
+            case U'\r': r += U"\\r"; break;
+            case U'\t': r += U"\\t"; break;
+            case U'\0': r += U"\\u0000"; break;
             default: {
-                if (c < 0x20 || (c >= 0x7f && c <= 0x9f)) {
-                    //Unprintable, use \u
-                    std::stringstream ss8;
-                    ss8 << "\\u" << std::hex << std::setfill('0') << std::setw(4)
-                       << (unsigned long)(c);
-                    ss << decode_utf8(ss8.str());
-                } else {
-                    // Printable, write verbatim
-                    ss << c;
-                }
+                //Unprintable, use \u
+                std::stringstream ss8;
+                ss8 << "\\u" << std::hex << std::setfill('0') << std::setw(4)
+                   << (unsigned long)(c);
+                r += decode_utf8(ss8.str());
             }
         }
+        i = j + 1;
     }
-    return ss.str();
+    return r;
 }
 
-
 String jsonnet_string_unescape(const LocationRange &loc, const String &s)
 {
     String r;
@@ -160,3 +177,110 @@ String jsonnet_string_unescape(const LocationRange &loc, const String &s)
 }
 
 
+
+static const char BASE64_TABLE[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string jsonnet_base64_encode(const std::string &bytes)
+{
+    const auto *in = reinterpret_cast<const unsigned char*>(bytes.data());
+    size_t n = bytes.length();
+    std::string r((n + 2) / 3 * 4, '=');
+    char *out = &r[0];
+    size_t i = 0;
+    for ( ; i + 3 <= n ; i += 3) {
+        unsigned long v = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+        *out++ = BASE64_TABLE[v >> 18];
+        *out++ = BASE64_TABLE[(v >> 12) & 63];
+        *out++ = BASE64_TABLE[(v >> 6) & 63];
+        *out++ = BASE64_TABLE[v & 63];
+    }
+    if (i + 1 == n) {
+        unsigned long v = in[i] << 16;
+        *out++ = BASE64_TABLE[v >> 18];
+        *out++ = BASE64_TABLE[(v >> 12) & 63];
+    } else if (i + 2 == n) {
+        unsigned long v = (in[i] << 16) | (in[i + 1] << 8);
+        *out++ = BASE64_TABLE[v >> 18];
+        *out++ = BASE64_TABLE[(v >> 12) & 63];
+        *out++ = BASE64_TABLE[(v >> 6) & 63];
+    }
+    return r;
+}
+
+bool jsonnet_base64_decode(const std::string &str, std::string &bytes)
+{
+    // The value of each character, 64 for '=' and 255 for characters that are not base64.
+    static const struct Inverse {
+        unsigned char values[256];
+        Inverse(void)
+        {
+            for (auto &v : values) v = 255;
+            for (unsigned char i = 0 ; i < 64 ; ++i)
+                values[static_cast<unsigned char>(BASE64_TABLE[i])] = i;
+            values[static_cast<unsigned char>('=')] = 64;
+        }
+    } inverse;
+
+    if (str.length() % 4 != 0) return false;
+    bytes.clear();
+    bytes.reserve(str.length() / 4 * 3);
+    const auto *in = reinterpret_cast<const unsigned char*>(str.data());
+    for (size_t i = 0 ; i < str.length() ; i += 4) {
+        unsigned char a = inverse.values[in[i]];
+        unsigned char b = inverse.values[in[i + 1]];
+        unsigned char c = inverse.values[in[i + 2]];
+        unsigned char d = inverse.values[in[i + 3]];
+        // Only the last two characters of a group can be padding, and "x=y" is not allowed.
+        if (a >= 64 || b >= 64 || c > 64 || d > 64 || (c == 64 && d != 64)) return false;
+        bytes += char((a << 2) | (b >> 4));
+        if (c == 64) continue;
+        bytes += char(((b & 15) << 4) | (c >> 2));
+        if (d == 64) continue;
+        bytes += char(((c & 3) << 6) | d);
+    }
+    return true;
+}
+
+bool jsonnet_read_file(const std::string &path, std::string &content, bool &opened)
+{
+    opened = false;
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    opened = true;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        errno = err;
+        return false;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        ::close(fd);
+        errno = EISDIR;
+        return false;
+    }
+
+    // Leave room for the read that finds the end of the file.  Files that are not regular, or
+    // that grow while being read, are handled by growing the buffer.
+    content.assign(S_ISREG(st.st_mode) ? st.st_size + 1 : 4096, '\0');
+    size_t length = 0;
+    while (true) {
+        if (length == content.length())
+            content.resize(content.length() * 2);
+        ssize_t n = ::read(fd, &content[length], content.length() - length);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            int err = errno;
+            ::close(fd);
+            errno = err;
+            return false;
+        }
+        if (n == 0) break;
+        length += n;
+    }
+    ::close(fd);
+    content.resize(length);
+    return true;
+}
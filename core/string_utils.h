@@ -19,13 +19,40 @@ limitations under the License.
 
 #include "lexer.h"
 
-/** Unparse the string. */
-String jsonnet_string_unparse(const String &str, bool single);
+/** Unparse the string.
+ *
+ * \param ascii If true, every character outside printable ASCII is escaped with \u, as
+ * std.escapeStringJson does, rather than only the unprintable ones.
+ */
+String jsonnet_string_unparse(const String &str, bool single, bool ascii = false);
 
-/** Escape special characters. */
-String jsonnet_string_escape(const String &str, bool single);
+/** Escape special characters, see jsonnet_string_unparse. */
+String jsonnet_string_escape(const String &str, bool single, bool ascii = false);
 
 /** Resolve escape chracters in the string. */
 String jsonnet_string_unescape(const LocationRange &loc, const String &s);
 
+/** Read a whole file with open, fstat and read, without going through iostreams.
+ *
+ * The file is read rather than mapped, so that the content is a snapshot that cannot change or
+ * vanish if the file is rewritten or truncated afterwards.
+ *
+ * \param path The file to read.
+ * \param content Set to the content of the file if successful.
+ * \param opened Set to whether the file could be opened.
+ * \returns false if the file could not be read, with errno set (to EISDIR for a directory).
+ */
+bool jsonnet_read_file(const std::string &path, std::string &content, bool &opened);
+
+/** Encode bytes as base64, padded with '='. */
+std::string jsonnet_base64_encode(const std::string &bytes);
+
+/** Decode base64, each group of 4 characters of which may end with '=' padding.
+ *
+ * \param str The base64 to decode.
+ * \param bytes Set to the decoded bytes.
+ * \returns false if str is not valid base64.
+ */
+bool jsonnet_base64_decode(const std::string &str, std::string &bytes);
+
 #endif
@@ -16,10 +16,20 @@ limitations under the License.
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 
+#include "ast_cache.h"
 #include "desugarer.h"
+#include "digest.h"
+#include "json_parser.h"
 #include "parser.h"
 #include "state.h"
 #include "static_analysis.h"
@@ -50,6 +60,7 @@ enum FrameKind {
     FRAME_BINARY_RIGHT,  // b in a + b
     FRAME_BUILTIN_FILTER,  // When executing std.filter, used to hold intermediate state.
     FRAME_BUILTIN_FORCE_THUNKS,  // When forcing builtin args, holds intermediate state.
+    FRAME_BUILTIN_MERGE_PATCH,  // Holds the fields of the object built by std.mergePatch.
     FRAME_CALL,  // Used any time we have switched location in user code.
     FRAME_ERROR,  // e in error e
     FRAME_IF,  // e in if e then a else b
@@ -185,6 +196,102 @@ struct Frame {
 
 };
 
+/** Measures the time and allocations of each call frame, for a VmProfile.
+ *
+ * Frames are kept in a tree of the stacks seen so far, so that entering a frame does not need
+ * to look at the frames below it.
+ */
+class Profiler {
+    typedef std::chrono::steady_clock Clock;
+
+    struct Node {
+        unsigned parent;
+        std::string name;
+        std::map<std::string, unsigned> children;
+        VmProfile::Entry entry;
+        Node(unsigned parent, const std::string &name)
+          : parent(parent), name(name)
+        { }
+    };
+
+    /** A frame that has been entered but not yet exited. */
+    struct Open {
+        unsigned node;
+        Clock::time_point start;
+        unsigned long startAllocations;
+        double childSeconds;
+        unsigned long childAllocations;
+    };
+
+    const Heap &heap;
+
+    /** The root, nodes[0], stands for the evaluation outside of any call frame. */
+    std::vector<Node> nodes;
+
+    std::vector<Open> open;
+
+    public:
+
+    Profiler(const Heap &heap)
+      : heap(heap)
+    {
+        nodes.emplace_back(0, "<top level>");
+        open.push_back(Open{0, Clock::now(), heap.getNumAllocations(), 0, 0});
+    }
+
+    /** A call frame with the given name was pushed. */
+    void enter(const std::string &name)
+    {
+        unsigned parent = open.back().node;
+        auto it = nodes[parent].children.find(name);
+        unsigned node;
+        if (it != nodes[parent].children.end()) {
+            node = it->second;
+        } else {
+            node = nodes.size();
+            nodes[parent].children[name] = node;
+            nodes.emplace_back(parent, name);
+        }
+        open.push_back(Open{node, Clock::now(), heap.getNumAllocations(), 0, 0});
+    }
+
+    /** The innermost call frame was popped. */
+    void exit(void)
+    {
+        const Open &o = open.back();
+        double seconds = std::chrono::duration<double>(Clock::now() - o.start).count();
+        unsigned long allocations = heap.getNumAllocations() - o.startAllocations;
+        VmProfile::Entry &entry = nodes[o.node].entry;
+        entry.calls++;
+        entry.selfSeconds += seconds - o.childSeconds;
+        entry.selfAllocations += allocations - o.childAllocations;
+        open.pop_back();
+        if (!open.empty()) {
+            open.back().childSeconds += seconds;
+            open.back().childAllocations += allocations;
+        }
+    }
+
+    /** Exit the frames still open, e.g. after an error, and add everything to the profile. */
+    void save(VmProfile &profile)
+    {
+        while (!open.empty()) exit();
+        for (unsigned i = 0 ; i < nodes.size() ; ++i) {
+            const VmProfile::Entry &entry = nodes[i].entry;
+            if (entry.calls == 0) continue;
+            std::vector<std::string> names;
+            for (unsigned n = i ; n != 0 ; n = nodes[n].parent)
+                names.push_back(nodes[n].name);
+            names.push_back(nodes[0].name);
+            std::reverse(names.begin(), names.end());
+            VmProfile::Entry &total = profile.stacks[names];
+            total.calls += entry.calls;
+            total.selfSeconds += entry.selfSeconds;
+            total.selfAllocations += entry.selfAllocations;
+        }
+    }
+};
+
 /** The stack holds all the stack frames and manages the stack frame limit. */
 class Stack {
 
@@ -197,15 +304,23 @@ class Stack {
     /** The stack frames. */
     std::vector<Frame> stack;
 
+    /** Told about every call frame, if not nullptr. */
+    Profiler *profiler;
+
     public:
 
     Stack(unsigned limit)
-      : calls(0), limit(limit)
+      : calls(0), limit(limit), profiler(nullptr)
     {
     }
 
     ~Stack(void) { }
 
+    void setProfiler(Profiler *p)
+    {
+        profiler = p;
+    }
+
     unsigned size(void)
     {
         return stack.size();
@@ -245,7 +360,10 @@ class Stack {
 
     void pop(void)
     {
-        if (top().isCall()) calls--;
+        if (top().isCall()) {
+            calls--;
+            if (profiler != nullptr) profiler->exit();
+        }
         stack.pop_back();
     }
 
@@ -277,7 +395,9 @@ class Stack {
             return "thunk <" + encode_utf8(thunk->name->name) + ">";
         } else {
             const auto *func = static_cast<const HeapClosure *>(e);
-            if (func->body == nullptr) {
+            if (!func->nativeName.empty()) {
+                return "native function <" + func->nativeName + ">";
+            } else if (func->body == nullptr) {
                 name = encode_utf8(jsonnet_builtin_decl(func->builtin).name);
                 return "builtin function <" + name + ">";
             }
@@ -337,6 +457,7 @@ class Stack {
                     // Remove all stack frames including this one.
                     while (stack.size() > unsigned(i)) stack.pop_back();
                     calls--;
+                    if (profiler != nullptr) profiler->exit();
                     return;
                 } break;
 
@@ -355,6 +476,16 @@ class Stack {
         if (calls >= limit) {
             throw makeError(loc, "Max stack frames exceeded.");
         }
+        if (profiler != nullptr) {
+            std::stringstream ss;
+            ss << loc;
+            std::string name = ss.str();
+            if (context != nullptr)
+                name = getName(stack.size(), context) + (name.empty() ? "" : " ") + name;
+            // The folded format separates frames with ';'.
+            std::replace(name.begin(), name.end(), ';', ',');
+            profiler->enter(name);
+        }
         stack.emplace_back(FRAME_CALL, loc);
         calls++;
         top().context = context;
@@ -403,6 +534,80 @@ typedef std::map<std::string, VmExt> ExtMap;
 typedef std::map<std::string, std::string> StrMap;
 
 
+/** Writes the visited value as JSON text. */
+class JsonWriter : public VmVisitor {
+    struct Container {
+        /** The indentation of the line that opened the container. */
+        String indent;
+        bool isObject;
+        bool empty;
+    };
+
+    bool multiline;
+    /** Added to the indentation for each level of nesting, if multiline. */
+    String indentUnit;
+    std::vector<Container> open;
+    StringStream ss;
+
+    /** Start an element of the innermost container, or a field if name is not nullptr. */
+    void element(const String *name)
+    {
+        if (open.empty()) return;
+        Container &c = open.back();
+        if (c.isObject && name == nullptr) return;  // The value of a field.
+        const char32_t *bracket = c.isObject ? U"{" : U"[";
+        if (multiline) {
+            ss << (c.empty ? bracket : U",") << U"\n" << c.indent << indentUnit;
+        } else {
+            ss << (c.empty ? bracket : U", ");
+        }
+        c.empty = false;
+        if (name != nullptr)
+            ss << U"\"" << *name << U"\": ";
+    }
+
+    void begin(bool is_object)
+    {
+        element(nullptr);
+        String indent;
+        if (multiline && !open.empty())
+            indent = open.back().indent + indentUnit;
+        open.push_back(Container{indent, is_object, true});
+    }
+
+    void end(void)
+    {
+        const Container &c = open.back();
+        const char32_t *bracket = c.isObject ? U"}" : U"]";
+        if (c.empty) {
+            ss << (c.isObject ? U"{ " : U"[ ") << bracket;
+        } else {
+            ss << (multiline ? U"\n" + c.indent : String()) << bracket;
+        }
+        open.pop_back();
+    }
+
+    public:
+    /** \param multiline If true, objects and arrays are indented, with an element per line.
+     * \param indent_unit The indentation added for each level of nesting.
+     */
+    JsonWriter(bool multiline, const String &indent_unit = U"   ")
+      : multiline(multiline), indentUnit(indent_unit)
+    { }
+
+    void null(void) { element(nullptr); ss << U"null"; }
+    void boolean(bool v) { element(nullptr); ss << (v ? U"true" : U"false"); }
+    void number(double v) { element(nullptr); ss << decode_utf8(jsonnet_unparse_number(v)); }
+    void string(const String &v) { element(nullptr); ss << jsonnet_string_unparse(v, false); }
+    void beginArray(void) { begin(false); }
+    void endArray(void) { end(); }
+    void beginObject(void) { begin(true); }
+    void field(const String &name) { element(&name); }
+    void endObject(void) { end(); }
+
+    String str(void) { return ss.str(); }
+};
+
 /** Holds the intermediate state during execution and implements the necessary functions to
  * implement the semantics of the language.
  *
@@ -422,36 +627,98 @@ class Interpreter {
     /** The stack. */
     Stack stack;
 
+    /** Measures the call frames on the stack, if profiling. */
+    std::unique_ptr<Profiler> profiler;
+
+    /** Where the profiler saves its measurements, or nullptr if not profiling. */
+    VmProfile *profile;
+
+    /** Counters of this evaluation, beyond those kept by the heap. */
+    VmStats stats;
+
+    /** Where stats are added at the end of the evaluation, or nullptr. */
+    VmStats *statsTotal;
+
+    /** Where the standard library and imported ASTs are kept. */
+    VmSession *session;
+
     /** Used to create ASTs if needed.
      *
-     * This is used at import time, and in a few other cases.
+     * This is used for std.extVar code, and in a few other cases.  Its parent is
+     * session->alloc.
      */
     Allocator *alloc;
 
+    /** The variable that every file refers to the standard library through. */
+    const Identifier *idStd;
+
+    /** The standard library object, bound to idStd. */
+    HeapThunk *stdThunk;
+
+    /** The strings of a single codepoint below 256, or nullptr until first needed.
+     *
+     * Strings are immutable, so these are shared by every value that needs them, e.g. each
+     * str[i].  Once made they stay reachable until the interpreter is destroyed.
+     */
+    HeapString *charStrings[256];
+
+    /** The strings returned by std.type, shared in the same way as charStrings. */
+    std::map<Value::Type, HeapString*> typeNames;
+
+    /** The value of each string literal evaluated so far, shared in the same way. */
+    std::unordered_map<const LiteralString*, HeapString*> literalStrings;
+
     /** Used to "name" thunks created on the inside of an array. */
     const Identifier *idArrayElement;
 
     /** Used to "name" thunks created to execute invariants. */
     const Identifier *idInvariant;
 
+    /** Bound to the value of each field of an object imported from JSON. */
+    const Identifier *idJsonField;
+
+    /** The body of each field of an object imported from JSON, i.e. a Var of idJsonField. */
+    const AST *jsonFieldBody;
+
+    /** Bound to the target and patch of a field of an object made by std.mergePatch. */
+    const Identifier *idMergeTarget;
+    const Identifier *idMergePatch;
+
+    /** The body of a field whose patch is an object, i.e. std.mergePatch of those two. */
+    const AST *mergePatchFieldBody;
+
     struct ImportCacheValue {
         std::string foundHere;
-        std::string content;
+        /** Lent by the import callback, and shared with the session if it is parsed. */
+        VmImportBuffer content;
+        /** Whether the file was imported as JSON, see importJson. */
+        enum { JSON_UNKNOWN, JSON_VALID, JSON_INVALID } jsonState;
+        /** The value of the file if jsonState is JSON_VALID. */
+        Value json;
+        ImportCacheValue(void)
+          : jsonState(JSON_UNKNOWN)
+        { }
     };
 
     /** Cache for imported Jsonnet files. */
     std::map<std::pair<std::string, String>,
-             const ImportCacheValue *> cachedImports;
+             ImportCacheValue *> cachedImports;
 
     /** External variables for std.extVar. */
     ExtMap externalVars;
 
+    /** The functions given by std.native. */
+    VmNativeCallbackMap nativeCallbacks;
+
     /** The callback used for loading imported files. */
-    JsonnetImportCallback *importCallback;
+    JsonnetImportBufferCallback *importCallback;
 
     /** User context pointer for the import callback. */
     void *importCallbackContext;
 
+    /** Where the phases of the evaluation are reported, or nullptr. */
+    const VmTrace *trace;
+
     RuntimeError makeError(const LocationRange &loc, const std::string &msg)
     {
         return stack.makeError(loc, msg);
@@ -465,6 +732,9 @@ class Interpreter {
     {
         T *r = heap.makeEntity<T, Args...>(std::forward<Args>(args)...);
         if (heap.checkHeap()) {  // Do a GC cycle?
+            VmTraceSpan span(trace, JSONNET_TRACE_GC);
+            auto mark_start = std::chrono::steady_clock::now();
+
             // Avoid the object we just made being collected.
             heap.markFrom(r);
 
@@ -474,8 +744,33 @@ class Interpreter {
             // Mark from the scratch register
             heap.markFrom(scratch);
 
+            // The standard library is always reachable.
+            if (stdThunk != nullptr) heap.markFrom(stdThunk);
+
+            // The cached single codepoint strings.
+            for (auto *str : charStrings) {
+                if (str != nullptr) heap.markFrom(str);
+            }
+            // A slot is briefly nullptr while its string is being made.
+            for (const auto &pair : typeNames) {
+                if (pair.second != nullptr) heap.markFrom(pair.second);
+            }
+            for (const auto &pair : literalStrings) {
+                if (pair.second != nullptr) heap.markFrom(pair.second);
+            }
+
+            // So are the files imported as JSON, as they are reused by later imports.
+            for (const auto &pair : cachedImports) {
+                if (pair.second->jsonState == ImportCacheValue::JSON_VALID)
+                    heap.markFrom(pair.second->json);
+            }
+
             // Delete unreachable objects.
+            auto sweep_start = std::chrono::steady_clock::now();
             heap.sweep();
+            auto sweep_end = std::chrono::steady_clock::now();
+            stats.gcMarkSeconds += std::chrono::duration<double>(sweep_start - mark_start).count();
+            stats.gcSweepSeconds += std::chrono::duration<double>(sweep_end - sweep_start).count();
         }
         return r;
     }
@@ -514,7 +809,7 @@ class Interpreter {
         return r;
     }
 
-    Value makeArray(const std::vector<HeapThunk*> &v)
+    Value makeArray(const HeapArrayElements &v)
     {
         Value r;
         r.t = Value::ARRAY;
@@ -522,6 +817,15 @@ class Interpreter {
         return r;
     }
 
+    /** An array of the length numbers from, from + 1, ..., see HeapArray::isRange. */
+    Value makeRange(double from, size_t length)
+    {
+        Value r;
+        r.t = Value::ARRAY;
+        r.v.h = makeHeap<HeapArray>(from, length);
+        return r;
+    }
+
     Value makeClosure(const BindingFrame &env,
                        HeapObject *self,
                        unsigned offset,
@@ -543,6 +847,18 @@ class Interpreter {
         return r;
     }
 
+    /** The function given by std.native for a callback given to jsonnet_native_callback. */
+    Value makeNativeBuiltin(const std::string &name, const std::vector<std::string> &params)
+    {
+        std::vector<const Identifier*> ids;
+        for (const auto &p : params)
+            ids.push_back(alloc->makeIdentifier(decode_utf8(p)));
+        Value r;
+        r.t = Value::FUNCTION;
+        r.v.h = makeHeap<HeapClosure>(BindingFrame(), nullptr, 0, ids, nullptr, 0, name);
+        return r;
+    }
+
     template <class T, class... Args> Value makeObject(Args... args)
     {
         Value r;
@@ -553,12 +869,36 @@ class Interpreter {
 
     Value makeString(const String &v)
     {
+        if (v.length() == 1 && v[0] < 256) return makeChar(v[0]);
         Value r;
         r.t = Value::STRING;
         r.v.h = makeHeap<HeapString>(v);
         return r;
     }
 
+    /** The string v, made in the given cache slot the first time it is needed.
+     *
+     * The slot must be marked by the garbage collector once it is set.
+     */
+    Value makeCachedString(HeapString *&slot, const String &v)
+    {
+        if (slot == nullptr) {
+            auto *str = makeHeap<HeapString>(v);
+            slot = str;
+        }
+        Value r;
+        r.t = Value::STRING;
+        r.v.h = slot;
+        return r;
+    }
+
+    /** A string of the single codepoint c, shared with other such values where possible. */
+    Value makeChar(char32_t c)
+    {
+        if (c >= 256) return makeString(String(&c, 1));
+        return makeCachedString(charStrings[c], String(&c, 1));
+    }
+
     /** Auxiliary function of objectIndex.
      *
      * Traverse the object's tree from right to left, looking for an object
@@ -634,7 +974,7 @@ class Interpreter {
             counter++;
             if (counter <= skip) return r;
             for (const auto &f : obj->compValues)
-                r[f.first] = ObjectField::VISIBLE;
+                r[f.first] = !manifesting ? ObjectField::VISIBLE : obj->hide;
         }
         return r;
     }
@@ -651,21 +991,220 @@ class Interpreter {
         return r;
     }
 
+    /** Builds the value of a JSON file on the heap, for importJson.
+     *
+     * Entities are made without triggering a garbage collection cycle, since the values built
+     * so far are not reachable from the stack.
+     */
+    class JsonBuilder : public JsonParseHandler {
+        Interpreter &vm;
+        std::vector<Value> values;
+        std::vector<const Identifier*> keys;
+
+        template <class T, class... Args> Value make(Value::Type t, Args&&... args)
+        {
+            Value r;
+            r.t = t;
+            r.v.h = vm.heap.makeEntity<T>(std::forward<Args>(args)...);
+            return r;
+        }
+
+        HeapThunk *makeThunk(const Identifier *name, const Value &v)
+        {
+            auto *th = vm.heap.makeEntity<HeapThunk>(name, nullptr, 0, nullptr);
+            th->fill(v);
+            return th;
+        }
+
+        public:
+        JsonBuilder(Interpreter &vm)
+          : vm(vm)
+        { }
+        void null(void) { values.push_back(vm.makeNull()); }
+        void boolean(bool v) { values.push_back(vm.makeBoolean(v)); }
+        void number(double v) { values.push_back(vm.makeDouble(v)); }
+        void string(const String &v) { values.push_back(make<HeapString>(Value::STRING, v)); }
+        void key(const String &v) { keys.push_back(vm.alloc->makeIdentifier(v)); }
+        void arrayEnd(size_t elements)
+        {
+            size_t first = values.size() - elements;
+            std::vector<HeapThunk*> thunks(elements);
+            for (size_t i = 0 ; i < elements ; ++i)
+                thunks[i] = makeThunk(vm.idArrayElement, values[first + i]);
+            values.resize(first);
+            values.push_back(make<HeapArray>(Value::ARRAY, thunks));
+        }
+        bool objectEnd(size_t fields)
+        {
+            size_t first = values.size() - fields;
+            size_t first_key = keys.size() - fields;
+            BindingFrame comp_values;
+            for (size_t i = 0 ; i < fields ; ++i) {
+                const Identifier *id = keys[first_key + i];
+                if (!comp_values.emplace(id, makeThunk(id, values[first + i])).second)
+                    return false;  // Jsonnet reports duplicate fields as an error.
+            }
+            values.resize(first);
+            keys.resize(first_key);
+            // A comprehension whose field bodies just return the values bound to their names,
+            // and whose fields can be hidden by the object they are added to, as for { a: b }.
+            values.push_back(make<HeapComprehensionObject>(
+                Value::OBJECT, BindingFrame{}, vm.jsonFieldBody, vm.idJsonField, comp_values,
+                ObjectField::INHERIT));
+            return true;
+        }
+        const Value &result(void) { return values.back(); }
+    };
+
+    /** Try to import a file as plain JSON, which is much faster than importing it as Jsonnet.
+     *
+     * Files named *.json, and other files starting with '{' or '[', are parsed as JSON.  If that
+     * fails, or the file would not evaluate to exactly the same value as Jsonnet (e.g. because
+     * of duplicate keys), the file is not JSON and must be imported with import() instead.
+     *
+     * \param input The result of importString.
+     * \returns Whether the file is JSON, in which case input->json is its value.
+     */
+    bool importJson(ImportCacheValue *input)
+    {
+        if (input->jsonState == ImportCacheValue::JSON_UNKNOWN) {
+            input->jsonState = ImportCacheValue::JSON_INVALID;
+            const JsonnetImportBuffer &buf = *input->content;
+            const std::string &name = input->foundHere;
+            bool json_name = name.length() >= 5 && name.compare(name.length() - 5, 5, ".json") == 0;
+            size_t i = 0;
+            while (i < buf.length && std::strchr(" \t\n\r", buf.data[i]) != nullptr) ++i;
+            bool json_start = i < buf.length && (buf.data[i] == '{' || buf.data[i] == '[');
+            if (json_name || json_start) {
+                VmTraceSpan span(trace, JSONNET_TRACE_PARSE, name);
+                JsonBuilder builder(*this);
+                if (jsonnet_parse_json(buf.data, buf.length, builder)) {
+                    input->json = builder.result();
+                    input->jsonState = ImportCacheValue::JSON_VALID;
+                }
+            }
+        }
+        return input->jsonState == ImportCacheValue::JSON_VALID;
+    }
+
+    /** Build the value of a result of a native callback, see JsonBuilder. */
+    void buildJson(const LocationRange &loc, const JsonnetJsonValue &v, JsonBuilder &builder)
+    {
+        switch (v.kind) {
+            case JsonnetJsonValue::ARRAY:
+            for (const auto &el : v.elements)
+                buildJson(loc, *el, builder);
+            builder.arrayEnd(v.elements.size());
+            break;
+
+            case JsonnetJsonValue::BOOL:
+            builder.boolean(v.number != 0);
+            break;
+
+            case JsonnetJsonValue::NULL_KIND:
+            builder.null();
+            break;
+
+            case JsonnetJsonValue::NUMBER:
+            if (std::isnan(v.number) || std::isinf(v.number))
+                throw makeError(loc, "Native extension returned a number that is not finite.");
+            builder.number(v.number);
+            break;
+
+            case JsonnetJsonValue::OBJECT:
+            for (const auto &pair : v.fields) {
+                builder.key(decode_utf8(pair.first));
+                buildJson(loc, *pair.second, builder);
+            }
+            builder.objectEnd(v.fields.size());
+            break;
+
+            case JsonnetJsonValue::STRING:
+            builder.string(decode_utf8(v.string));
+            break;
+        }
+    }
+
+    /** Call a function given by std.native.
+     *
+     * \param loc Where the function was called.
+     * \param name The name of the native callback.
+     * \param args The values of the arguments.
+     * \returns The value returned by the callback.
+     */
+    Value callNative(const LocationRange &loc, const std::string &name,
+                     const std::vector<Value> &args)
+    {
+        const VmNativeCallback &cb = nativeCallbacks.find(name)->second;
+        std::vector<JsonnetJsonValue> values;
+        values.reserve(args.size());
+        for (const Value &arg : args) {
+            switch (arg.t) {
+                case Value::NULL_TYPE:
+                values.emplace_back(JsonnetJsonValue::NULL_KIND, "", 0);
+                break;
+
+                case Value::BOOLEAN:
+                values.emplace_back(JsonnetJsonValue::BOOL, "", arg.v.b ? 1 : 0);
+                break;
+
+                case Value::DOUBLE:
+                values.emplace_back(JsonnetJsonValue::NUMBER, "", arg.v.d);
+                break;
+
+                case Value::STRING:
+                values.emplace_back(JsonnetJsonValue::STRING,
+                                    encode_utf8(static_cast<HeapString*>(arg.v.h)->value), 0);
+                break;
+
+                default:
+                throw makeError(loc, "Native extensions can only take primitives, got "
+                                     + type_str(arg) + ".");
+            }
+        }
+        std::vector<const JsonnetJsonValue*> argv;
+        for (const auto &v : values)
+            argv.push_back(&v);
+        int success = 0;
+        std::unique_ptr<JsonnetJsonValue> r(cb.cb(cb.ctx, argv.data(), &success));
+        if (r == nullptr)
+            throw makeError(loc, "Native extension " + name + " returned NULL.");
+        if (!success) {
+            if (r->kind != JsonnetJsonValue::STRING)
+                throw makeError(loc, "Native extension returned an error that was not a string.");
+            throw makeError(loc, r->string);
+        }
+        JsonBuilder builder(*this);
+        buildJson(loc, *r, builder);
+        return builder.result();
+    }
+
     /** Import another Jsonnet file.
      *
      * If the file has already been imported, then use that version.  This maintains
-     * referential transparency in the case of writes to disk during execution.
+     * referential transparency in the case of writes to disk during execution.  The AST is
+     * reused from the session if the file has been parsed before with the same content.
      *
-     * \param loc Location of the import statement.
-     * \param file Path to the filename.
+     * \param input The result of importString.
      */
-    AST *import(const LocationRange &loc, const LiteralString *file)
+    AST *import(const ImportCacheValue *input)
     {
-        const ImportCacheValue *input = importString(loc, file);
-        Tokens tokens = jsonnet_lex(input->foundHere, input->content.c_str());
-        AST *expr = jsonnet_parse(alloc, tokens);
-        jsonnet_desugar(alloc, expr);
-        jsonnet_static_analysis(expr);
+        AST *expr = session->findImport(input->foundHere, input->content);
+        if (expr == nullptr) {
+            const JsonnetImportBuffer &buf = *input->content;
+            std::unique_ptr<Allocator> import_alloc(new Allocator(&session->alloc));
+            // The lexer needs the code to be followed by a '\0', so it gets a copy while parsing.
+            std::string code(buf.data, buf.length);
+            expr = session->parse(import_alloc.get(), input->foundHere, code.c_str(),
+                                  code.length(), trace);
+            VmSession::Import &cached = session->imports[input->foundHere];
+            if (cached.alloc != nullptr)
+                session->staleImports.push_back(std::move(cached.alloc));
+            // The session keeps a reference to the lent buffer rather than a copy of it.
+            cached.content = input->content;
+            cached.expr = expr;
+            cached.alloc = std::move(import_alloc);
+        }
         return expr;
     }
 
@@ -678,35 +1217,39 @@ class Interpreter {
      * \param file Path to the filename.
      * \param found_here If non-null, used to store the actual path of the file
      */
-    const ImportCacheValue *importString(const LocationRange &loc, const LiteralString *file)
+    ImportCacheValue *importString(const LocationRange &loc, const LiteralString *file)
     {
         std::string dir = dir_name(loc.file);
 
         const String &path = file->value;
 
         std::pair<std::string, String> key(dir, path);
-        const ImportCacheValue *cached_value = cachedImports[key];
+        ImportCacheValue *cached_value = cachedImports[key];
         if (cached_value != nullptr)
             return cached_value;
 
-        int success = 0;
+        VmTraceSpan span(trace, JSONNET_TRACE_IMPORT, encode_utf8(path));
         char *found_here_cptr;
-        char *content =
+        JsonnetImportBuffer content = {nullptr, 0, nullptr, nullptr};
+        char *err =
             importCallback(importCallbackContext, dir.c_str(), encode_utf8(path).c_str(),
-                           &found_here_cptr, &success);
+                           &found_here_cptr, &content);
 
-        std::string input(content);
-        ::free(content);
-
-        if (!success) {
+        if (err != nullptr) {
             std::string msg = "Couldn't open import \"" + encode_utf8(path) + "\": ";
-            msg += input;
+            msg += err;
+            ::free(err);
             throw makeError(loc, msg);
         }
 
+        if (content.data == nullptr) {
+            content.data = "";
+            content.length = 0;
+        }
+
         auto *input_ptr = new ImportCacheValue();
+        input_ptr->content = jsonnet_vm_import_buffer(content);
         input_ptr->foundHere = found_here_cptr;
-        input_ptr->content = input;
         ::free(found_here_cptr);
         cachedImports[key] = input_ptr;
         return input_ptr;
@@ -745,23 +1288,68 @@ class Interpreter {
      *
      * \param loc The location range of the file to be executed.
      */
-    Interpreter(Allocator *alloc, const ExtMap &ext_vars,
-                unsigned max_stack, double gc_min_objects, double gc_growth_trigger,
-                JsonnetImportCallback *import_callback, void *import_callback_context)
-      : heap(gc_min_objects, gc_growth_trigger), stack(max_stack), alloc(alloc),
+    Interpreter(VmSession *session, Allocator *alloc, const ExtMap &ext_vars,
+                const VmNativeCallbackMap &native_callbacks, unsigned max_stack,
+                double gc_min_objects, double gc_growth_trigger,
+                JsonnetImportBufferCallback *import_callback, void *import_callback_context,
+                VmProfile *profile, VmStats *stats_total, const VmTrace *trace)
+      : heap(gc_min_objects, gc_growth_trigger, stats_total != nullptr), stack(max_stack),
+        profile(profile), statsTotal(stats_total), session(session),
+        alloc(alloc), idStd(alloc->makeIdentifier(U"$std")), stdThunk(nullptr),
         idArrayElement(alloc->makeIdentifier(U"array_element")),
-        idInvariant(alloc->makeIdentifier(U"object_assert")), externalVars(ext_vars),
-        importCallback(import_callback), importCallbackContext(import_callback_context)
+        idInvariant(alloc->makeIdentifier(U"object_assert")),
+        idJsonField(alloc->makeIdentifier(U"json_field")),
+        jsonFieldBody(alloc->make<Var>(LocationRange(), Fodder{}, idJsonField)),
+        idMergeTarget(alloc->makeIdentifier(U"merge_target")),
+        idMergePatch(alloc->makeIdentifier(U"merge_patch")),
+        externalVars(ext_vars), nativeCallbacks(native_callbacks),
+        importCallback(import_callback), importCallbackContext(import_callback_context),
+        trace(trace)
     {
         scratch = makeNull();
+        std::fill(std::begin(charStrings), std::end(charStrings), nullptr);
+        // Built after static analysis, so the variables the arguments capture are set here.
+        Apply::Args merge_args;
+        for (const Identifier *id : {idMergeTarget, idMergePatch}) {
+            auto *var = alloc->make<Var>(LocationRange(), Fodder{}, id);
+            var->freeVariables.push_back(id);
+            merge_args.emplace_back(var, Fodder{});
+        }
+        auto *merge_patch = alloc->make<BuiltinFunction>(
+            LocationRange(), BUILTIN_MERGE_PATCH, Identifiers{idMergeTarget, idMergePatch});
+        mergePatchFieldBody = alloc->make<Apply>(LocationRange(), Fodder{}, merge_patch, Fodder{},
+                                                 merge_args, false, Fodder{}, Fodder{}, true);
+        stdThunk = makeHeap<HeapThunk>(idStd, nullptr, 0, session->stdlib);
+        if (profile != nullptr) {
+            profiler.reset(new Profiler(heap));
+            stack.setProfiler(profiler.get());
+        }
     }
 
     /** Clean up the heap, stack, stash, and builtin function ASTs. */
     ~Interpreter()
     {
+        if (profiler != nullptr)
+            profiler->save(*profile);
+        if (statsTotal != nullptr) {
+            // Array elements are counted as the arrays are freed.
+            heap.clear();
+            const HeapStats &heap_stats = heap.getStats();
+            for (int kind = 0 ; kind < HEAP_NUM_KINDS ; ++kind) {
+                auto &entities = stats.entities[heap_entity_kind_name(HeapEntityKind(kind))];
+                entities.allocations = heap_stats.allocations[kind];
+                entities.bytes = heap_stats.bytes[kind];
+            }
+            stats.evaluations = 1;
+            stats.gcCycles = heap_stats.cycles;
+            stats.peakEntities = heap_stats.peakEntities;
+            statsTotal->merge(stats);
+        }
         for (const auto &pair : cachedImports) {
             delete pair.second;
         }
+        // Nothing refers to replaced imports once the evaluation is over.
+        session->dropStaleImports();
     }
 
     const Value &getScratchRegister(void)
@@ -809,7 +1397,7 @@ class Interpreter {
 
     String toString(const LocationRange &loc)
     {
-        return manifestJson(loc, false, U"");
+        return manifestJson(loc, false);
     }
 
 
@@ -892,6 +1480,155 @@ class Interpreter {
         evaluate(thunk->body, initial_stack_size);
     }
 
+    /** Force the elements of an array, for builtins that need all of its values.
+     *
+     * The array must be kept alive by the caller, e.g. by being an argument of the builtin.
+     * Evaluating the elements can grow the stack, so references to frames are invalidated.
+     */
+    std::vector<Value> forceElements(const LocationRange &loc, HeapArray *arr)
+    {
+        std::vector<Value> r;
+        r.reserve(arr->size());
+        if (arr->isRange) {
+            for (size_t i = 0 ; i < arr->rangeLength ; ++i)
+                r.push_back(makeDouble(arr->rangeFrom + i));
+            return r;
+        }
+        for (auto *thunk : arr->elements) {
+            force(loc, thunk);
+            r.push_back(thunk->content);
+        }
+        return r;
+    }
+
+    /** The thunk of element i of the array, made now if the array is a range.
+     *
+     * The array must be kept alive by the caller, and so must the thunk before anything else
+     * is allocated.
+     */
+    HeapThunk *arrayElement(const HeapArray *arr, size_t i)
+    {
+        if (!arr->isRange) return arr->elements[i];
+        auto *th = makeHeap<HeapThunk>(idArrayElement, nullptr, 0, nullptr);
+        th->fill(makeDouble(arr->rangeFrom + i));
+        return th;
+    }
+
+    /** Give a range a thunk for each of its elements, so that it is like any other array.
+     *
+     * The array must be kept alive by the caller.  This can trigger a garbage collection cycle.
+     */
+    void materialize(HeapArray *arr)
+    {
+        if (!arr->isRange) return;
+        // The thunks made so far are marked through arr->elements.
+        arr->elements.reserve(arr->rangeLength);
+        for (size_t i = arr->elements.size() ; i < arr->rangeLength ; ++i)
+            arr->elements.push_back(arrayElement(arr, i));
+        arr->isRange = false;
+    }
+
+    /** Evaluate the thunk if it has not been already.
+     *
+     * The thunk must be kept alive by the caller.
+     */
+    void force(const LocationRange &loc, HeapThunk *thunk)
+    {
+        if (thunk->filled) return;
+        stack.newCall(loc, thunk, thunk->self, thunk->offset, thunk->upValues);
+        evaluate(thunk->body, stack.size());
+        stack.pop();
+        thunk->fill(scratch);
+        stats.thunksForced++;
+    }
+
+    /** Make a thunk that evaluates obj[f] when forced, without evaluating it now.
+     *
+     * The object must be kept alive by the caller.
+     */
+    HeapThunk *makeFieldThunk(HeapObject *obj, const Identifier *f)
+    {
+        unsigned found_at = 0;
+        HeapObject *self = nullptr;
+        HeapLeafObject *found = findObject(f, obj, obj, 0, found_at, self);
+        if (auto *simp = dynamic_cast<HeapSimpleObject*>(found)) {
+            auto *th = makeHeap<HeapThunk>(f, self, found_at, simp->fields.find(f)->second.body);
+            th->upValues = simp->upValues;
+            return th;
+        } else {
+            // If a HeapLeafObject is not HeapSimpleObject, it must be HeapComprehensionObject.
+            auto *comp = static_cast<HeapComprehensionObject*>(found);
+            auto *th = makeHeap<HeapThunk>(f, self, found_at, comp->value);
+            th->upValues = comp->upValues;
+            th->upValues[comp->id] = comp->compValues.find(f)->second;
+            return th;
+        }
+    }
+
+    /** Apply patch to target as described by RFC 7386, for std.mergePatch, into scratch.
+     *
+     * As in the Jsonnet implementation this replaced, the visible fields of the patch are
+     * forced, since they are compared with null, but nothing else is.  Fields only taken from
+     * the target are left unevaluated, and fields whose patch is an object are only merged
+     * with the target's field once they are used.  The fields of the result are held in
+     * thunks of an object like those imported from JSON.
+     *
+     * This can trigger a garbage collection cycle.
+     */
+    void mergePatch(const LocationRange &loc, const Value &target, const Value &patch)
+    {
+        if (patch.t != Value::OBJECT) {
+            scratch = patch;
+            return;
+        }
+        // Keeps the arguments, and the fields of the result so far, alive.  It is back on top
+        // of the stack whenever fields are added.
+        stack.newFrame(FRAME_BUILTIN_MERGE_PATCH, loc);
+        stack.top().val = target;
+        stack.top().val2 = patch;
+        auto *patch_obj = static_cast<HeapObject*>(patch.v.h);
+        if (target.t == Value::OBJECT) {
+            auto *target_obj = static_cast<HeapObject*>(target.v.h);
+            for (const auto *f : objectFields(target_obj, true)) {
+                // Allocate before inserting, since a null entry must not be seen by the GC.
+                HeapThunk *th = makeFieldThunk(target_obj, f);
+                stack.top().elements[f] = th;
+            }
+        }
+        for (const auto *f : objectFields(patch_obj, true)) {
+            // pushes FRAME_CALL
+            const AST *body = objectIndex(loc, patch_obj, f, 0);
+            evaluate(body, stack.size());
+            stack.pop();
+            if (scratch.t == Value::NULL_TYPE) {
+                stack.top().elements.erase(f);
+                continue;
+            }
+            auto *th = makeHeap<HeapThunk>(f, nullptr, 0, nullptr);
+            th->fill(scratch);
+            if (scratch.t == Value::OBJECT) {
+                stack.top().thunks.push_back(th);
+                HeapThunk *field_target;
+                auto it = stack.top().elements.find(f);
+                if (it != stack.top().elements.end()) {
+                    field_target = it->second;
+                } else {
+                    field_target = makeHeap<HeapThunk>(f, nullptr, 0, nullptr);
+                    field_target->fill(makeNull());
+                    stack.top().thunks.push_back(field_target);
+                }
+                auto *merged = makeHeap<HeapThunk>(f, nullptr, 0, mergePatchFieldBody);
+                merged->upValues[idMergeTarget] = field_target;
+                merged->upValues[idMergePatch] = th;
+                th = merged;
+            }
+            stack.top().elements[f] = th;
+        }
+        scratch = makeObject<HeapComprehensionObject>(BindingFrame{}, jsonFieldBody, idJsonField,
+                                                      stack.top().elements);
+        stack.pop();
+    }
+
     /** Evaluate the given AST to a value.
      *
      * Rather than call itself recursively, this function maintains a separate stack of
@@ -971,16 +1708,21 @@ class Interpreter {
 
             case AST_IMPORT: {
                 const auto &ast = *static_cast<const Import*>(ast_);
-                AST *expr = import(ast.location, ast.file);
-                ast_ = expr;
-                stack.newCall(ast.location, nullptr, nullptr, 0, BindingFrame());
+                ImportCacheValue *input = importString(ast.location, ast.file);
+                if (importJson(input)) {
+                    scratch = input->json;
+                    break;
+                }
+                ast_ = import(input);
+                stack.newCall(ast.location, nullptr, nullptr, 0, BindingFrame{{idStd, stdThunk}});
                 goto recurse;
             } break;
 
             case AST_IMPORTSTR: {
                 const auto &ast = *static_cast<const Importstr*>(ast_);
                 const ImportCacheValue *value = importString(ast.location, ast.file);
-                scratch = makeString(decode_utf8(value->content));
+                const JsonnetImportBuffer &buf = *value->content;
+                scratch = makeString(decode_utf8(buf.data, buf.length));
             } break;
 
             case AST_INDEX: {
@@ -1025,7 +1767,7 @@ class Interpreter {
 
             case AST_LITERAL_STRING: {
                 const auto &ast = *static_cast<const LiteralString*>(ast_);
-                scratch = makeString(ast.value);
+                scratch = makeCachedString(literalStrings[&ast], ast.value);
             } break;
 
             case AST_LITERAL_NULL: {
@@ -1086,6 +1828,7 @@ class Interpreter {
                     std::abort();
                 }
                 if (thunk->filled) {
+                    stats.thunksReused++;
                     scratch = thunk->content;
                 } else {
                     stack.newCall(ast.location, thunk, thunk->self, thunk->offset, thunk->upValues);
@@ -1233,12 +1976,9 @@ class Interpreter {
                         if (ast.op == BOP_PLUS) {
                             auto *arr_l = static_cast<HeapArray*>(lhs.v.h);
                             auto *arr_r = static_cast<HeapArray*>(rhs.v.h);
-                            std::vector<HeapThunk*> elements;
-                            for (auto *el : arr_l->elements)
-                                elements.push_back(el);
-                            for (auto *el : arr_r->elements)
-                                elements.push_back(el);
-                            scratch = makeArray(elements);
+                            materialize(arr_l);
+                            materialize(arr_r);
+                            scratch = makeArray(arr_l->elements.concat(arr_r->elements));
                         } else {
                             throw makeError(ast.location,
                                             "Binary operator " + bop_string(ast.op)
@@ -1403,13 +2143,13 @@ class Interpreter {
                                         "filter function must return boolean, got: "
                                         + type_str(scratch));
                     }
-                    if (scratch.v.b) f.thunks.push_back(arr->elements[f.elementId]);
+                    if (scratch.v.b) f.thunks.push_back(arrayElement(arr, f.elementId));
                     f.elementId++;
                     // Iterate through arr, calling the function on each.
-                    if (f.elementId == arr->elements.size()) {
+                    if (f.elementId == arr->size()) {
                         scratch = makeArray(f.thunks);
                     } else {
-                        auto *thunk = arr->elements[f.elementId];
+                        auto *thunk = arrayElement(arr, f.elementId);
                         BindingFrame bindings = func->upValues;
                         bindings[func->params[0]] = thunk;
                         stack.newCall(ast.location, func, func->self, func->offset, bindings);
@@ -1429,6 +2169,10 @@ class Interpreter {
                         for (auto *th : f.thunks) {
                             args.push_back(th->content);
                         }
+                        if (!func->nativeName.empty()) {
+                            scratch = callNative(loc, func->nativeName, args);
+                            break;
+                        }
                         switch (builtin) {
                             case 0: { // makeArray
                                 validateBuiltinArgs(loc, builtin, args,
@@ -1518,31 +2262,31 @@ class Interpreter {
                             case 11: {  // type
                                 switch (args[0].t) {
                                     case Value::NULL_TYPE:
-                                    scratch = makeString(U"null");
+                                    scratch = makeCachedString(typeNames[args[0].t], U"null");
                                     break;
 
                                     case Value::BOOLEAN:
-                                    scratch = makeString(U"boolean");
+                                    scratch = makeCachedString(typeNames[args[0].t], U"boolean");
                                     break;
 
                                     case Value::DOUBLE:
-                                    scratch = makeString(U"number");
+                                    scratch = makeCachedString(typeNames[args[0].t], U"number");
                                     break;
 
                                     case Value::ARRAY:
-                                    scratch = makeString(U"array");
+                                    scratch = makeCachedString(typeNames[args[0].t], U"array");
                                     break;
 
                                     case Value::FUNCTION:
-                                    scratch = makeString(U"function");
+                                    scratch = makeCachedString(typeNames[args[0].t], U"function");
                                     break;
 
                                     case Value::OBJECT:
-                                    scratch = makeString(U"object");
+                                    scratch = makeCachedString(typeNames[args[0].t], U"object");
                                     break;
 
                                     case Value::STRING:
-                                    scratch = makeString(U"string");
+                                    scratch = makeCachedString(typeNames[args[0].t], U"string");
                                     break;
 
                                 }
@@ -1557,7 +2301,7 @@ class Interpreter {
                                 if (func->params.size() != 1) {
                                     throw makeError(loc, "filter function takes 1 parameter.");
                                 }
-                                if (arr->elements.size() == 0) {
+                                if (arr->size() == 0) {
                                     scratch = makeArray({});
                                 } else {
                                     f.kind = FRAME_BUILTIN_FILTER;
@@ -1566,7 +2310,7 @@ class Interpreter {
                                     f.thunks.clear();
                                     f.elementId = 0;
 
-                                    auto *thunk = arr->elements[f.elementId];
+                                    auto *thunk = arrayElement(arr, f.elementId);
                                     BindingFrame bindings = func->upValues;
                                     bindings[func->params[0]] = thunk;
                                     stack.newCall(loc, func, func->self, func->offset, bindings);
@@ -1605,8 +2349,7 @@ class Interpreter {
                                     } break;
 
                                     case Value::ARRAY:
-                                    scratch = makeDouble(static_cast<HeapArray*>(e)
-                                                         ->elements.size());
+                                    scratch = makeDouble(static_cast<HeapArray*>(e)->size());
                                     break;
 
                                     case Value::STRING:
@@ -1673,8 +2416,7 @@ class Interpreter {
                                     ss << "Invalid unicode codepoint, got " << l;
                                     throw makeError(ast.location, ss.str());
                                 }
-                                char32_t c = l;
-                                scratch = makeString(String(&c, 1));
+                                scratch = makeChar(l);
                             } break;
 
                             case 18: {  // log
@@ -1724,12 +2466,15 @@ class Interpreter {
                                 const VmExt &ext = it->second;
                                 if (ext.isCode) {
                                     std::string filename = "<extvar:" + var8 + ">";
-                                    Tokens tokens = jsonnet_lex(filename, ext.data.c_str());
+                                    Tokens tokens =
+                                        jsonnet_lex(filename, ext.data.c_str(), false);
                                     AST *expr = jsonnet_parse(alloc, tokens);
                                     jsonnet_desugar(alloc, expr);
                                     jsonnet_static_analysis(expr);
                                     ast_ = expr;
                                     stack.pop();
+                                    stack.newCall(ast.location, nullptr, nullptr, 0,
+                                                  BindingFrame{{idStd, stdThunk}});
                                     goto recurse;
                                 } else {
                                     scratch = makeString(decode_utf8(ext.data));
@@ -1775,6 +2520,282 @@ class Interpreter {
                                 scratch = makeBoolean(r);
                             } break;
 
+                            case 25: {  // native
+                                validateBuiltinArgs(loc, builtin, args, {Value::STRING});
+                                std::string name =
+                                    encode_utf8(static_cast<HeapString*>(args[0].v.h)->value);
+                                auto it = nativeCallbacks.find(name);
+                                if (it == nativeCallbacks.end()) {
+                                    scratch = makeNull();
+                                } else {
+                                    scratch = makeNativeBuiltin(name, it->second.params);
+                                }
+                            } break;
+
+                            case 26: {  // md5
+                                validateBuiltinArgs(loc, builtin, args, {Value::STRING});
+                                const String &str =
+                                    static_cast<HeapString*>(args[0].v.h)->value;
+                                scratch = makeString(decode_utf8(jsonnet_md5(encode_utf8(str))));
+                            } break;
+
+                            case 27: {  // sha256
+                                validateBuiltinArgs(loc, builtin, args, {Value::STRING});
+                                const String &str =
+                                    static_cast<HeapString*>(args[0].v.h)->value;
+                                scratch =
+                                    makeString(decode_utf8(jsonnet_sha256(encode_utf8(str))));
+                            } break;
+
+                            case 28: {  // base64
+                                const char *msg =
+                                    "Can only base64 encode strings / arrays of single bytes.";
+                                std::string bytes;
+                                if (args.size() == 1 && args[0].t == Value::STRING) {
+                                    const String &str =
+                                        static_cast<HeapString*>(args[0].v.h)->value;
+                                    bytes.reserve(str.length());
+                                    for (char32_t c : str) {
+                                        if (c >= 256) throw makeError(loc, msg);
+                                        bytes += char(c);
+                                    }
+                                } else {
+                                    validateBuiltinArgs(loc, builtin, args, {Value::ARRAY});
+                                    auto *arr = static_cast<HeapArray*>(args[0].v.h);
+                                    for (const Value &v : forceElements(loc, arr)) {
+                                        if (v.t != Value::DOUBLE || v.v.d < 0 || v.v.d >= 256)
+                                            throw makeError(loc, msg);
+                                        bytes += char(v.v.d);
+                                    }
+                                }
+                                scratch = makeString(decode_utf8(jsonnet_base64_encode(bytes)));
+                            } break;
+
+                            case 29:  // base64DecodeBytes
+                            case 30: {  // base64Decode
+                                validateBuiltinArgs(loc, builtin, args, {Value::STRING});
+                                const String &str =
+                                    static_cast<HeapString*>(args[0].v.h)->value;
+                                std::string bytes;
+                                if (!jsonnet_base64_decode(encode_utf8(str), bytes)) {
+                                    throw makeError(loc, "Not a base64 encoded string \""
+                                                         + encode_utf8(str) + "\"");
+                                }
+                                if (builtin == 30) {
+                                    String r;
+                                    r.reserve(bytes.length());
+                                    for (unsigned char b : bytes)
+                                        r += char32_t(b);
+                                    scratch = makeString(r);
+                                    break;
+                                }
+                                scratch = makeArray({});
+                                auto &elements = static_cast<HeapArray*>(scratch.v.h)->elements;
+                                elements.reserve(bytes.length());
+                                for (unsigned char b : bytes) {
+                                    auto *th = makeHeap<HeapThunk>(idArrayElement, nullptr,
+                                                                   0, nullptr);
+                                    elements.push_back(th);
+                                    th->fill(makeDouble(b));
+                                }
+                            } break;
+
+                            case 31: {  // escapeStringJson
+                                if (args[0].t != Value::STRING) {
+                                    // Like std.toString.
+                                    scratch = args[0];
+                                    scratch = makeString(jsonnet_string_unparse(toString(loc),
+                                                                                false, true));
+                                    break;
+                                }
+                                validateBuiltinArgs(loc, builtin, args, {Value::STRING});
+                                const String &str =
+                                    static_cast<HeapString*>(args[0].v.h)->value;
+                                scratch = makeString(jsonnet_string_unparse(str, false, true));
+                            } break;
+
+                            case 32: {  // manifestJsonEx
+                                // The value can be of any type.
+                                validateBuiltinArgs(loc, builtin, args,
+                                                    {args[0].t, Value::STRING});
+                                const String &indent =
+                                    static_cast<HeapString*>(args[1].v.h)->value;
+                                JsonWriter writer(true, indent);
+                                scratch = args[0];
+                                manifest(loc, writer);
+                                scratch = makeString(writer.str());
+                            } break;
+
+                            case BUILTIN_MERGE_PATCH: {
+                                mergePatch(loc, args[0], args[1]);
+                            } break;
+
+                            case 34: {  // splitLimit
+                                validateBuiltinArgs(loc, builtin, args,
+                                                    {Value::STRING, Value::STRING,
+                                                     Value::DOUBLE});
+                                const String &str =
+                                    static_cast<HeapString*>(args[0].v.h)->value;
+                                const String &c = static_cast<HeapString*>(args[1].v.h)->value;
+                                if (c.length() != 1) {
+                                    std::stringstream ss;
+                                    ss << "std.splitLimit second parameter should have length 1, "
+                                       << "got " << c.length();
+                                    throw makeError(loc, ss.str());
+                                }
+                                // Only -1 means unlimited, other negative limits never split.
+                                double maxsplits = args[2].v.d;
+                                scratch = makeArray({});
+                                auto &elements = static_cast<HeapArray*>(scratch.v.h)->elements;
+                                size_t begin = 0;
+                                while (true) {
+                                    size_t end = String::npos;
+                                    if (maxsplits == -1 || elements.size() < maxsplits)
+                                        end = str.find(c[0], begin);
+                                    auto *th = makeHeap<HeapThunk>(idArrayElement, nullptr,
+                                                                   0, nullptr);
+                                    elements.push_back(th);
+                                    th->fill(makeString(str.substr(begin, end - begin)));
+                                    if (end == String::npos) break;
+                                    begin = end + 1;
+                                }
+                            } break;
+
+                            case 35: {  // findSubstr
+                                validateBuiltinArgs(loc, builtin, args,
+                                                    {Value::STRING, Value::STRING});
+                                const String &pat =
+                                    static_cast<HeapString*>(args[0].v.h)->value;
+                                const String &str =
+                                    static_cast<HeapString*>(args[1].v.h)->value;
+                                scratch = makeArray({});
+                                auto &elements = static_cast<HeapArray*>(scratch.v.h)->elements;
+                                if (pat.length() == 0) break;
+                                // Overlapping occurrences are all reported.
+                                for (size_t i = str.find(pat) ; i != String::npos ;
+                                     i = str.find(pat, i + 1)) {
+                                    auto *th = makeHeap<HeapThunk>(idArrayElement, nullptr,
+                                                                   0, nullptr);
+                                    elements.push_back(th);
+                                    th->fill(makeDouble(i));
+                                }
+                            } break;
+
+                            case 36: {  // strReplace
+                                validateBuiltinArgs(loc, builtin, args,
+                                                    {Value::STRING, Value::STRING,
+                                                     Value::STRING});
+                                const String &str =
+                                    static_cast<HeapString*>(args[0].v.h)->value;
+                                const String &from =
+                                    static_cast<HeapString*>(args[1].v.h)->value;
+                                const String &to = static_cast<HeapString*>(args[2].v.h)->value;
+                                if (from.length() == 0)
+                                    throw makeError(loc, "'from' string must not be zero length.");
+                                String r;
+                                size_t begin = 0;
+                                for (size_t i = str.find(from) ; i != String::npos ;
+                                     i = str.find(from, begin)) {
+                                    r.append(str, begin, i - begin);
+                                    r.append(to);
+                                    begin = i + from.length();
+                                }
+                                r.append(str, begin, String::npos);
+                                scratch = makeString(r);
+                            } break;
+
+                            case 37: {  // slice
+                                // Checked in the same order as std.jsonnet used to.
+                                const Value &indexable = args[0];
+                                for (unsigned i = 1 ; i < 4 ; ++i) {
+                                    if (args[i].t != Value::NULL_TYPE
+                                        && args[i].t != Value::DOUBLE) {
+                                        validateBuiltinArgs(loc, builtin, args,
+                                                            {indexable.t, Value::DOUBLE,
+                                                             Value::DOUBLE, Value::DOUBLE});
+                                    }
+                                }
+                                bool negative = false;
+                                for (unsigned i = 1 ; i < 4 ; ++i)
+                                    negative |= args[i].t == Value::DOUBLE && args[i].v.d < 0;
+                                if (negative) {
+                                    std::stringstream ss;
+                                    ss << "got [";
+                                    const char *prefix = "";
+                                    for (unsigned i = 1 ; i < 4 ; ++i) {
+                                        ss << prefix;
+                                        if (args[i].t == Value::NULL_TYPE) {
+                                            ss << "null";
+                                        } else {
+                                            scratch = args[i];
+                                            ss << encode_utf8(toString(loc));
+                                        }
+                                        prefix = ":";
+                                    }
+                                    ss << "] but negative index, end, and steps are not "
+                                       << "supported";
+                                    throw makeError(loc, ss.str());
+                                }
+                                if (indexable.t != Value::STRING && indexable.t != Value::ARRAY) {
+                                    throw makeError(loc, "std.slice accepts a string or an array, "
+                                                         "but got: " + std_type_str(indexable));
+                                }
+                                if (args[3].t == Value::DOUBLE && args[3].v.d == 0)
+                                    throw makeError(loc, "std.slice step must be greater than 0");
+                                const HeapString *str = nullptr;
+                                const HeapArray *arr = nullptr;
+                                size_t length;
+                                if (indexable.t == Value::STRING) {
+                                    str = static_cast<const HeapString*>(indexable.v.h);
+                                    length = str->value.length();
+                                } else {
+                                    arr = static_cast<const HeapArray*>(indexable.v.h);
+                                    length = arr->size();
+                                }
+                                double index = args[1].t == Value::NULL_TYPE ? 0 : args[1].v.d;
+                                double end = args[2].t == Value::NULL_TYPE ? length : args[2].v.d;
+                                double step = args[3].t == Value::NULL_TYPE ? 1 : args[3].v.d;
+                                end = std::min(end, double(length));
+                                if (step == 1 && index == std::floor(index)) {
+                                    // A contiguous slice, which is viewed rather than copied.
+                                    size_t from = std::min(index, end);
+                                    size_t len = std::max(std::ceil(end - index), 0.0);
+                                    if (str != nullptr)
+                                        scratch = makeString(str->value.substr(from, len));
+                                    else if (arr->isRange)
+                                        scratch = makeRange(arr->rangeFrom + from, len);
+                                    else
+                                        scratch = makeArray(arr->elements.slice(from, len));
+                                    break;
+                                }
+                                if (str != nullptr) {
+                                    String r;
+                                    for (double cur = index ; cur < end ; cur += step)
+                                        r += str->value[size_t(cur)];
+                                    scratch = makeString(r);
+                                    break;
+                                }
+                                scratch = makeArray({});
+                                auto *r = static_cast<HeapArray*>(scratch.v.h);
+                                for (double cur = index ; cur < end ; cur += step) {
+                                    // Added one at a time, since arrayElement can allocate.
+                                    HeapThunk *th = arrayElement(arr, size_t(cur));
+                                    r->elements.push_back(th);
+                                }
+                            } break;
+
+                            case 38: {  // range
+                                validateBuiltinArgs(loc, builtin, args,
+                                                    {Value::DOUBLE, Value::DOUBLE});
+                                long sz = long(args[1].v.d - args[0].v.d + 1);
+                                if (sz < 0) {
+                                    std::stringstream ss;
+                                    ss << "makeArray requires size >= 0, got " << sz;
+                                    throw makeError(loc, ss.str());
+                                }
+                                scratch = makeRange(args[0].v.d, sz);
+                            } break;
+
                             default:
                             std::cerr << "INTERNAL ERROR: Unrecognized builtin: " << builtin
                                       << std::endl;
@@ -1795,6 +2816,7 @@ class Interpreter {
                     if (auto *thunk = dynamic_cast<HeapThunk*>(f.context)) {
                         // If we called a thunk, cache result.
                         thunk->fill(scratch);
+                        stats.thunksForced++;
                     } else if (auto *closure = dynamic_cast<HeapClosure*>(f.context)) {
                         if (f.elementId < f.thunks.size()) {
                             // If tailstrict, force thunks
@@ -1872,15 +2894,20 @@ class Interpreter {
                                                           + type_str(scratch) + ".");
                         }
                         long i = long(scratch.v.d);
-                        long sz = array->elements.size();
+                        long sz = array->size();
                         if (i < 0 || i >= sz) {
                             std::stringstream ss;
                             ss << "Array bounds error: " << i
                                << " not within [0, " << sz << ")";
                             throw makeError(ast.location, ss.str());
                         }
+                        if (array->isRange) {
+                            scratch = makeDouble(array->rangeFrom + i);
+                            break;
+                        }
                         auto *thunk = array->elements[i];
                         if (thunk->filled) {
+                            stats.thunksReused++;
                             scratch = thunk->content;
                         } else {
                             stack.pop();
@@ -1919,8 +2946,7 @@ class Interpreter {
                                << " not within [0, " << sz << ")";
                             throw makeError(ast.location, ss.str());
                         }
-                        char32_t ch[] = {obj->value[i], U'\0'};
-                        scratch = makeString(ch);
+                        scratch = makeChar(obj->value[i]);
                     } else {
                         std::cerr << "INTERNAL ERROR: Not object / array / string." << std::endl;
                         abort();
@@ -2018,14 +3044,15 @@ class Interpreter {
                                         + type_str(arr_v));
                     }
                     const auto *arr = static_cast<const HeapArray*>(arr_v.v.h);
-                    if (arr->elements.size() == 0) {
+                    if (arr->size() == 0) {
                         // Degenerate case.  Just create the object now.
                         scratch = makeObject<HeapComprehensionObject>(BindingFrame{}, ast.value,
                                                                       ast.id, BindingFrame{});
                     } else {
                         f.kind = FRAME_OBJECT_COMP_ELEMENT;
                         f.val = scratch;
-                        f.bindings[ast.id] = arr->elements[0];
+                        HeapThunk *th = arrayElement(arr, 0);
+                        f.bindings[ast.id] = th;
                         f.elementId = 0;
                         ast_ = ast.field;
                         goto recurse;
@@ -2046,15 +3073,17 @@ class Interpreter {
                         throw makeError(ast.location,
                                         "Duplicate field name: \"" + encode_utf8(fname) + "\"");
                     }
-                    f.elements[fid] = arr->elements[f.elementId];
+                    // The element the field name was evaluated with.
+                    f.elements[fid] = f.bindings[ast.id];
                     f.elementId++;
 
-                    if (f.elementId == arr->elements.size()) {
+                    if (f.elementId == arr->size()) {
                         auto env = capture(ast.freeVariables);
                         scratch = makeObject<HeapComprehensionObject>(env, ast.value,
                                                                       ast.id, f.elements);
                     } else {
-                        f.bindings[ast.id] = arr->elements[f.elementId];
+                        HeapThunk *th = arrayElement(arr, f.elementId);
+                        f.bindings[ast.id] = th;
                         ast_ = ast.field;
                         goto recurse;
                     }
@@ -2134,67 +3163,89 @@ class Interpreter {
         }
     }
 
-    /** Manifest the scratch value by evaluating any remaining fields, and then convert to JSON.
+    /** Evaluate a program given by jsonnet_desugar, leaving the result in the scratch register.
+     *
+     * The frame binding $std is left at the bottom of the stack for the manifestation.
+     */
+    void evaluateFile(const AST *ast)
+    {
+        VmTraceSpan span(trace, JSONNET_TRACE_EVALUATE);
+        auto start = std::chrono::steady_clock::now();
+        stack.newFrame(FRAME_LOCAL, ast);
+        stack.top().bindings[idStd] = stdThunk;
+        evaluate(ast, stack.size());
+        auto end = std::chrono::steady_clock::now();
+        stats.evaluateSeconds += std::chrono::duration<double>(end - start).count();
+    }
+
+    /** Add to the time spent manifesting, see VmStats. */
+    void addManifestSeconds(double seconds)
+    {
+        stats.manifestSeconds += seconds;
+    }
+
+    /** Manifest the scratch value by evaluating any remaining fields, giving it to a visitor.
      *
      * This can trigger a garbage collection cycle.  Be sure to stash any objects that aren't
      * reachable via the stack or heap.
-     *
-     * \param multiline If true, will print objects and arrays in an indented fashion.
      */
-    String manifestJson(const LocationRange &loc, bool multiline, const String &indent)
+    void manifest(const LocationRange &loc, VmVisitor &visitor)
     {
         // Printing fields means evaluating and binding them, which can trigger
         // garbage collection.
 
-        StringStream ss;
         switch (scratch.t) {
             case Value::ARRAY: {
                 HeapArray *arr = static_cast<HeapArray*>(scratch.v.h);
-                if (arr->elements.size() == 0) {
-                    ss << U"[ ]";
-                } else {
-                    const char32_t *prefix = multiline ? U"[\n" : U"[";
-                    String indent2 = multiline ? indent + U"   " : indent;
-                    for (auto *thunk : arr->elements) {
-                        LocationRange tloc = thunk->body == nullptr
-                                           ? loc
-                                           : thunk->body->location;
-                        if (thunk->filled) {
-                            stack.newCall(loc, thunk, nullptr, 0, BindingFrame{});
-                            // Keep arr alive when scratch is overwritten
-                            stack.top().val = scratch;
-                            scratch = thunk->content;
-                        } else {
-                            stack.newCall(loc, thunk, thunk->self, thunk->offset, thunk->upValues);
-                            // Keep arr alive when scratch is overwritten
-                            stack.top().val = scratch;
-                            evaluate(thunk->body, stack.size());
-                        }
-                        auto element = manifestJson(tloc, multiline, indent2);
-                        // Restore scratch
-                        scratch = stack.top().val;
-                        stack.pop();
-                        ss << prefix << indent2 << element;
-                        prefix = multiline ? U",\n" : U", ";
+                visitor.beginArray();
+                if (arr->isRange) {
+                    // Numbers are manifested without allocating, so arr needs no stashing.
+                    Value arr_v = scratch;
+                    for (size_t i = 0 ; i < arr->rangeLength ; ++i) {
+                        scratch = makeDouble(arr->rangeFrom + i);
+                        manifest(loc, visitor);
+                    }
+                    scratch = arr_v;
+                }
+                for (auto *thunk : arr->elements) {
+                    LocationRange tloc = thunk->body == nullptr
+                                       ? loc
+                                       : thunk->body->location;
+                    if (thunk->filled) {
+                        stack.newCall(loc, thunk, nullptr, 0, BindingFrame{});
+                        // Keep arr alive when scratch is overwritten
+                        stack.top().val = scratch;
+                        scratch = thunk->content;
+                        stats.thunksReused++;
+                    } else {
+                        stack.newCall(loc, thunk, thunk->self, thunk->offset, thunk->upValues);
+                        // Keep arr alive when scratch is overwritten
+                        stack.top().val = scratch;
+                        evaluate(thunk->body, stack.size());
+                        stats.thunksForced++;
                     }
-                    ss << (multiline ? U"\n" : U"") << indent << U"]";
+                    manifest(tloc, visitor);
+                    // Restore scratch
+                    scratch = stack.top().val;
+                    stack.pop();
                 }
+                visitor.endArray();
             }
             break;
 
             case Value::BOOLEAN:
-            ss << (scratch.v.b ? U"true" : U"false");
+            visitor.boolean(scratch.v.b);
             break;
 
             case Value::DOUBLE:
-            ss << decode_utf8(jsonnet_unparse_number(scratch.v.d));
+            visitor.number(scratch.v.d);
             break;
 
             case Value::FUNCTION:
             throw makeError(loc, "Couldn't manifest function in JSON output.");
 
             case Value::NULL_TYPE:
-            ss << U"null";
+            visitor.null();
             break;
 
             case Value::OBJECT: {
@@ -2206,36 +3257,39 @@ class Interpreter {
                 for (const auto &f : objectFields(obj, true)) {
                     fields[f->name] = f;
                 }
-                if (fields.size() == 0) {
-                    ss << U"{ }";
-                } else {
-                    String indent2 = multiline ? indent + U"   " : indent;
-                    const char32_t *prefix = multiline ? U"{\n" : U"{";
-                    for (const auto &f : fields) {
-                        // pushes FRAME_CALL
-                        const AST *body = objectIndex(loc, obj, f.second, 0);
-                        stack.top().val = scratch;
-                        evaluate(body, stack.size());
-                        auto vstr = manifestJson(body->location, multiline, indent2);
-                        // Reset scratch so that the object we're manifesting doesn't
-                        // get GC'd.
-                        scratch = stack.top().val;
-                        stack.pop();
-                        ss << prefix << indent2 << U"\"" << f.first << U"\": " << vstr;
-                        prefix = multiline ? U",\n" : U", ";
-                    }
-                    ss << (multiline ? U"\n" : U"") << indent << U"}";
+                visitor.beginObject();
+                for (const auto &f : fields) {
+                    // pushes FRAME_CALL
+                    const AST *body = objectIndex(loc, obj, f.second, 0);
+                    stack.top().val = scratch;
+                    evaluate(body, stack.size());
+                    visitor.field(f.first);
+                    manifest(body->location, visitor);
+                    // Reset scratch so that the object we're manifesting doesn't
+                    // get GC'd.
+                    scratch = stack.top().val;
+                    stack.pop();
                 }
+                visitor.endObject();
             }
             break;
 
             case Value::STRING: {
-                const String &str = static_cast<HeapString*>(scratch.v.h)->value;
-                ss << jsonnet_string_unparse(str, false);
+                visitor.string(static_cast<HeapString*>(scratch.v.h)->value);
             }
             break;
         }
-        return ss.str();
+    }
+
+    /** Manifest the scratch value, and then convert to JSON.
+     *
+     * \param multiline If true, will print objects and arrays in an indented fashion.
+     */
+    String manifestJson(const LocationRange &loc, bool multiline)
+    {
+        JsonWriter writer(multiline);
+        manifest(loc, writer);
+        return writer.str();
     }
 
     String manifestString(const LocationRange &loc)
@@ -2271,7 +3325,7 @@ class Interpreter {
             stack.top().val = scratch;
             evaluate(body, stack.size());
             auto vstr = string ? manifestString(body->location)
-                               : manifestJson(body->location, true, U"");
+                               : manifestJson(body->location, true);
             // Reset scratch so that the object we're manifesting doesn't
             // get GC'd.
             scratch = stack.top().val;
@@ -2293,6 +3347,7 @@ class Interpreter {
             throw makeError(loc, ss.str());
         }
         auto *arr = static_cast<HeapArray*>(scratch.v.h);
+        materialize(arr);
         for (auto *thunk : arr->elements) {
             LocationRange tloc = thunk->body == nullptr
                                ? loc
@@ -2302,13 +3357,15 @@ class Interpreter {
                 // Keep arr alive when scratch is overwritten
                 stack.top().val = scratch;
                 scratch = thunk->content;
+                stats.thunksReused++;
             } else {
                 stack.newCall(loc, thunk, thunk->self, thunk->offset, thunk->upValues);
                 // Keep arr alive when scratch is overwritten
                 stack.top().val = scratch;
                 evaluate(thunk->body, stack.size());
+                stats.thunksForced++;
             }
-            String element = manifestJson(tloc, true, U"");
+            String element = manifestJson(tloc, true);
             scratch = stack.top().val;
             stack.pop();
             r.push_back(encode_utf8(element));
@@ -2320,42 +3377,300 @@ class Interpreter {
 
 }  // namespace
 
-std::string jsonnet_vm_execute(Allocator *alloc, const AST *ast,
-                               const ExtMap &ext_vars,
+/** std.jsonnet, desugared and analysed at build time by std_snapshot. */
+static const unsigned char STD_SNAPSHOT[] = {
+    #include "std.jsonnet.ast.h"
+};
+
+VmSession::VmSession(const VmSession *parent, const std::string &ast_cache_dir)
+  : parent(parent), alloc(parent == nullptr ? nullptr : &parent->alloc),
+    astCacheDir(ast_cache_dir)
+{
+    if (parent != nullptr) {
+        stdlib = parent->stdlib;
+        return;
+    }
+    // Intern $std before any program is parsed with this session, so that they all share it.
+    alloc.makeIdentifier(U"$std");
+    const char *snapshot = reinterpret_cast<const char*>(STD_SNAPSHOT);
+    stdlib = dynamic_cast<DesugaredObject*>(
+        jsonnet_ast_deserialize(&alloc, snapshot, sizeof STD_SNAPSHOT));
+    if (stdlib == nullptr) {
+        std::cerr << "INTERNAL ERROR: Could not load the std.jsonnet snapshot." << std::endl;
+        std::abort();
+    }
+}
+
+/** The time of a monotonic clock, for VmTraceSpan. */
+static double seconds_since_epoch(void)
+{
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+VmTraceSpan::VmTraceSpan(const VmTrace *trace, JsonnetTracePhase phase,
+                         const std::string &detail)
+  : trace(trace), phase(phase), detail(detail)
+{
+    if (trace != nullptr)
+        trace->callback(trace->ctx, phase, 1, detail.c_str(), seconds_since_epoch());
+}
+
+VmTraceSpan::~VmTraceSpan(void)
+{
+    if (trace != nullptr)
+        trace->callback(trace->ctx, phase, 0, detail.c_str(), seconds_since_epoch());
+}
+
+AST *VmSession::parse(Allocator *alloc, const std::string &filename,
+                      const char *content, size_t length, const VmTrace *trace) const
+{
+    if (!astCacheDir.empty()) {
+        AST *cached = jsonnet_ast_cache_load(alloc, astCacheDir, filename, content, length);
+        if (cached != nullptr) return cached;
+    }
+    Tokens tokens;
+    AST *expr;
+    {
+        VmTraceSpan span(trace, JSONNET_TRACE_LEX, filename);
+        tokens = jsonnet_lex(filename, content, false);
+    }
+    {
+        VmTraceSpan span(trace, JSONNET_TRACE_PARSE, filename);
+        expr = jsonnet_parse(alloc, tokens);
+    }
+    {
+        VmTraceSpan span(trace, JSONNET_TRACE_DESUGAR, filename);
+        jsonnet_desugar(alloc, expr);
+    }
+    {
+        VmTraceSpan span(trace, JSONNET_TRACE_ANALYSIS, filename);
+        jsonnet_static_analysis(expr);
+    }
+    if (!astCacheDir.empty())
+        jsonnet_ast_cache_save(astCacheDir, filename, content, length, expr);
+    return expr;
+}
+
+static void release_import_buffer(const JsonnetImportBuffer *buf)
+{
+    if (buf->release != nullptr)
+        buf->release(buf->release_ctx);
+    delete buf;
+}
+
+VmImportBuffer jsonnet_vm_import_buffer(const JsonnetImportBuffer &buf)
+{
+    return VmImportBuffer(new JsonnetImportBuffer(buf), release_import_buffer);
+}
+
+AST *VmSession::findImport(const std::string &found_here, const VmImportBuffer &content) const
+{
+    auto it = imports.find(found_here);
+    if (it != imports.end()) {
+        // The bytes are always compared, even if the callback lent the same memory again.
+        const JsonnetImportBuffer &a = *it->second.content;
+        const JsonnetImportBuffer &b = *content;
+        if (a.length == b.length && std::memcmp(a.data, b.data, a.length) == 0)
+            return it->second.expr;
+    }
+    if (parent != nullptr)
+        return parent->findImport(found_here, content);
+    return nullptr;
+}
+
+void VmProfile::merge(const VmProfile &other)
+{
+    for (const auto &pair : other.stacks) {
+        Entry &entry = stacks[pair.first];
+        entry.calls += pair.second.calls;
+        entry.selfSeconds += pair.second.selfSeconds;
+        entry.selfAllocations += pair.second.selfAllocations;
+    }
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void VmStats::merge(const VmStats &other)
+{
+    for (const auto &pair : other.entities) {
+        Entities &e = entities[pair.first];
+        e.allocations += pair.second.allocations;
+        e.bytes += pair.second.bytes;
+    }
+    evaluations += other.evaluations;
+    gcCycles += other.gcCycles;
+    gcMarkSeconds += other.gcMarkSeconds;
+    gcSweepSeconds += other.gcSweepSeconds;
+    peakEntities = std::max(peakEntities, other.peakEntities);
+    thunksForced += other.thunksForced;
+    thunksReused += other.thunksReused;
+    evaluateSeconds += other.evaluateSeconds;
+    manifestSeconds += other.manifestSeconds;
+}
+
+std::string VmStats::toJson(void) const
+{
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(6);
+    ss << "{\n";
+    ss << "   \"entities\": {";
+    const char *prefix = "\n";
+    for (const auto &pair : entities) {
+        ss << prefix << "      \"" << pair.first << "\": { \"allocations\": "
+           << pair.second.allocations << ", \"bytes\": " << pair.second.bytes << " }";
+        prefix = ",\n";
+    }
+    ss << "\n   },\n";
+    ss << "   \"evaluations\": " << evaluations << ",\n";
+    ss << "   \"gc_cycles\": " << gcCycles << ",\n";
+    ss << "   \"gc_mark_seconds\": " << gcMarkSeconds << ",\n";
+    ss << "   \"gc_sweep_seconds\": " << gcSweepSeconds << ",\n";
+    ss << "   \"peak_entities\": " << peakEntities << ",\n";
+    ss << "   \"thunks_forced\": " << thunksForced << ",\n";
+    ss << "   \"thunks_reused\": " << thunksReused << ",\n";
+    ss << "   \"evaluate_seconds\": " << evaluateSeconds << ",\n";
+    ss << "   \"manifest_seconds\": " << manifestSeconds << "\n";
+    ss << "}\n";
+    return ss.str();
+}
+
+std::string VmProfile::flatReport(void) const
+{
+    struct Line {
+        std::string name;
+        Entry self;
+        double totalSeconds;
+        unsigned long totalAllocations;
+        Line(void) : totalSeconds(0), totalAllocations(0) { }
+    };
+    std::map<std::string, Line> lines;
+    for (const auto &pair : stacks) {
+        const std::vector<std::string> &names = pair.first;
+        const Entry &entry = pair.second;
+        Line &line = lines[names.back()];
+        line.name = names.back();
+        line.self.calls += entry.calls;
+        line.self.selfSeconds += entry.selfSeconds;
+        line.self.selfAllocations += entry.selfAllocations;
+        // A frame's total includes the frames it called, but recursive calls count only once.
+        std::set<std::string> seen(names.begin(), names.end());
+        for (const auto &name : seen) {
+            lines[name].totalSeconds += entry.selfSeconds;
+            lines[name].totalAllocations += entry.selfAllocations;
+        }
+    }
+
+    std::vector<const Line*> sorted;
+    for (const auto &pair : lines)
+        sorted.push_back(&pair.second);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Line *a, const Line *b) {
+        return a->self.selfSeconds > b->self.selfSeconds;
+    });
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << std::setw(10) << "self ms" << std::setw(10) << "total ms" << std::setw(10) << "calls"
+       << std::setw(12) << "self allocs" << std::setw(13) << "total allocs" << "  frame\n";
+    for (const Line *line : sorted) {
+        ss << std::setw(10) << line->self.selfSeconds * 1000
+           << std::setw(10) << line->totalSeconds * 1000
+           << std::setw(10) << line->self.calls
+           << std::setw(12) << line->self.selfAllocations
+           << std::setw(13) << line->totalAllocations
+           << "  " << line->name << "\n";
+    }
+    return ss.str();
+}
+
+std::string VmProfile::foldedReport(void) const
+{
+    std::stringstream ss;
+    for (const auto &pair : stacks) {
+        const char *prefix = "";
+        for (const auto &name : pair.first) {
+            ss << prefix << name;
+            prefix = ";";
+        }
+        ss << " " << (unsigned long)(pair.second.selfSeconds * 1e6 + 0.5) << "\n";
+    }
+    return ss.str();
+}
+
+std::string jsonnet_vm_execute(VmSession *session, Allocator *alloc, const AST *ast,
+                               const ExtMap &ext_vars, const VmNativeCallbackMap &natives,
                                unsigned max_stack, double gc_min_objects,
                                double gc_growth_trigger,
-                               JsonnetImportCallback *import_callback, void *ctx,
-                               bool string_output)
+                               JsonnetImportBufferCallback *import_callback, void *ctx,
+                               bool string_output, VmProfile *profile, VmStats *stats,
+                               const VmTrace *trace)
 {
-    Interpreter vm(alloc, ext_vars, max_stack, gc_min_objects, gc_growth_trigger,
-                   import_callback, ctx);
-    vm.evaluate(ast, 0);
+    Interpreter vm(session, alloc, ext_vars, natives, max_stack, gc_min_objects, gc_growth_trigger,
+                   import_callback, ctx, profile, stats, trace);
+    vm.evaluateFile(ast);
+    VmTraceSpan span(trace, JSONNET_TRACE_MANIFEST);
+    auto start = std::chrono::steady_clock::now();
+    std::string r;
     if (string_output) {
-        return encode_utf8(vm.manifestString(LocationRange("During manifestation")));
+        r = encode_utf8(vm.manifestString(LocationRange("During manifestation")));
     } else {
-        return encode_utf8(vm.manifestJson(LocationRange("During manifestation"), true, U""));
+        r = encode_utf8(vm.manifestJson(LocationRange("During manifestation"), true));
     }
+    vm.addManifestSeconds(seconds_since(start));
+    return r;
 }
 
-StrMap jsonnet_vm_execute_multi(Allocator *alloc, const AST *ast, const ExtMap &ext_vars,
-                                unsigned max_stack, double gc_min_objects, double gc_growth_trigger,
-                                JsonnetImportCallback *import_callback, void *ctx,
-                                bool string_output)
+StrMap jsonnet_vm_execute_multi(VmSession *session, Allocator *alloc, const AST *ast,
+                                const ExtMap &ext_vars, const VmNativeCallbackMap &natives,
+                                unsigned max_stack, double gc_min_objects,
+                                double gc_growth_trigger,
+                                JsonnetImportBufferCallback *import_callback, void *ctx,
+                                bool string_output, VmProfile *profile, VmStats *stats,
+                                const VmTrace *trace)
 {
-    Interpreter vm(alloc, ext_vars, max_stack, gc_min_objects, gc_growth_trigger,
-                   import_callback, ctx);
-    vm.evaluate(ast, 0);
-    return vm.manifestMulti(string_output);
+    Interpreter vm(session, alloc, ext_vars, natives, max_stack, gc_min_objects, gc_growth_trigger,
+                   import_callback, ctx, profile, stats, trace);
+    vm.evaluateFile(ast);
+    VmTraceSpan span(trace, JSONNET_TRACE_MANIFEST);
+    auto start = std::chrono::steady_clock::now();
+    StrMap r = vm.manifestMulti(string_output);
+    vm.addManifestSeconds(seconds_since(start));
+    return r;
 }
 
 std::vector<std::string> jsonnet_vm_execute_stream(
-  Allocator *alloc, const AST *ast, const ExtMap &ext_vars, unsigned max_stack,
-  double gc_min_objects, double gc_growth_trigger, JsonnetImportCallback *import_callback,
-  void *ctx)
+  VmSession *session, Allocator *alloc, const AST *ast, const ExtMap &ext_vars,
+  const VmNativeCallbackMap &natives, unsigned max_stack, double gc_min_objects,
+  double gc_growth_trigger,
+  JsonnetImportBufferCallback *import_callback, void *ctx, VmProfile *profile, VmStats *stats,
+  const VmTrace *trace)
 {
-    Interpreter vm(alloc, ext_vars, max_stack, gc_min_objects, gc_growth_trigger,
-                   import_callback, ctx);
-    vm.evaluate(ast, 0);
-    return vm.manifestStream();
+    Interpreter vm(session, alloc, ext_vars, natives, max_stack, gc_min_objects, gc_growth_trigger,
+                   import_callback, ctx, profile, stats, trace);
+    vm.evaluateFile(ast);
+    VmTraceSpan span(trace, JSONNET_TRACE_MANIFEST);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::string> r = vm.manifestStream();
+    vm.addManifestSeconds(seconds_since(start));
+    return r;
 }
 
+
+void jsonnet_vm_execute_visit(
+  VmSession *session, Allocator *alloc, const AST *ast, const ExtMap &ext_vars,
+  const VmNativeCallbackMap &natives, unsigned max_stack, double gc_min_objects,
+  double gc_growth_trigger,
+  JsonnetImportBufferCallback *import_callback, void *ctx, VmVisitor &visitor,
+  VmProfile *profile, VmStats *stats, const VmTrace *trace)
+{
+    Interpreter vm(session, alloc, ext_vars, natives, max_stack, gc_min_objects, gc_growth_trigger,
+                   import_callback, ctx, profile, stats, trace);
+    vm.evaluateFile(ast);
+    VmTraceSpan span(trace, JSONNET_TRACE_MANIFEST);
+    auto start = std::chrono::steady_clock::now();
+    vm.manifest(LocationRange("During manifestation"), visitor);
+    vm.addManifestSeconds(seconds_since(start));
+}
@@ -17,9 +17,30 @@ limitations under the License.
 #ifndef JSONNET_VM_H
 #define JSONNET_VM_H
 
+#include <memory>
+
 #include "ast.h"
 #include "libjsonnet.h"
 
+/** Where to report the phases of evaluations, see jsonnet_trace_callback. */
+struct VmTrace {
+    JsonnetTraceCallback *callback;
+    void *ctx;
+};
+
+/** Reports the beginning of a phase when created and its end when destroyed, even by an
+ * exception.  Does nothing if the trace is nullptr.
+ */
+class VmTraceSpan {
+    const VmTrace *trace;
+    JsonnetTracePhase phase;
+    std::string detail;
+
+    public:
+    VmTraceSpan(const VmTrace *trace, JsonnetTracePhase phase, const std::string &detail = "");
+    ~VmTraceSpan(void);
+};
+
 /** A single line of a stack trace from a runtime error.
  */
 struct TraceFrame {
@@ -41,6 +62,36 @@ struct RuntimeError {
     { }
 };
 
+/** The representation of the opaque struct of the C API, see jsonnet_native_callback. */
+struct JsonnetJsonValue {
+    enum Kind {
+        ARRAY,
+        BOOL,
+        NULL_KIND,
+        NUMBER,
+        OBJECT,
+        STRING,
+    };
+    Kind kind;
+    std::string string;
+    /** The number, or for a bool 0 or 1. */
+    double number;
+    std::vector<std::unique_ptr<JsonnetJsonValue>> elements;
+    std::map<std::string, std::unique_ptr<JsonnetJsonValue>> fields;
+    JsonnetJsonValue(Kind kind, const std::string &string, double number)
+      : kind(kind), string(string), number(number)
+    { }
+};
+
+/** A function registered with jsonnet_native_callback. */
+struct VmNativeCallback {
+    JsonnetNativeCallback *cb;
+    void *ctx;
+    std::vector<std::string> params;
+};
+
+typedef std::map<std::string, VmNativeCallback> VmNativeCallbackMap;
+
 /** Stores external values / code. */
 struct VmExt {
     std::string data;
@@ -51,70 +102,291 @@ struct VmExt {
     { }
 };
 
+/** The content of an imported file, whose release hook is called when the last reference to it
+ * is dropped.
+ */
+typedef std::shared_ptr<const JsonnetImportBuffer> VmImportBuffer;
+
+/** Take ownership of a buffer lent by an import callback. */
+VmImportBuffer jsonnet_vm_import_buffer(const JsonnetImportBuffer &buf);
+
+/** State that can be kept from one evaluation to the next: the standard library, and the
+ * imported files together with their ASTs.
+ *
+ * Every evaluation needs a session, but it may be thrown away afterwards.  The standard library
+ * is kept in alloc, so the program being executed must be parsed using an Allocator whose parent
+ * is alloc.  Each import has an Allocator of its own, whose parent is also alloc.  Imported ASTs
+ * are only reused while the content of the file is unchanged.  When a file did change, the
+ * Allocator of its previous AST is freed at the end of the evaluation that replaced it.
+ *
+ * A session can be given a parent session, which it reads but never modifies.  Many threads can
+ * thus share a parent, each evaluating in a session of its own.
+ */
+struct VmSession {
+    struct Import {
+        /** What expr was parsed from, lent by the import callback until it is replaced. */
+        VmImportBuffer content;
+        AST *expr;
+        /** Owns expr, and the identifiers that were not already interned in the session. */
+        std::unique_ptr<Allocator> alloc;
+        Import(void) : expr(nullptr) { }
+    };
+
+    /** Read-only fallback for stdlib and imports, or nullptr. */
+    const VmSession *parent;
+
+    /** Owns the ASTs below, and the identifiers they use. */
+    Allocator alloc;
+
+    /** The desugared and analysed std object, bound to $std by the interpreter. */
+    const DesugaredObject *stdlib;
+
+    /** Parsed imports, keyed by the path at which the file was found. */
+    std::map<std::string, Import> imports;
+
+    /** The Allocators of imports replaced during the current evaluation.
+     *
+     * The evaluation can still be using their ASTs, so they are only freed by
+     * dropStaleImports, once it has finished.
+     */
+    std::vector<std::unique_ptr<Allocator>> staleImports;
+
+    /** If not empty, a directory (ending in '/') in which ASTs are cached between processes. */
+    std::string astCacheDir;
+
+    /** Create a session, loading the standard library unless it comes from the parent. */
+    VmSession(const VmSession *parent = nullptr, const std::string &ast_cache_dir = "");
+
+    /** Lex, parse, desugar and analyse a file, or load the result from astCacheDir.
+     *
+     * \param alloc Used to create the AST.
+     * \param filename The name of the file, as used in error messages.
+     * \param content The Jsonnet code in the file, followed by a '\0'.
+     * \param length The number of bytes of code at content.
+     * \param trace If not nullptr, the phases of the parse are reported to it.
+     * \throws StaticError for errors in the code.
+     */
+    AST *parse(Allocator *alloc, const std::string &filename, const char *content, size_t length,
+               const VmTrace *trace = nullptr) const;
+
+    /** Return the AST of the import found at the given path, if it was parsed in this session
+     * or one of its parents from the same content.  Otherwise nullptr.
+     */
+    AST *findImport(const std::string &found_here, const VmImportBuffer &content) const;
+
+    /** Free the imports replaced by an evaluation that has finished. */
+    void dropStaleImports(void)
+    {
+        staleImports.clear();
+    }
+};
+
+/** Time and heap allocations attributed to the call frames of evaluations: the functions,
+ * object fields and thunks that were executed.
+ */
+struct VmProfile {
+    struct Entry {
+        /** How many times a frame was entered with this stack. */
+        unsigned long calls;
+        /** Time spent in such frames, not counting the frames they called in turn. */
+        double selfSeconds;
+        /** Heap entities allocated likewise. */
+        unsigned long selfAllocations;
+        Entry(void) : calls(0), selfSeconds(0), selfAllocations(0) { }
+    };
+
+    /** Keyed by the names of the frames on the stack, outermost first. */
+    std::map<std::vector<std::string>, Entry> stacks;
+
+    /** Add the data of another profile to this one. */
+    void merge(const VmProfile &other);
+
+    /** A table with a line for each frame name, the most expensive first. */
+    std::string flatReport(void) const;
+
+    /** A line for each stack and its self time in microseconds, as read by flamegraph.pl. */
+    std::string foldedReport(void) const;
+};
+
+/** Counters of the heap, garbage collector and thunks of evaluations, for tuning the garbage
+ * collector parameters.
+ */
+struct VmStats {
+    struct Entities {
+        /** How many entities of the kind were allocated. */
+        unsigned long allocations;
+        /** Their memory, not counting what they point to, but counting array elements once
+         * however many arrays share them.
+         */
+        unsigned long bytes;
+        Entities(void) : allocations(0), bytes(0) { }
+    };
+
+    /** Keyed by the kind of heap entity, e.g. "thunk". */
+    std::map<std::string, Entities> entities;
+
+    unsigned long evaluations;
+
+    unsigned long gcCycles;
+
+    /** Time spent marking and sweeping in garbage collection cycles. */
+    double gcMarkSeconds;
+    double gcSweepSeconds;
+
+    /** The greatest number of heap entities alive at once in any evaluation. */
+    unsigned long peakEntities;
+
+    /** How many times a thunk was evaluated. */
+    unsigned long thunksForced;
+
+    /** How many times the value of a thunk was used that had already been evaluated. */
+    unsigned long thunksReused;
+
+    /** Time spent evaluating programs, including garbage collection. */
+    double evaluateSeconds;
+
+    /** Time spent manifesting their values, which can evaluate fields not yet evaluated. */
+    double manifestSeconds;
+
+    VmStats(void)
+      : evaluations(0), gcCycles(0), gcMarkSeconds(0), gcSweepSeconds(0), peakEntities(0),
+        thunksForced(0), thunksReused(0), evaluateSeconds(0), manifestSeconds(0)
+    { }
+
+    /** Add the counters of another evaluation to these. */
+    void merge(const VmStats &other);
+
+    /** The counters as a JSON object. */
+    std::string toJson(void) const;
+};
+
+/** Receives the value of a program as it is manifested, see jsonnet_vm_execute_visit.
+ *
+ * Arrays and objects are given by their beginning, then each element or each field name followed
+ * by its value, then their end.  The fields are in the same order as in JSON output.
+ */
+struct VmVisitor {
+    virtual ~VmVisitor(void) { }
+    virtual void null(void) = 0;
+    virtual void boolean(bool v) = 0;
+    virtual void number(double v) = 0;
+    virtual void string(const String &v) = 0;
+    virtual void beginArray(void) = 0;
+    virtual void endArray(void) = 0;
+    virtual void beginObject(void) = 0;
+    virtual void field(const String &name) = 0;
+    virtual void endObject(void) = 0;
+};
 
 /** Execute the program and return the value as a JSON string.
  *
+ * \param session Cached state from previous evaluations, also updated by this one.
  * \param alloc The allocator used to create the ast.
  * \param ast The program to execute.
  * \param ext The external vars / code.
+ * \param natives The functions given by std.native.
  * \param max_stack Recursion beyond this level gives an error.
  * \param gc_min_objects The garbage collector does not run when the heap is this small.
  * \param gc_growth_trigger Growth since last garbage collection cycle to trigger a new cycle.
  * \param import_callback A callback to handle imports
  * \param import_callback_ctx Context param for the import callback.
  * \param output_string Whether to expect a string and output it without JSON encoding
+ * \param profile If not nullptr, the evaluation is profiled into it, even if it fails.
+ * \param stats If not nullptr, the counters of the evaluation are added to it, even if it fails.
+ * \param trace If not nullptr, the phases of the evaluation are reported to it.
  * \throws RuntimeError reports runtime errors in the program.
  * \returns The JSON result in string form.
  */
-std::string jsonnet_vm_execute(Allocator *alloc, const AST *ast,
+std::string jsonnet_vm_execute(VmSession *session, Allocator *alloc, const AST *ast,
                                const std::map<std::string, VmExt> &ext,
+                               const VmNativeCallbackMap &natives,
                                unsigned max_stack, double gc_min_objects,
                                double gc_growth_trigger,
-                               JsonnetImportCallback *import_callback, void *import_callback_ctx,
-                               bool string_output);
+                               JsonnetImportBufferCallback *import_callback, void *import_callback_ctx,
+                               bool string_output, VmProfile *profile, VmStats *stats,
+                               const VmTrace *trace);
 
 /** Execute the program and return the value as a number of named JSON files.
  *
  * This assumes the given program yields an object whose keys are filenames.
  *
+ * \param session Cached state from previous evaluations, also updated by this one.
  * \param alloc The allocator used to create the ast.
  * \param ast The program to execute.
  * \param ext The external vars / code.
+ * \param natives The functions given by std.native.
  * \param max_stack Recursion beyond this level gives an error.
  * \param gc_min_objects The garbage collector does not run when the heap is this small.
  * \param gc_growth_trigger Growth since last garbage collection cycle to trigger a new cycle.
  * \param import_callback A callback to handle imports
  * \param import_callback_ctx Context param for the import callback.
  * \param output_string Whether to expect a string and output it without JSON encoding
+ * \param profile If not nullptr, the evaluation is profiled into it, even if it fails.
+ * \param stats If not nullptr, the counters of the evaluation are added to it, even if it fails.
+ * \param trace If not nullptr, the phases of the evaluation are reported to it.
  * \throws RuntimeError reports runtime errors in the program.
  * \returns A mapping from filename to the JSON strings for that file.
  */
 std::map<std::string, std::string> jsonnet_vm_execute_multi(
-    Allocator *alloc, const AST *ast, const std::map<std::string, VmExt> &ext,
+    VmSession *session, Allocator *alloc, const AST *ast,
+    const std::map<std::string, VmExt> &ext, const VmNativeCallbackMap &natives,
     unsigned max_stack, double gc_min_objects, double gc_growth_trigger,
-    JsonnetImportCallback *import_callback, void *import_callback_ctx,
-    bool string_output);
+    JsonnetImportBufferCallback *import_callback, void *import_callback_ctx,
+    bool string_output, VmProfile *profile, VmStats *stats, const VmTrace *trace);
 
 /** Execute the program and return the value as a stream of JSON files.
  *
  * This assumes the given program yields an array whose elements are individual
  * JSON files.
  *
+ * \param session Cached state from previous evaluations, also updated by this one.
  * \param alloc The allocator used to create the ast.
  * \param ast The program to execute.
  * \param ext The external vars / code.
+ * \param natives The functions given by std.native.
  * \param max_stack Recursion beyond this level gives an error.
  * \param gc_min_objects The garbage collector does not run when the heap is this small.
  * \param gc_growth_trigger Growth since last garbage collection cycle to trigger a new cycle.
  * \param import_callback A callback to handle imports
  * \param import_callback_ctx Context param for the import callback.
  * \param output_string Whether to expect a string and output it without JSON encoding
+ * \param profile If not nullptr, the evaluation is profiled into it, even if it fails.
+ * \param stats If not nullptr, the counters of the evaluation are added to it, even if it fails.
+ * \param trace If not nullptr, the phases of the evaluation are reported to it.
  * \throws RuntimeError reports runtime errors in the program.
  * \returns A mapping from filename to the JSON strings for that file.
  */
 std::vector<std::string> jsonnet_vm_execute_stream(
-    Allocator *alloc, const AST *ast, const std::map<std::string, VmExt> &ext,
+    VmSession *session, Allocator *alloc, const AST *ast,
+    const std::map<std::string, VmExt> &ext, const VmNativeCallbackMap &natives,
+    unsigned max_stack, double gc_min_objects, double gc_growth_trigger,
+    JsonnetImportBufferCallback *import_callback, void *import_callback_ctx,
+    VmProfile *profile, VmStats *stats, const VmTrace *trace);
+
+/** Execute the program and give the value to a visitor, rather than converting it to JSON.
+ *
+ * \param session Cached state from previous evaluations, also updated by this one.
+ * \param alloc The allocator used to create the ast.
+ * \param ast The program to execute.
+ * \param ext The external vars / code.
+ * \param natives The functions given by std.native.
+ * \param max_stack Recursion beyond this level gives an error.
+ * \param gc_min_objects The garbage collector does not run when the heap is this small.
+ * \param gc_growth_trigger Growth since last garbage collection cycle to trigger a new cycle.
+ * \param import_callback A callback to handle imports
+ * \param import_callback_ctx Context param for the import callback.
+ * \param visitor Given the value as it is manifested.  If an error is thrown, it may have been
+ *     given part of the value.
+ * \param profile If not nullptr, the evaluation is profiled into it, even if it fails.
+ * \param stats If not nullptr, the counters of the evaluation are added to it, even if it fails.
+ * \param trace If not nullptr, the phases of the evaluation are reported to it.
+ * \throws RuntimeError reports runtime errors in the program.
+ */
+void jsonnet_vm_execute_visit(
+    VmSession *session, Allocator *alloc, const AST *ast,
+    const std::map<std::string, VmExt> &ext, const VmNativeCallbackMap &natives,
     unsigned max_stack, double gc_min_objects, double gc_growth_trigger,
-    JsonnetImportCallback *import_callback, void *import_callback_ctx);
+    JsonnetImportBufferCallback *import_callback, void *import_callback_ctx,
+    VmVisitor &visitor, VmProfile *profile, VmStats *stats, const VmTrace *trace);
 
 #endif
@@ -64,6 +64,11 @@ void Jsonnet::addImportPath(const std::string& path)
     ::jsonnet_jpath_add(vm_, path.c_str());
 }
 
+void Jsonnet::setSession(bool session)
+{
+    ::jsonnet_session(vm_, session);
+}
+
 void Jsonnet::setMaxTrace(uint32_t lines)
 {
     ::jsonnet_max_trace(vm_, static_cast<unsigned>(lines));
@@ -79,6 +84,35 @@ void Jsonnet::bindExtCodeVar(const std::string& key, const std::string& value)
     ::jsonnet_ext_code(vm_, key.c_str(), value.c_str());
 }
 
+void Jsonnet::bindNativeCallback(const std::string& name,
+                                 const std::vector<std::string>& params,
+                                 NativeCallback callback)
+{
+    // The binding is given to libjsonnet by address, which stays the same even
+    // when it is replaced.
+    NativeBinding& binding = native_bindings_[name];
+    binding.vm = vm_;
+    binding.callback = callback;
+    binding.num_params = params.size();
+
+    std::vector<const char*> c_params;
+    for (const auto& param : params) {
+        c_params.push_back(param.c_str());
+    }
+    c_params.push_back(nullptr);
+    auto trampoline = [](void* ctx, const JsonnetJsonValue* const* argv,
+                         int* success) -> JsonnetJsonValue* {
+        const NativeBinding& binding = *static_cast<NativeBinding*>(ctx);
+        std::vector<const JsonnetJsonValue*> args(argv, argv + binding.num_params);
+        bool ok = true;
+        JsonnetJsonValue* result = binding.callback(binding.vm, args, &ok);
+        *success = ok;
+        return result;
+    };
+    ::jsonnet_native_callback(vm_, name.c_str(), trampoline, &binding,
+                              c_params.data());
+}
+
 bool Jsonnet::evaluateFile(const std::string& filename, std::string* output)
 {
     if (output == nullptr) {
@@ -112,6 +146,61 @@ bool Jsonnet::evaluateSnippet(const std::string& filename,
     return true;
 }
 
+namespace {
+Visitor* asVisitor(void* ctx)
+{
+    return static_cast<Visitor*>(ctx);
+}
+
+const JsonnetVisitor kVisitorCallbacks = {
+    [](void* ctx) { asVisitor(ctx)->null(); },
+    [](void* ctx, int v) { asVisitor(ctx)->boolean(v != 0); },
+    [](void* ctx, double v) { asVisitor(ctx)->number(v); },
+    [](void* ctx, const char* v, size_t length) {
+        asVisitor(ctx)->string(std::string(v, length));
+    },
+    [](void* ctx) { asVisitor(ctx)->beginArray(); },
+    [](void* ctx) { asVisitor(ctx)->endArray(); },
+    [](void* ctx) { asVisitor(ctx)->beginObject(); },
+    [](void* ctx, const char* name, size_t length) {
+        asVisitor(ctx)->field(std::string(name, length));
+    },
+    [](void* ctx) { asVisitor(ctx)->endObject(); },
+};
+}  // namespace
+
+bool Jsonnet::evaluateFile(const std::string& filename, Visitor* visitor)
+{
+    if (visitor == nullptr) {
+        return false;
+    }
+    char* error = ::jsonnet_evaluate_file_visit(
+        vm_, filename.c_str(), &kVisitorCallbacks, visitor);
+    if (error != nullptr) {
+        last_error_.assign(error);
+        ::jsonnet_realloc(vm_, error, 0);
+        return false;
+    }
+    return true;
+}
+
+bool Jsonnet::evaluateSnippet(const std::string& filename,
+                              const std::string& snippet,
+                              Visitor* visitor)
+{
+    if (visitor == nullptr) {
+        return false;
+    }
+    char* error = ::jsonnet_evaluate_snippet_visit(
+        vm_, filename.c_str(), snippet.c_str(), &kVisitorCallbacks, visitor);
+    if (error != nullptr) {
+        last_error_.assign(error);
+        ::jsonnet_realloc(vm_, error, 0);
+        return false;
+    }
+    return true;
+}
+
 namespace {
 void parseMultiOutput(const char* jsonnet_output,
                       std::map<std::string, std::string>* outputs)
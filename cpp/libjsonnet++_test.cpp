@@ -94,4 +94,78 @@ TEST(JsonnetTest, TestAddImportPath)
     EXPECT_EQ("", jsonnet.lastError());
 }
 
+// Writes the values it is given on one line.
+class TestVisitor : public Visitor {
+   public:
+    std::string output;
+    void null() override { output += "null "; }
+    void boolean(bool v) override { output += v ? "true " : "false "; }
+    void number(double v) override { output += std::to_string(v) + " "; }
+    void string(const std::string& v) override { output += "'" + v + "' "; }
+    void beginArray() override { output += "[ "; }
+    void endArray() override { output += "] "; }
+    void beginObject() override { output += "{ "; }
+    void field(const std::string& name) override { output += name + ": "; }
+    void endObject() override { output += "} "; }
+};
+
+TEST(JsonnetTest, TestEvaluateFileVisitor)
+{
+    Jsonnet jsonnet;
+    ASSERT_TRUE(jsonnet.init());
+    TestVisitor visitor;
+    EXPECT_TRUE(jsonnet.evaluateFile("cpp/testdata/example.jsonnet", &visitor));
+    EXPECT_EQ("{ z: 2.000000 } ", visitor.output);
+    EXPECT_EQ("", jsonnet.lastError());
+}
+
+TEST(JsonnetTest, TestEvaluateSnippetVisitor)
+{
+    const std::string error = readFile("cpp/testdata/invalid.out");
+
+    Jsonnet jsonnet;
+    ASSERT_TRUE(jsonnet.init());
+    TestVisitor visitor;
+    EXPECT_TRUE(jsonnet.evaluateSnippet(
+        "snippet", "{ a: [null, true, 'x'], b: {}, c:: 1 }", &visitor));
+    EXPECT_EQ("{ a: [ null true 'x' ] b: { } } ", visitor.output);
+
+    const std::string input = readFile("cpp/testdata/invalid.jsonnet");
+    EXPECT_FALSE(jsonnet.evaluateSnippet("cpp/testdata/invalid.jsonnet",
+                                         input, &visitor));
+    EXPECT_EQ(error, jsonnet.lastError());
+}
+
+TEST(JsonnetTest, TestNativeCallback)
+{
+    Jsonnet jsonnet;
+    ASSERT_TRUE(jsonnet.init());
+    jsonnet.bindNativeCallback(
+        "repeat", {"s", "n"},
+        [](struct JsonnetVm* vm, const std::vector<const JsonnetJsonValue*>& args,
+           bool* success) {
+            const char* s = ::jsonnet_json_extract_string(vm, args[0]);
+            double n;
+            if (s == nullptr || !::jsonnet_json_extract_number(vm, args[1], &n)) {
+                *success = false;
+                return ::jsonnet_json_make_string(vm, "repeat takes a string and a number");
+            }
+            JsonnetJsonValue* r = ::jsonnet_json_make_array(vm);
+            for (int i = 0; i < n; ++i) {
+                ::jsonnet_json_array_append(vm, r, ::jsonnet_json_make_string(vm, s));
+            }
+            return r;
+        });
+    std::string output;
+    EXPECT_TRUE(jsonnet.evaluateSnippet(
+        "snippet", "std.native('repeat')('x', 2) + [std.native('none')]", &output));
+    EXPECT_EQ("[\n   \"x\",\n   \"x\",\n   null\n]\n", output);
+
+    EXPECT_FALSE(jsonnet.evaluateSnippet(
+        "snippet", "std.native('repeat')(1, 2)", &output));
+    EXPECT_EQ("RUNTIME ERROR: repeat takes a string and a number\n"
+              "\tsnippet:1:1-26\t\n",
+              jsonnet.lastError());
+}
+
 }  // namespace jsonnet
@@ -21,6 +21,7 @@ limitations under the License.
 #include <cstring>
 #include <string>
 #include <map>
+#include <vector>
 
 extern "C" {
     #include "libjsonnet.h"
@@ -28,6 +29,35 @@ extern "C" {
 
 namespace jsonnet {
 
+/// Receives the value of a program as it is manifested, so that it can be
+/// built directly into the embedder's own data structures rather than given
+/// as JSON text that then has to be parsed again.
+///
+/// Arrays and objects are given by their beginning, then each element or
+/// each field name followed by its value, then their end.  Strings are UTF-8.
+/// The methods must not throw.
+class Visitor {
+   public:
+    virtual ~Visitor() {}
+    virtual void null() = 0;
+    virtual void boolean(bool v) = 0;
+    virtual void number(double v) = 0;
+    virtual void string(const std::string& v) = 0;
+    virtual void beginArray() = 0;
+    virtual void endArray() = 0;
+    virtual void beginObject() = 0;
+    virtual void field(const std::string& name) = 0;
+    virtual void endObject() = 0;
+};
+
+/// A native function, see Jsonnet::bindNativeCallback.  It is given the VM,
+/// to make its result with the jsonnet_json_make_* functions of libjsonnet.h,
+/// and one argument for each parameter.  On failure, it sets *success to
+/// false and returns the error message as a string value.
+typedef std::function<JsonnetJsonValue*(
+    struct JsonnetVm* vm, const std::vector<const JsonnetJsonValue*>& args,
+    bool* success)> NativeCallback;
+
 class Jsonnet {
    public:
     Jsonnet();
@@ -66,6 +96,10 @@ class Jsonnet {
     /// Add to the default import callback's library search path.
     void addImportPath(const std::string& path);
 
+    /// Set whether to keep the standard library, imported files and their
+    /// parsed ASTs between evaluations.  Changed files are still picked up.
+    void setSession(bool session);
+
     /// Bind a Jsonnet external variable to the given value.
     ///
     /// Argument values are copied so memory should be managed by caller.
@@ -76,6 +110,17 @@ class Jsonnet {
     /// Argument values are copied so memory should be managed by caller.
     void bindExtCodeVar(const std::string& key, const std::string& value);
 
+    /// Register a native function, which Jsonnet code gets with
+    /// std.native(name).  Its arguments can only be null, bools, numbers or
+    /// strings.
+    ///
+    /// @param name The name given to std.native.
+    /// @param params The names of the parameters.
+    /// @param callback The implementation of the function.
+    void bindNativeCallback(const std::string& name,
+                            const std::vector<std::string>& params,
+                            NativeCallback callback);
+
     /// Evaluate a file containing Jsonnet code to return a JSON string.
     ///
     /// This method returns true if the Jsonnet code is successfully evaluated.
@@ -103,6 +148,36 @@ class Jsonnet {
                          const std::string& snippet,
                          std::string* output);
 
+    /// Evaluate a file containing Jsonnet code, giving its value to a visitor.
+    ///
+    /// This method returns true if the Jsonnet code is successfully evaluated.
+    /// Otherwise, it returns false, and the error output can be returned by
+    /// calling LastError().  The visitor may then have been given part of the
+    /// value.
+    ///
+    /// @param filename Path to a file containing Jsonnet code.
+    /// @param visitor The visitor to give the value to.
+    /// @return true if the Jsonnet code was successfully evaluated, false
+    ///         otherwise.
+    bool evaluateFile(const std::string& filename, Visitor* visitor);
+
+    /// Evaluate a string containing Jsonnet code, giving its value to a
+    /// visitor.
+    ///
+    /// This method returns true if the Jsonnet code is successfully evaluated.
+    /// Otherwise, it returns false, and the error output can be returned by
+    /// calling LastError().  The visitor may then have been given part of the
+    /// value.
+    ///
+    /// @param filename Path to a file (used in error message).
+    /// @param snippet Jsonnet code to execute.
+    /// @param visitor The visitor to give the value to.
+    /// @return true if the Jsonnet code was successfully evaluated, false
+    ///         otherwise.
+    bool evaluateSnippet(const std::string& filename,
+                         const std::string& snippet,
+                         Visitor* visitor);
+
     /// Evaluate a file containing Jsonnet code, return a number of JSON files.
     ///
     /// This method returns true if the Jsonnet code is successfully evaluated.
@@ -135,8 +210,15 @@ class Jsonnet {
     std::string lastError() const;
 
   private:
+    struct NativeBinding {
+        struct JsonnetVm* vm;
+        NativeCallback callback;
+        size_t num_params;
+    };
+
     struct JsonnetVm* vm_;
     std::string last_error_;
+    std::map<std::string, NativeBinding> native_bindings_;
 };
 
 }  // namespace jsonnet
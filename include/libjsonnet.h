@@ -81,6 +81,119 @@ char *jsonnet_realloc(struct JsonnetVm *vm, char *buf, size_t sz);
  */
 void jsonnet_import_callback(struct JsonnetVm *vm, JsonnetImportCallback *cb, void *ctx);
 
+/** The content of an imported file, lent to libjsonnet by a JsonnetImportBufferCallback.
+ *
+ * It is released once the evaluation ends, or later if it is kept by jsonnet_session.
+ */
+struct JsonnetImportBuffer {
+    /** The bytes of the file, which must stay valid and unchanged until release is called. */
+    const char *data;
+    /** The number of bytes at data. */
+    size_t length;
+    /** Called once libjsonnet no longer needs data, with release_ctx.  May be NULL. */
+    void (*release)(void *release_ctx);
+    void *release_ctx;
+};
+
+/** Callback used to load imports without copying their content.
+ *
+ * This is like JsonnetImportCallback, but rather than copying the content into a buffer from
+ * jsonnet_realloc, it can lend libjsonnet memory it already has.  That memory is read directly
+ * while it is lent, so it must not be a mapping of a file that can be rewritten or truncated.
+ *
+ * \param ctx User pointer, given in jsonnet_import_buffer_callback.
+ * \param base The directory containing the code that did the import.
+ * \param rel The path imported by the code.
+ * \param found_here On success, set this byref param as for JsonnetImportCallback.
+ * \param content On success, fill this in with the content of the imported file.
+ * \returns NULL on success, otherwise an error message allocated with jsonnet_realloc.
+ */
+typedef char *JsonnetImportBufferCallback(void *ctx, const char *base, const char *rel,
+                                          char **found_here, struct JsonnetImportBuffer *content);
+
+/** Override the callback used to locate imports, with one that does not copy their content.
+ *
+ * This replaces any callback set with jsonnet_import_callback, and vice versa.
+ */
+void jsonnet_import_buffer_callback(struct JsonnetVm *vm, JsonnetImportBufferCallback *cb,
+                                    void *ctx);
+
+/** A JSON value, given to and returned from native callbacks. */
+struct JsonnetJsonValue;
+
+/** If the value is a string, return it as UTF8, otherwise return NULL. */
+const char *jsonnet_json_extract_string(struct JsonnetVm *vm, const struct JsonnetJsonValue *v);
+
+/** If the value is a number, set *out to it and return 1, otherwise return 0. */
+int jsonnet_json_extract_number(struct JsonnetVm *vm, const struct JsonnetJsonValue *v,
+                                double *out);
+
+/** Return 0 if the value is false, 1 if it is true, and 2 if it is not a bool. */
+int jsonnet_json_extract_bool(struct JsonnetVm *vm, const struct JsonnetJsonValue *v);
+
+/** Return 1 if the value is null, otherwise 0. */
+int jsonnet_json_extract_null(struct JsonnetVm *vm, const struct JsonnetJsonValue *v);
+
+/** Make a string value, copying v, which is UTF8. */
+struct JsonnetJsonValue *jsonnet_json_make_string(struct JsonnetVm *vm, const char *v);
+
+/** Make a number value, which must not be infinite or NaN. */
+struct JsonnetJsonValue *jsonnet_json_make_number(struct JsonnetVm *vm, double v);
+
+/** Make a bool value, false if v is 0 and true otherwise. */
+struct JsonnetJsonValue *jsonnet_json_make_bool(struct JsonnetVm *vm, int v);
+
+/** Make a null value. */
+struct JsonnetJsonValue *jsonnet_json_make_null(struct JsonnetVm *vm);
+
+/** Make an empty array, to be filled with jsonnet_json_array_append. */
+struct JsonnetJsonValue *jsonnet_json_make_array(struct JsonnetVm *vm);
+
+/** Add v to the end of the array arr, which takes ownership of v. */
+void jsonnet_json_array_append(struct JsonnetVm *vm, struct JsonnetJsonValue *arr,
+                               struct JsonnetJsonValue *v);
+
+/** Make an empty object, to be filled with jsonnet_json_object_append. */
+struct JsonnetJsonValue *jsonnet_json_make_object(struct JsonnetVm *vm);
+
+/** Add the field f with the value v to the object obj, which takes ownership of v.  This replaces
+ * any field already called f.
+ */
+void jsonnet_json_object_append(struct JsonnetVm *vm, struct JsonnetJsonValue *obj,
+                                const char *f, struct JsonnetJsonValue *v);
+
+/** Clean up a value that was made but not given to libjsonnet, including its elements/fields. */
+void jsonnet_json_destroy(struct JsonnetVm *vm, struct JsonnetJsonValue *v);
+
+/** Callback implementing a native function, see jsonnet_native_callback.
+ *
+ * The arguments are forced, and can only be null, bools, numbers or strings.  They are only valid
+ * until the callback returns.
+ *
+ * \param ctx User pointer, given in jsonnet_native_callback.
+ * \param argv Array of the arguments, one for each of the params given in
+ *     jsonnet_native_callback.
+ * \param success Set this byref param to 1 to indicate success and 0 for failure.
+ * \returns The result of the function, or on failure a string value with the error message.
+ *     libjsonnet takes ownership of it.
+ */
+typedef struct JsonnetJsonValue *JsonnetNativeCallback(void *ctx,
+                                                       const struct JsonnetJsonValue *const *argv,
+                                                       int *success);
+
+/** Register a native function, which Jsonnet code gets with std.native(name) and then calls like
+ * any other function.  std.native gives null for names that were not registered.
+ *
+ * On a VM frozen with jsonnet_freeze, the callback may be called from several threads at once.
+ *
+ * \param name The name given to std.native.
+ * \param cb The implementation of the function.
+ * \param ctx User pointer, given to cb.
+ * \param params The names of the parameters, terminated with NULL.  They are copied.
+ */
+void jsonnet_native_callback(struct JsonnetVm *vm, const char *name, JsonnetNativeCallback *cb,
+                             void *ctx, const char *const *params);
+
 /** Bind a Jsonnet external var to the given value.
  *
  * Argument values are copied so memory should be managed by caller.
@@ -164,6 +277,130 @@ void jsonnet_max_trace(struct JsonnetVm *vm, unsigned v);
 /** Add to the default import callback's library search path. */
 void jsonnet_jpath_add(struct JsonnetVm *vm, const char *v);
 
+/** Profile the evaluations on this VM.
+ *
+ * While enabled, the time spent and the heap entities allocated in each function, object field
+ * and thunk are measured, see jsonnet_profile_report.  This makes evaluation slower.  Enabling it
+ * discards the profile of earlier evaluations.  Disabling it (the default) keeps the profile.
+ */
+void jsonnet_profile(struct JsonnetVm *vm, int v);
+
+/** Return the profile of the evaluations since jsonnet_profile was enabled.
+ *
+ * Time and allocations are attributed to the call frames of the evaluation, each named after what
+ * was called and where.  The returned string should be cleaned up with jsonnet_realloc.
+ *
+ * \param folded If 0, a table with a line for each frame.  Otherwise, a line for each stack of
+ *     frames with its time in microseconds, in the folded format used to make flame graphs.
+ * \returns The report.
+ */
+char *jsonnet_profile_report(struct JsonnetVm *vm, int folded);
+
+/** Count the heap, garbage collector and thunks of the evaluations on this VM.
+ *
+ * While enabled, the counters of each evaluation are added to those returned by jsonnet_stats.
+ * This makes garbage collection slower, as the memory of array elements is measured as arrays
+ * are freed.  Disabled by default.
+ */
+void jsonnet_collect_stats(struct JsonnetVm *vm, int v);
+
+/** Return counters of the heap, garbage collector and thunks, totalled over the evaluations on
+ * this VM while jsonnet_collect_stats was enabled, as a JSON object.
+ *
+ * These help to choose jsonnet_gc_min_objects and jsonnet_gc_growth_trigger: the allocations and
+ * memory by kind of heap entity, the number of garbage collection cycles and the time spent
+ * marking and sweeping, the peak number of live entities, and how often a thunk was evaluated
+ * rather than its value reused.  The returned string should be cleaned up with jsonnet_realloc.
+ */
+char *jsonnet_stats(struct JsonnetVm *vm);
+
+/** Get statistics about the file system accesses of the default import callback.
+ *
+ * The callback remembers the paths it did not find until their directory changes, so importing
+ * the same library from many directories, or in many evaluations, does not probe the library
+ * paths before it again.  The counts are totals over the life of the VM.
+ *
+ * \param probes Set to the number of paths that were looked for on the file system.
+ * \param cache_hits Set to the number of paths known to be missing without looking for them.
+ */
+void jsonnet_import_stats(struct JsonnetVm *vm, unsigned long *probes, unsigned long *cache_hits);
+
+/** The phases of an evaluation reported to a JsonnetTraceCallback. */
+enum JsonnetTracePhase {
+    /** Lexing a file. */
+    JSONNET_TRACE_LEX,
+    /** Parsing a file, or building the value of a file imported as JSON. */
+    JSONNET_TRACE_PARSE,
+    /** Desugaring a file. */
+    JSONNET_TRACE_DESUGAR,
+    /** Static analysis of a file. */
+    JSONNET_TRACE_ANALYSIS,
+    /** Loading an imported file, through the import callback. */
+    JSONNET_TRACE_IMPORT,
+    /** Evaluating the program, which includes the imports and most garbage collection. */
+    JSONNET_TRACE_EVALUATE,
+    /** A garbage collection cycle. */
+    JSONNET_TRACE_GC,
+    /** Manifesting the value of the program, which can evaluate fields not yet evaluated. */
+    JSONNET_TRACE_MANIFEST
+};
+
+/** Callback told when a phase of an evaluation begins and ends.
+ *
+ * Phases nest properly, and every beginning is followed by an end, even if the phase fails.  The
+ * callback must not call back into the VM.
+ *
+ * \param ctx User pointer, given in jsonnet_trace_callback.
+ * \param phase The phase that begins or ends.
+ * \param begin 1 when the phase begins, 0 when it ends.
+ * \param detail For lexing, parsing, desugaring and static analysis, the name of the file.  For
+ *     imports, the path as written in the import.  Otherwise "".
+ * \param timestamp A monotonic clock, in seconds since some arbitrary point.
+ */
+typedef void JsonnetTraceCallback(void *ctx, enum JsonnetTracePhase phase, int begin,
+                                  const char *detail, double timestamp);
+
+/** Report the phases of the evaluations on this VM to a callback, or pass NULL to stop.
+ *
+ * Files whose parsed form is found in the jsonnet_ast_cache_dir are not lexed, parsed, desugared
+ * or analysed, and imports already loaded by the same evaluation are not loaded again.  On a
+ * frozen VM the callback is called from many threads at once.
+ */
+void jsonnet_trace_callback(struct JsonnetVm *vm, JsonnetTraceCallback *cb, void *ctx);
+
+/** Keep state between calls to the jsonnet_evaluate_* functions on this VM.
+ *
+ * While enabled, the standard library, imported files and their parsed ASTs are kept and reused by
+ * later evaluations.  Imports are still resolved every time, but an AST is only parsed again if
+ * the content of the file has changed, and the default import callback only reads a file again if
+ * its modification time or size has changed.  Disabling it (the default) frees everything kept.
+ *
+ * The session keeps the content of each imported Jsonnet file, rather than a copy of it, to compare
+ * with the next time it is imported.  A buffer lent by a JsonnetImportBufferCallback is therefore
+ * only released once the file's content has changed or the session is freed.
+ */
+void jsonnet_session(struct JsonnetVm *vm, int v);
+
+/** Cache the parsed form of each evaluated or imported file in a directory.
+ *
+ * Entries are keyed by the interpreter version and the name and content of the file, so they never
+ * go stale, and later processes using the same directory skip parsing any file that is unchanged.
+ * The directory must already exist.  It can be shared by many processes at once.  Pass "" (the
+ * default) to disable the cache.
+ */
+void jsonnet_ast_cache_dir(struct JsonnetVm *vm, const char *dir);
+
+/** Make the VM immutable, so that it can be shared between threads.
+ *
+ * After this, the jsonnet_evaluate_* and jsonnet_fmt_* functions can be called on the VM from
+ * many threads at once, and calling any of the functions that change its configuration is a
+ * fatal error.  The standard library, and anything kept by jsonnet_session beforehand, is shared
+ * by all evaluations.  Other state is private to each evaluation.  An import callback set with
+ * jsonnet_import_callback or jsonnet_import_buffer_callback must itself be safe to call from many
+ * threads.  The VM must only be destroyed when no thread is using it any more.
+ */
+void jsonnet_freeze(struct JsonnetVm *vm);
+
 /** Evaluate a file containing Jsonnet code, return a JSON string.
  *
  * The returned string should be cleaned up with jsonnet_realloc.
@@ -246,6 +483,54 @@ char *jsonnet_evaluate_snippet_stream(struct JsonnetVm *vm,
                                       const char *snippet,
                                       int *error);
 
+/** Callbacks given the value of a program as it is manifested, rather than JSON text.
+ *
+ * Arrays and objects are given by their beginning, then each element or each field name followed
+ * by its value, then their end.  The fields are in the same order as in JSON output.  Strings are
+ * UTF-8 and may contain '\0', so their length is also given.
+ */
+struct JsonnetVisitor {
+    void (*null)(void *ctx);
+    void (*boolean)(void *ctx, int v);
+    void (*number)(void *ctx, double v);
+    void (*string)(void *ctx, const char *v, size_t length);
+    void (*begin_array)(void *ctx);
+    void (*end_array)(void *ctx);
+    void (*begin_object)(void *ctx);
+    void (*field)(void *ctx, const char *name, size_t length);
+    void (*end_object)(void *ctx);
+};
+
+/** Evaluate a file containing Jsonnet code, giving its value to a visitor.
+ *
+ * \param filename Path to a file containing Jsonnet code.
+ * \param visitor The callbacks to give the value to.  If there is an error, they may have been
+ *     given part of the value.
+ * \param ctx User pointer, given to the callbacks.
+ * \returns NULL, or the error message if there was an error, to be cleaned up with
+ *     jsonnet_realloc.
+ */
+char *jsonnet_evaluate_file_visit(struct JsonnetVm *vm,
+                                  const char *filename,
+                                  const struct JsonnetVisitor *visitor,
+                                  void *ctx);
+
+/** Evaluate a string containing Jsonnet code, giving its value to a visitor.
+ *
+ * \param filename Path to a file (used in error messages).
+ * \param snippet Jsonnet code to execute.
+ * \param visitor The callbacks to give the value to.  If there is an error, they may have been
+ *     given part of the value.
+ * \param ctx User pointer, given to the callbacks.
+ * \returns NULL, or the error message if there was an error, to be cleaned up with
+ *     jsonnet_realloc.
+ */
+char *jsonnet_evaluate_snippet_visit(struct JsonnetVm *vm,
+                                     const char *filename,
+                                     const char *snippet,
+                                     const struct JsonnetVisitor *visitor,
+                                     void *ctx);
+
 /** Complement of \see jsonnet_vm_make. */
 void jsonnet_destroy(struct JsonnetVm *vm);
 
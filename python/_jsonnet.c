@@ -16,6 +16,10 @@ limitations under the License.
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+#include <pthread.h>
+#include <unistd.h>
 
 #include <Python.h>
 
@@ -33,12 +37,15 @@ struct ImportCtx {
     PyObject *callback;
 };
 
+/** Calls the Python import callback.  Evaluations run without the GIL, so it is taken here.
+ */
 static char *cpython_import_callback(void *ctx_, const char *base, const char *rel,
                                      char **found_here, int *success)
 {
     const struct ImportCtx *ctx = ctx_;
     PyObject *arglist, *result;
     char *out;
+    PyGILState_STATE gil = PyGILState_Ensure();
 
     arglist = Py_BuildValue("(s, s)", base, rel);
     result = PyEval_CallObject(ctx->callback, arglist);
@@ -55,6 +62,7 @@ static char *cpython_import_callback(void *ctx_, const char *base, const char *r
         char *out = jsonnet_str(ctx->vm, exc_cstr);
         *success = 0;
         PyErr_Clear();
+        PyGILState_Release(gil);
         return out;
     }
 
@@ -81,24 +89,220 @@ static char *cpython_import_callback(void *ctx_, const char *base, const char *r
 
     Py_DECREF(result);
 
+    PyGILState_Release(gil);
+    return out;
+}
+
+/** Release the GIL around jsonnet_evaluate_file or jsonnet_evaluate_snippet. */
+static char *evaluate_nogil(struct JsonnetVm *vm, const char *filename, const char *src,
+                            int *error)
+{
+    char *out;
+    Py_BEGIN_ALLOW_THREADS
+    if (src == NULL) {
+        out = jsonnet_evaluate_file(vm, filename, error);
+    } else {
+        out = jsonnet_evaluate_snippet(vm, filename, src, error);
+    }
+    Py_END_ALLOW_THREADS
     return out;
 }
 
+/** The value of an evaluation, recorded by the callbacks of native_visitor.
+ *
+ * The callbacks are called without the GIL, so they only append the events to a buffer.  The
+ * Python value is built from it by native_result, once the evaluation is done.
+ */
+struct NativeEvents {
+    char *data;
+    size_t length, capacity;
+    /** Set if the buffer could not be grown, in which case the value is lost. */
+    int failed;
+};
+
+/* The tags of the events.  Numbers are followed by a double, and strings and field names by a
+ * size_t and that many bytes.
+ */
+enum {
+    NATIVE_NULL, NATIVE_TRUE, NATIVE_FALSE, NATIVE_NUMBER, NATIVE_STRING, NATIVE_BEGIN_ARRAY,
+    NATIVE_BEGIN_OBJECT, NATIVE_FIELD, NATIVE_END
+};
+
+static void native_append(struct NativeEvents *e, const void *data, size_t length)
+{
+    if (e->failed) return;
+    if (e->length + length > e->capacity) {
+        size_t capacity = e->capacity == 0 ? 256 : e->capacity * 2;
+        while (capacity < e->length + length) capacity *= 2;
+        char *grown = realloc(e->data, capacity);
+        if (grown == NULL) {
+            e->failed = 1;
+            return;
+        }
+        e->data = grown;
+        e->capacity = capacity;
+    }
+    memcpy(e->data + e->length, data, length);
+    e->length += length;
+}
+
+static void native_tag(struct NativeEvents *e, char tag)
+{
+    native_append(e, &tag, 1);
+}
+
+static void native_bytes(struct NativeEvents *e, char tag, const char *v, size_t length)
+{
+    native_tag(e, tag);
+    native_append(e, &length, sizeof length);
+    native_append(e, v, length);
+}
+
+static void native_null(void *ctx) { native_tag(ctx, NATIVE_NULL); }
+static void native_boolean(void *ctx, int v) { native_tag(ctx, v ? NATIVE_TRUE : NATIVE_FALSE); }
+static void native_begin_array(void *ctx) { native_tag(ctx, NATIVE_BEGIN_ARRAY); }
+static void native_begin_object(void *ctx) { native_tag(ctx, NATIVE_BEGIN_OBJECT); }
+static void native_end(void *ctx) { native_tag(ctx, NATIVE_END); }
+
+static void native_number(void *ctx, double v)
+{
+    native_tag(ctx, NATIVE_NUMBER);
+    native_append(ctx, &v, sizeof v);
+}
+
+static void native_string(void *ctx, const char *v, size_t length)
+{
+    native_bytes(ctx, NATIVE_STRING, v, length);
+}
+
+static void native_field(void *ctx, const char *name, size_t length)
+{
+    native_bytes(ctx, NATIVE_FIELD, name, length);
+}
+
+static const struct JsonnetVisitor native_visitor = {
+    native_null, native_boolean, native_number, native_string, native_begin_array, native_end,
+    native_begin_object, native_field, native_end
+};
+
+/** Decode the string following a NATIVE_STRING or NATIVE_FIELD tag, and move p past it. */
+static PyObject *native_decode(const char **p)
+{
+    size_t length;
+    memcpy(&length, *p, sizeof length);
+    *p += sizeof length;
+    *p += length;
+    return PyUnicode_DecodeUTF8(*p - length, length, NULL);
+}
+
+/** Build the Python value whose events start at p, and move p past them. */
+static PyObject *native_value(const char **p)
+{
+    PyObject *ret, *key, *v;
+    double number;
+    switch (*(*p)++) {
+        case NATIVE_NULL:
+        Py_RETURN_NONE;
+
+        case NATIVE_TRUE:
+        Py_RETURN_TRUE;
+
+        case NATIVE_FALSE:
+        Py_RETURN_FALSE;
+
+        case NATIVE_NUMBER:
+        memcpy(&number, *p, sizeof number);
+        *p += sizeof number;
+        return PyFloat_FromDouble(number);
+
+        case NATIVE_STRING:
+        return native_decode(p);
+
+        case NATIVE_BEGIN_ARRAY:
+        ret = PyList_New(0);
+        while (ret != NULL && **p != NATIVE_END) {
+            v = native_value(p);
+            if (v == NULL || PyList_Append(ret, v) != 0) Py_CLEAR(ret);
+            Py_XDECREF(v);
+        }
+        ++*p;
+        return ret;
+
+        case NATIVE_BEGIN_OBJECT:
+        ret = PyDict_New();
+        while (ret != NULL && **p != NATIVE_END) {
+            ++*p;
+            key = native_decode(p);
+            v = key == NULL ? NULL : native_value(p);
+            if (v == NULL || PyDict_SetItem(ret, key, v) != 0) Py_CLEAR(ret);
+            Py_XDECREF(key);
+            Py_XDECREF(v);
+        }
+        ++*p;
+        return ret;
+    }
+    PyErr_SetString(PyExc_RuntimeError, "invalid native value");
+    return NULL;
+}
+
+/** Return the value recorded, or raise the error of the evaluation.  Either way, the events are
+ * freed.
+ */
+static PyObject *native_result(struct JsonnetVm *vm, struct NativeEvents *e, char *err)
+{
+    PyObject *ret = NULL;
+    if (err != NULL) {
+        PyErr_SetString(PyExc_RuntimeError, err);
+        jsonnet_realloc(vm, err, 0);
+    } else if (e->failed) {
+        PyErr_NoMemory();
+    } else {
+        const char *p = e->data;
+        ret = native_value(&p);
+    }
+    free(e->data);
+    e->data = NULL;
+    e->length = e->capacity = 0;
+    e->failed = 0;
+    return ret;
+}
+
 static PyObject *handle_result(struct JsonnetVm *vm, char *out, int error)
 {
     if (error) {
         PyErr_SetString(PyExc_RuntimeError, out);
         jsonnet_realloc(vm, out, 0);
-        jsonnet_destroy(vm);
         return NULL;
     } else {
         PyObject *ret = PyString_FromString(out);
         jsonnet_realloc(vm, out, 0);
-        jsonnet_destroy(vm);
         return ret;
     }
 }
 
+/** Evaluate a file, or a snippet if src is not NULL, and return the result or raise its error.
+ *
+ * \param native If true, return the value as Python objects rather than JSON.
+ */
+static PyObject *evaluate(struct JsonnetVm *vm, const char *filename, const char *src, int native)
+{
+    int error;
+    char *out;
+    if (!native) {
+        out = evaluate_nogil(vm, filename, src, &error);
+        return handle_result(vm, out, error);
+    }
+    struct NativeEvents events = { NULL, 0, 0, 0 };
+    Py_BEGIN_ALLOW_THREADS
+    if (src == NULL) {
+        out = jsonnet_evaluate_file_visit(vm, filename, &native_visitor, &events);
+    } else {
+        out = jsonnet_evaluate_snippet_visit(vm, filename, src, &native_visitor, &events);
+    }
+    Py_END_ALLOW_THREADS
+    return native_result(vm, &events, out);
+}
+
 int handle_ext_vars(struct JsonnetVm *vm, PyObject *ext_vars)
 {
     if (ext_vars == NULL) return 1;
@@ -109,12 +313,10 @@ int handle_ext_vars(struct JsonnetVm *vm, PyObject *ext_vars)
     while (PyDict_Next(ext_vars, &pos, &key, &val)) {
         const char *key_ = PyString_AsString(key);
         if (key_ == NULL) {
-            jsonnet_destroy(vm);
             return 0;
         }
         const char *val_ = PyString_AsString(val);
         if (val_ == NULL) {
-            jsonnet_destroy(vm);
             return 0;
         }
         jsonnet_ext_var(vm, key_, val_);
@@ -141,20 +343,19 @@ int handle_import_callback(struct ImportCtx *ctx, PyObject *import_callback)
 static PyObject* evaluate_file(PyObject* self, PyObject* args, PyObject *keywds)
 {
     const char *filename;
-    char *out;
     unsigned max_stack = 500, gc_min_objects = 1000, max_trace = 20;
     double gc_growth_trigger = 2;
-    int error;
+    int native = 0;
     PyObject *ext_vars = NULL, *import_callback = NULL;
     struct JsonnetVm *vm;
-    static char *kwlist[] = {"filename", "max_stack", "gc_min_objects", "gc_growth_trigger", "ext_vars", "max_trace", "import_callback", NULL};
+    static char *kwlist[] = {"filename", "max_stack", "gc_min_objects", "gc_growth_trigger", "ext_vars", "max_trace", "import_callback", "native", NULL};
 
     (void) self;
 
-    if (!PyArg_ParseTupleAndKeywords(args, keywds, "s|IIdOIO", kwlist,
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "s|IIdOIOi", kwlist,
                                      &filename,
                                      &max_stack, &gc_min_objects, &gc_growth_trigger, &ext_vars,
-                                     &max_trace, &import_callback)) {
+                                     &max_trace, &import_callback, &native)) {
         return NULL;
     }
 
@@ -164,34 +365,36 @@ static PyObject* evaluate_file(PyObject* self, PyObject* args, PyObject *keywds)
     jsonnet_max_trace(vm, max_trace);
     jsonnet_gc_growth_trigger(vm, gc_growth_trigger);
     if (!handle_ext_vars(vm, ext_vars)) {
+        jsonnet_destroy(vm);
         return NULL;
     }
     struct ImportCtx ctx = { vm, import_callback };
     if (!handle_import_callback(&ctx, import_callback)) {
+        jsonnet_destroy(vm);
         return NULL;
     }
 
-    out = jsonnet_evaluate_file(vm, filename, &error);
-    return handle_result(vm, out, error);
+    PyObject *ret = evaluate(vm, filename, NULL, native);
+    jsonnet_destroy(vm);
+    return ret;
 }
 
 static PyObject* evaluate_snippet(PyObject* self, PyObject* args, PyObject *keywds)
 {
     const char *filename, *src;
-    char *out;
     unsigned max_stack = 500, gc_min_objects = 1000, max_trace = 20;
     double gc_growth_trigger = 2;
-    int error;
+    int native = 0;
     PyObject *ext_vars = NULL, *import_callback = NULL;
     struct JsonnetVm *vm;
-    static char *kwlist[] = {"filename", "src", "max_stack", "gc_min_objects", "gc_growth_trigger", "ext_vars", "max_trace", "import_callback", NULL};
+    static char *kwlist[] = {"filename", "src", "max_stack", "gc_min_objects", "gc_growth_trigger", "ext_vars", "max_trace", "import_callback", "native", NULL};
 
     (void) self;
 
-    if (!PyArg_ParseTupleAndKeywords(args, keywds, "ss|IIdOIO", kwlist,
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "ss|IIdOIOi", kwlist,
                                      &filename, &src,
                                      &max_stack, &gc_min_objects, &gc_growth_trigger, &ext_vars,
-                                     &max_trace, &import_callback)) {
+                                     &max_trace, &import_callback, &native)) {
         return NULL;
     }
 
@@ -201,17 +404,361 @@ static PyObject* evaluate_snippet(PyObject* self, PyObject* args, PyObject *keyw
     jsonnet_max_trace(vm, max_trace);
     jsonnet_gc_growth_trigger(vm, gc_growth_trigger);
     if (!handle_ext_vars(vm, ext_vars)) {
+        jsonnet_destroy(vm);
         return NULL;
     }
     struct ImportCtx ctx = { vm, import_callback };
     if (!handle_import_callback(&ctx, import_callback)) {
+        jsonnet_destroy(vm);
+        return NULL;
+    }
+
+    PyObject *ret = evaluate(vm, filename, src, native);
+    jsonnet_destroy(vm);
+    return ret;
+}
+
+/** A JsonnetVm in the pool of a VMObject, with the context of its import callback.
+ *
+ * It holds a reference to the callback, which the VMObject can drop while the JsonnetVm is
+ * borrowed, if it is initialised again.
+ */
+struct PooledVm {
+    struct JsonnetVm *vm;
+    struct ImportCtx ctx;
+    /** The VMObject's generation when this was created. */
+    unsigned long generation;
+    struct PooledVm *next;
+};
+
+/** A _jsonnet.VM: settings given once, and a pool of JsonnetVms configured with them.
+ *
+ * Each evaluation borrows a JsonnetVm from the pool, so evaluations running at the same time in
+ * different threads never share one.  The JsonnetVms keep a session, so the standard library and
+ * the parsed imports are reused by later evaluations.  The pool is only used with the GIL held.
+ */
+typedef struct {
+    PyObject_HEAD
+    unsigned maxStack, gcMinObjects, maxTrace;
+    double gcGrowthTrigger;
+    PyObject *extVars;
+    PyObject *importCallback;
+    /** Incremented by each __init__, so that borrowed JsonnetVms with old settings are not
+     * returned to the pool.
+     */
+    unsigned long generation;
+    struct PooledVm *idle;
+} VMObject;
+
+static void vm_destroy(struct PooledVm *pooled)
+{
+    jsonnet_destroy(pooled->vm);
+    Py_XDECREF(pooled->ctx.callback);
+    free(pooled);
+}
+
+static struct PooledVm *vm_borrow(VMObject *self)
+{
+    struct PooledVm *pooled = self->idle;
+    if (pooled != NULL) {
+        self->idle = pooled->next;
+        return pooled;
+    }
+    pooled = malloc(sizeof(struct PooledVm));
+    if (pooled == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    pooled->vm = jsonnet_make();
+    pooled->ctx.vm = pooled->vm;
+    pooled->ctx.callback = self->importCallback;
+    Py_XINCREF(pooled->ctx.callback);
+    pooled->generation = self->generation;
+    jsonnet_max_stack(pooled->vm, self->maxStack);
+    jsonnet_gc_min_objects(pooled->vm, self->gcMinObjects);
+    jsonnet_max_trace(pooled->vm, self->maxTrace);
+    jsonnet_gc_growth_trigger(pooled->vm, self->gcGrowthTrigger);
+    if (!handle_ext_vars(pooled->vm, self->extVars)
+        || !handle_import_callback(&pooled->ctx, self->importCallback)) {
+        vm_destroy(pooled);
+        return NULL;
+    }
+    jsonnet_session(pooled->vm, 1);
+    return pooled;
+}
+
+static void vm_return(VMObject *self, struct PooledVm *pooled)
+{
+    if (pooled->generation != self->generation) {
+        vm_destroy(pooled);
+        return;
+    }
+    pooled->next = self->idle;
+    self->idle = pooled;
+}
+
+static int VM_init(VMObject *self, PyObject *args, PyObject *keywds)
+{
+    PyObject *ext_vars = NULL, *import_callback = NULL;
+    struct PooledVm *pooled;
+    static char *kwlist[] = {"max_stack", "gc_min_objects", "gc_growth_trigger", "ext_vars", "max_trace", "import_callback", NULL};
+
+    self->maxStack = 500;
+    self->gcMinObjects = 1000;
+    self->maxTrace = 20;
+    self->gcGrowthTrigger = 2;
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "|IIdOIO", kwlist,
+                                     &self->maxStack, &self->gcMinObjects,
+                                     &self->gcGrowthTrigger, &ext_vars, &self->maxTrace,
+                                     &import_callback)) {
+        return -1;
+    }
+    Py_XINCREF(ext_vars);
+    Py_XINCREF(import_callback);
+    Py_CLEAR(self->extVars);
+    Py_CLEAR(self->importCallback);
+    self->extVars = ext_vars;
+    self->importCallback = import_callback;
+
+    // Empty the pool, as its JsonnetVms have the old settings.  Those still borrowed keep the
+    // old callback alive, and are destroyed when returned.  Creating one now also checks the
+    // new settings.
+    self->generation++;
+    while (self->idle != NULL) {
+        pooled = self->idle;
+        self->idle = pooled->next;
+        vm_destroy(pooled);
+    }
+    pooled = vm_borrow(self);
+    if (pooled == NULL) return -1;
+    vm_return(self, pooled);
+    return 0;
+}
+
+static void VM_dealloc(VMObject *self)
+{
+    while (self->idle != NULL) {
+        struct PooledVm *pooled = self->idle;
+        self->idle = pooled->next;
+        vm_destroy(pooled);
+    }
+    Py_XDECREF(self->extVars);
+    Py_XDECREF(self->importCallback);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyObject *VM_evaluate(VMObject *self, const char *filename, const char *src, int native)
+{
+    PyObject *ret;
+    struct PooledVm *pooled = vm_borrow(self);
+    if (pooled == NULL) return NULL;
+    ret = evaluate(pooled->vm, filename, src, native);
+    vm_return(self, pooled);
+    return ret;
+}
+
+static PyObject *VM_evaluate_file(VMObject *self, PyObject *args, PyObject *keywds)
+{
+    const char *filename;
+    int native = 0;
+    static char *kwlist[] = {"filename", "native", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "s|i", kwlist, &filename, &native)) {
+        return NULL;
+    }
+    return VM_evaluate(self, filename, NULL, native);
+}
+
+static PyObject *VM_evaluate_snippet(VMObject *self, PyObject *args, PyObject *keywds)
+{
+    const char *filename, *src;
+    int native = 0;
+    static char *kwlist[] = {"filename", "src", "native", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "ss|i", kwlist, &filename, &src, &native)) {
+        return NULL;
+    }
+    return VM_evaluate(self, filename, src, native);
+}
+
+/** One of the evaluations of evaluate_many. */
+struct Job {
+    const char *filename;
+    /** NULL to evaluate the file. */
+    const char *src;
+    /** The JSON or error message, or for native evaluations only an error message. */
+    char *out;
+    /** The JsonnetVm that allocated out. */
+    struct JsonnetVm *vm;
+    int error;
+    /** The value of a native evaluation, turned into Python objects once the threads are done. */
+    struct NativeEvents events;
+};
+
+/** The evaluations of evaluate_many, which threads take in turn. */
+struct Batch {
+    struct Job *jobs;
+    size_t numJobs;
+    size_t next;
+    int native;
+    pthread_mutex_t mutex;
+};
+
+struct Worker {
+    struct Batch *batch;
+    struct JsonnetVm *vm;
+    pthread_t thread;
+};
+
+/** Run the jobs of the batch not yet taken by another worker.  Called without the GIL. */
+static void *worker_main(void *worker_)
+{
+    struct Worker *worker = worker_;
+    struct Batch *batch = worker->batch;
+    while (1) {
+        size_t i;
+        pthread_mutex_lock(&batch->mutex);
+        i = batch->next++;
+        pthread_mutex_unlock(&batch->mutex);
+        if (i >= batch->numJobs) break;
+        struct Job *job = &batch->jobs[i];
+        job->vm = worker->vm;
+        if (batch->native && job->src == NULL) {
+            job->out = jsonnet_evaluate_file_visit(worker->vm, job->filename, &native_visitor,
+                                                   &job->events);
+        } else if (batch->native) {
+            job->out = jsonnet_evaluate_snippet_visit(worker->vm, job->filename, job->src,
+                                                      &native_visitor, &job->events);
+        }
+        if (batch->native) {
+            job->error = job->out != NULL;
+        } else if (job->src == NULL) {
+            job->out = jsonnet_evaluate_file(worker->vm, job->filename, &job->error);
+        } else {
+            job->out = jsonnet_evaluate_snippet(worker->vm, job->filename, job->src, &job->error);
+        }
+    }
+    return NULL;
+}
+
+static PyObject *VM_evaluate_many(VMObject *self, PyObject *args, PyObject *keywds)
+{
+    PyObject *jobs_arg, *jobs_seq, *ret = NULL;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t i, num_workers = 0, num_threads = 0;
+    struct Batch batch = { NULL, 0, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+    struct Worker *workers = NULL;
+    struct PooledVm **pooled = NULL;
+    static char *kwlist[] = {"jobs", "threads", "native", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "O|li", kwlist, &jobs_arg, &threads,
+                                     &batch.native)) {
         return NULL;
     }
+    jobs_seq = PySequence_Fast(jobs_arg, "jobs must be a sequence");
+    if (jobs_seq == NULL) return NULL;
+
+    // The strings are borrowed from jobs_seq, which is kept until the threads are done.
+    batch.numJobs = PySequence_Fast_GET_SIZE(jobs_seq);
+    batch.jobs = calloc(batch.numJobs + 1, sizeof(struct Job));
+    if (batch.jobs == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (i = 0 ; i < batch.numJobs ; ++i) {
+        PyObject *job = PySequence_Fast_GET_ITEM(jobs_seq, i);
+        if (PyString_Check(job)) {
+            batch.jobs[i].filename = PyString_AsString(job);
+        } else if (!PyArg_ParseTuple(job, "ss", &batch.jobs[i].filename, &batch.jobs[i].src)) {
+            PyErr_SetString(PyExc_TypeError,
+                            "each job must be a filename or a (filename, src) tuple");
+            goto done;
+        }
+    }
 
-    out = jsonnet_evaluate_snippet(vm, filename, src, &error);
-    return handle_result(vm, out, error);
+    if (threads < 1) threads = 1;
+    num_workers = (size_t)threads < batch.numJobs ? (size_t)threads : batch.numJobs;
+    workers = calloc(num_workers + 1, sizeof(struct Worker));
+    pooled = calloc(num_workers + 1, sizeof(struct PooledVm*));
+    if (workers == NULL || pooled == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (i = 0 ; i < num_workers ; ++i) {
+        pooled[i] = vm_borrow(self);
+        if (pooled[i] == NULL) goto done;
+        workers[i].batch = &batch;
+        workers[i].vm = pooled[i]->vm;
+    }
+
+    // The first worker runs in this thread, the others in threads of their own.
+    Py_BEGIN_ALLOW_THREADS
+    for (num_threads = 1 ; num_threads < num_workers ; ++num_threads) {
+        if (pthread_create(&workers[num_threads].thread, NULL, worker_main,
+                           &workers[num_threads]) != 0)
+            break;
+    }
+    if (num_workers > 0)
+        worker_main(&workers[0]);
+    for (i = 1 ; i < num_threads ; ++i)
+        pthread_join(workers[i].thread, NULL);
+    Py_END_ALLOW_THREADS
+
+    // Report the first error, or return all the results.
+    for (i = 0 ; i < batch.numJobs ; ++i) {
+        if (batch.jobs[i].error) {
+            PyErr_SetString(PyExc_RuntimeError, batch.jobs[i].out);
+            goto done;
+        }
+    }
+    ret = PyList_New(batch.numJobs);
+    if (ret == NULL) goto done;
+    for (i = 0 ; i < batch.numJobs ; ++i) {
+        PyObject *value;
+        if (batch.native) {
+            value = native_result(pooled[0]->vm, &batch.jobs[i].events, NULL);
+        } else {
+            value = PyString_FromString(batch.jobs[i].out);
+        }
+        if (value == NULL) {
+            Py_CLEAR(ret);
+            goto done;
+        }
+        PyList_SET_ITEM(ret, i, value);
+    }
+
+    done:
+    if (batch.jobs != NULL) {
+        for (i = 0 ; i < batch.numJobs ; ++i) {
+            if (batch.jobs[i].out != NULL)
+                jsonnet_realloc(batch.jobs[i].vm, batch.jobs[i].out, 0);
+            free(batch.jobs[i].events.data);
+        }
+    }
+    for (i = 0 ; pooled != NULL && i < num_workers && pooled[i] != NULL ; ++i)
+        vm_return(self, pooled[i]);
+    free(pooled);
+    free(workers);
+    free(batch.jobs);
+    Py_DECREF(jobs_seq);
+    return ret;
 }
 
+static PyMethodDef VM_methods[] = {
+    {"evaluate_file", (PyCFunction)VM_evaluate_file, METH_VARARGS | METH_KEYWORDS,
+     "Interpret the given Jsonnet file."},
+    {"evaluate_snippet", (PyCFunction)VM_evaluate_snippet, METH_VARARGS | METH_KEYWORDS,
+     "Interpret the given Jsonnet code."},
+    {"evaluate_many", (PyCFunction)VM_evaluate_many, METH_VARARGS | METH_KEYWORDS,
+     "Interpret each of a list of filenames or (filename, code) tuples, in several threads.\n"
+     "Returns the list of results, or raises the error of the first that failed."},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyTypeObject VMType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_jsonnet.VM",              /* tp_name */
+    sizeof(VMObject),           /* tp_basicsize */
+};
+
 static PyMethodDef module_methods[] = {
     {"evaluate_file", (PyCFunction)evaluate_file, METH_VARARGS | METH_KEYWORDS,
      "Interpret the given Jsonnet file."},
@@ -222,6 +769,23 @@ static PyMethodDef module_methods[] = {
 
 PyMODINIT_FUNC init_jsonnet(void)
 {
-    Py_InitModule3("_jsonnet", module_methods, "A Python interface to Jsonnet.");
+    PyObject *module;
+
+    VMType.tp_flags = Py_TPFLAGS_DEFAULT;
+    VMType.tp_doc = "A Jsonnet VM that keeps its settings and caches between evaluations.\n"
+                    "Takes the same keyword arguments as evaluate_file.";
+    VMType.tp_new = PyType_GenericNew;
+    VMType.tp_init = (initproc)VM_init;
+    VMType.tp_dealloc = (destructor)VM_dealloc;
+    VMType.tp_methods = VM_methods;
+    if (PyType_Ready(&VMType) < 0) return;
+
+    // Import callbacks can be called from the threads of VM.evaluate_many.
+    PyEval_InitThreads();
+
+    module = Py_InitModule3("_jsonnet", module_methods, "A Python interface to Jsonnet.");
+    if (module == NULL) return;
+    Py_INCREF(&VMType);
+    PyModule_AddObject(module, "VM", (PyObject*)&VMType);
 }
 
@@ -0,0 +1,70 @@
+# Copyright 2015 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import sys
+
+import _jsonnet
+
+if len(sys.argv) < 2:
+    raise Exception('Usage: <filename>...')
+
+#  Returns content if worked, None if file not found, or throws an exception
+def try_path(dir, rel):
+    if not rel:
+        raise RuntimeError('Got invalid filename (empty string).')
+    if rel[0] == '/':
+        full_path = rel
+    else:
+        full_path = dir + rel
+    if full_path[-1] == '/':
+        raise RuntimeError('Attempted to import a directory')
+
+    if not os.path.isfile(full_path):
+        return full_path, None
+    with open(full_path) as f:
+        return full_path, f.read()
+
+
+def import_callback(dir, rel):
+    full_path, content = try_path(dir, rel)
+    if content:
+        return full_path, content
+    raise RuntimeError('File not found')
+
+# One VM evaluates all the files, several at a time, reusing the imports they share.
+vm = _jsonnet.VM(import_callback=import_callback)
+for output in vm.evaluate_many(sys.argv[1:]):
+    sys.stdout.write(output)
+
+# Initialising the VM again from an import callback drops the VM's reference to that callback,
+# but the evaluation that is running keeps using it for its later imports.
+class ConstantImport(object):
+    def __init__(self, value):
+        self.value = value
+
+    def __call__(self, dir, rel):
+        if rel == 'reinit.jsonnet':
+            vm.__init__(import_callback=ConstantImport(2))
+        return rel, str(self.value)
+
+vm = _jsonnet.VM(import_callback=ConstantImport(1))
+assert vm.evaluate_snippet('snippet', "(import 'reinit.jsonnet') + (import 'x.jsonnet')") == '2\n'
+assert vm.evaluate_snippet('snippet', "import 'x.jsonnet'") == '2\n'
+
+# Native results are built in this thread once all the evaluations are done.
+vm = _jsonnet.VM()
+jobs = [('a', "{ x: [1, true, null, '\\u00e9'] }"), ('b', "{ y: { z: 'w' } }")]
+assert vm.evaluate_many(jobs, threads=2, native=True) == [
+    {u'x': [1.0, True, None, u'\xe9']}, {u'y': {u'z': u'w'}}]
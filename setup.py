@@ -20,8 +20,11 @@ from subprocess import Popen
 
 DIR = os.path.abspath(os.path.dirname(__file__))
 LIB_OBJECTS = [
+    'core/ast_cache.o',
     'core/desugarer.o',
+    'core/digest.o',
     'core/formatter.o',
+    'core/json_parser.o',
     'core/libjsonnet.o',
     'core/lexer.o',
     'core/parser.o',